@@ -2,7 +2,6 @@
 
 #include "AI/Components/ARPG_RelationshipComponent.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 #include "AI/Interfaces/ARPG_FactionInterface.h"
 
 UARPG_RelationshipComponent::UARPG_RelationshipComponent()
@@ -16,15 +15,9 @@ void UARPG_RelationshipComponent::BeginPlay()
     Super::BeginPlay();
 
     // Schedule periodic cleanup of invalid entries
-    if (GetWorld())
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
     {
-        GetWorld()->GetTimerManager().SetTimer(
-            CleanupTimer, 
-            this, 
-            &UARPG_RelationshipComponent::CleanupInvalidEntries, 
-            30.0f, // Every 30 seconds
-            true   // Repeat
-        );
+        CleanupTimer = RadiantTimers->SetTimer(this, &UARPG_RelationshipComponent::CleanupInvalidEntries, 30.0f, true); // Every 30 seconds
     }
 }
 
@@ -81,6 +74,26 @@ void UARPG_RelationshipComponent::ModifyRelationshipValue(AActor* TargetActor, f
     SetRelationshipValue(TargetActor, NewValue);
 }
 
+bool UARPG_RelationshipComponent::RemoveRelationship(AActor* TargetActor, float& OutValue)
+{
+    for (int32 Index = 0; Index < ActorRelationships.Num(); ++Index)
+    {
+        if (TargetActor && ActorRelationships[Index].TargetActor.Get() == TargetActor)
+        {
+            OutValue = ActorRelationships[Index].RelationshipValue;
+            ActorRelationships.RemoveAtSwap(Index);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UARPG_RelationshipComponent::ClearRelationships()
+{
+    ActorRelationships.Reset();
+}
+
 FARPG_RelationshipEntry* UARPG_RelationshipComponent::FindRelationshipEntry(AActor* TargetActor)
 {
     if (!TargetActor)
@@ -6,6 +6,7 @@
 #include "AI/Core/ARPG_AINeedsComponent.h"
 #include "AI/Core/ARPG_AIPersonalityComponent.h"
 #include "AI/Core/ARPG_AIEventManager.h"
+#include "AI/Core/ARPG_RoutineManager.h"
 #include "Engine/World.h"
 #include "RadiantRPG.h"
 #include "AI/ActionExecutors/ARPG_AIBehaviorExecutorComponent.h"
@@ -62,11 +63,15 @@ void UARPG_AIBrainComponent::BeginPlay()
                 // Force enable the brain using the existing method
                 SetBrainEnabled(true);
                 
-                // Set to idle state
-                SetBrainState(EARPG_BrainState::Idle);
-                
-                // Start curiosity timer as fallback behavior
-                StartCuriosityTimer();
+                // Routine followers picked up their activity when enabled
+                if (!bFollowingRoutine)
+                {
+                    // Set to idle state
+                    SetBrainState(EARPG_BrainState::Idle);
+                    
+                    // Start curiosity timer as fallback behavior
+                    StartCuriosityTimer();
+                }
             }
         },
         2.0f, // 2 second timeout
@@ -79,8 +84,14 @@ void UARPG_AIBrainComponent::BeginPlay()
 // Add this new method to handle curiosity timer
 void UARPG_AIBrainComponent::StartCuriosityTimer()
 {
+    URadiantTimerManager* RadiantTimers = GetWorld()->GetSubsystem<URadiantTimerManager>();
+    if (!RadiantTimers)
+    {
+        return;
+    }
+    
     // Clear any existing timer
-    GetWorld()->GetTimerManager().ClearTimer(CuriosityTimerHandle);
+    RadiantTimers->ClearTimer(CuriosityTimerHandle);
     
     // Calculate next curiosity check time
     float CuriosityCheckInterval = FMath::RandRange(
@@ -89,33 +100,46 @@ void UARPG_AIBrainComponent::StartCuriosityTimer()
     );
     
     // Set timer for curiosity check
-    GetWorld()->GetTimerManager().SetTimer(CuriosityTimerHandle,
-        [this]()
+    CuriosityTimerHandle = RadiantTimers->SetTimer(this, &UARPG_AIBrainComponent::HandleCuriosityTimer, CuriosityCheckInterval, false);
+}
+
+void UARPG_AIBrainComponent::HandleCuriosityTimer()
+{
+    if (ShouldActivateCuriosity())
+    {
+        UE_LOG(LogARPG, VeryVerbose, TEXT("%s activating curiosity behavior"), 
+            *GetOwner()->GetName());
+        
+        // Generate a curiosity intent
+        FARPG_AIIntent CuriosityIntent = GenerateCuriosityIntent();
+        if (ValidateIntent(CuriosityIntent))
         {
-            if (ShouldActivateCuriosity())
-            {
-                UE_LOG(LogARPG, VeryVerbose, TEXT("%s activating curiosity behavior"), 
-                    *GetOwner()->GetName());
-                
-                // Generate a curiosity intent
-                FARPG_AIIntent CuriosityIntent = GenerateCuriosityIntent();
-                if (ValidateIntent(CuriosityIntent))
-                {
-                    CurrentBrainState.CurrentIntent = CuriosityIntent;
-                    OnIntentChanged.Broadcast(CuriosityIntent);
-                    SetBrainState(EARPG_BrainState::Executing);
-                }
-            }
-            
-            // Restart timer for next check
-            StartCuriosityTimer();
-        },
-        CuriosityCheckInterval,
-        false);
+            CurrentBrainState.CurrentIntent = CuriosityIntent;
+            OnIntentChanged.Broadcast(CuriosityIntent);
+            SetBrainState(EARPG_BrainState::Executing);
+        }
+    }
+    
+    // Restart timer for next check
+    StartCuriosityTimer();
 }
 
 void UARPG_AIBrainComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (bFollowingRoutine)
+    {
+        if (UARPG_RoutineManager* RoutineManager = GetRoutineManager())
+        {
+            RoutineManager->UnregisterFollower(this, RoutineArchetype);
+        }
+        bFollowingRoutine = false;
+    }
+
+    if (URadiantTimerManager* RadiantTimers = GetWorld()->GetSubsystem<URadiantTimerManager>())
+    {
+        RadiantTimers->ClearTimer(CuriosityTimerHandle);
+    }
+
     UnregisterFromEventManager();
     SetBrainState(EARPG_BrainState::Inactive);
     Super::EndPlay(EndPlayReason);
@@ -165,8 +189,16 @@ void UARPG_AIBrainComponent::ProcessStimulus(const FARPG_AIStimulus& Stimulus)
     LastStimulusTime = GetWorld()->GetTimeSeconds();
     CurrentBrainState.TimeSinceLastStimulus = 0.0f;
     
+    if (IsFollowingRoutine())
+    {
+        // Minor stimuli stay buffered for the next full evaluation
+        if (Stimulus.Intensity >= RoutineInterruptThreshold)
+        {
+            InterruptRoutine();
+        }
+    }
     // If this is a high-intensity stimulus, force immediate processing
-    if (Stimulus.Intensity >= 0.8f)
+    else if (Stimulus.Intensity >= 0.8f)
     {
         ForceIntentGeneration();
     }
@@ -241,6 +273,13 @@ void UARPG_AIBrainComponent::UpdateBrain(float DeltaTime)
     TimeSinceLastUpdate += DeltaTime;
     CurrentBrainState.TimeSinceLastStimulus = GetWorld()->GetTimeSeconds() - LastStimulusTime;
     
+    // Interruption has settled - hand control back to the routine
+    if (bFollowingRoutine && bRoutineInterrupted && CurrentBrainState.TimeSinceLastStimulus > RoutineResumeDelay)
+    {
+        ResumeRoutine();
+        return;
+    }
+    
     // Update stimuli memory
     UpdateStimuliMemory(DeltaTime);
     
@@ -291,6 +330,11 @@ void UARPG_AIBrainComponent::SetBrainEnabled(bool bEnabled)
         if (bEnabled)
         {
             SetBrainState(EARPG_BrainState::Processing);
+            
+            if (IsFollowingRoutine())
+            {
+                ResumeRoutine();
+            }
         }
         else
         {
@@ -664,6 +708,103 @@ void UARPG_AIBrainComponent::OnAIEventReceived(const FARPG_AIEvent& AIEvent)
     ProcessStimulus(EventStimulus);
 }
 
+// === Daily Routine ===
+
+void UARPG_AIBrainComponent::StartRoutine(EARPG_NPCArchetype Archetype)
+{
+    UARPG_RoutineManager* RoutineManager = GetRoutineManager();
+    if (!RoutineManager)
+    {
+        return;
+    }
+
+    if (bFollowingRoutine)
+    {
+        RoutineManager->UnregisterFollower(this, RoutineArchetype);
+    }
+
+    bFollowingRoutine = true;
+    RoutineArchetype = Archetype;
+    RoutineManager->RegisterFollower(this, Archetype);
+
+    ResumeRoutine();
+}
+
+void UARPG_AIBrainComponent::StopRoutine()
+{
+    if (!bFollowingRoutine)
+    {
+        return;
+    }
+
+    if (UARPG_RoutineManager* RoutineManager = GetRoutineManager())
+    {
+        RoutineManager->UnregisterFollower(this, RoutineArchetype);
+    }
+
+    bFollowingRoutine = false;
+    bRoutineInterrupted = false;
+    SetComponentTickEnabled(true);
+}
+
+void UARPG_AIBrainComponent::ApplyRoutineIntent(const FGameplayTag& Activity)
+{
+    if (!IsFollowingRoutine() || !CurrentBrainState.bIsEnabled || !Activity.IsValid())
+    {
+        return;
+    }
+
+    if (CurrentBrainState.CurrentIntent.IntentTag == Activity)
+    {
+        return;
+    }
+
+    FARPG_AIIntent RoutineIntent;
+    RoutineIntent.IntentTag = Activity;
+    RoutineIntent.Priority = EARPG_AIIntentPriority::Low;
+    RoutineIntent.Confidence = 1.0f;
+    RoutineIntent.CreationTime = GetWorld()->GetTimeSeconds();
+
+    CurrentBrainState.CurrentIntent = RoutineIntent;
+    OnIntentChanged.Broadcast(RoutineIntent);
+    SetBrainState(EARPG_BrainState::Executing);
+
+    if (BrainConfig.bEnableDebugLogging)
+    {
+        UE_LOG(LogARPG, Log, TEXT("%s following routine: %s"), *GetOwner()->GetName(), *Activity.ToString());
+    }
+}
+
+void UARPG_AIBrainComponent::InterruptRoutine()
+{
+    bRoutineInterrupted = true;
+    SetComponentTickEnabled(true);
+
+    ForceIntentGeneration();
+}
+
+void UARPG_AIBrainComponent::ResumeRoutine()
+{
+    bRoutineInterrupted = false;
+    SetComponentTickEnabled(false);
+    
+    if (URadiantTimerManager* RadiantTimers = GetWorld()->GetSubsystem<URadiantTimerManager>())
+    {
+        RadiantTimers->ClearTimer(CuriosityTimerHandle);
+    }
+
+    if (UARPG_RoutineManager* RoutineManager = GetRoutineManager())
+    {
+        ApplyRoutineIntent(RoutineManager->GetCurrentActivity(RoutineArchetype));
+    }
+}
+
+UARPG_RoutineManager* UARPG_AIBrainComponent::GetRoutineManager() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UARPG_RoutineManager>() : nullptr;
+}
+
 FARPG_AIIntent UARPG_AIBrainComponent::GetCurrentIntent() const
 {
     return CurrentBrainState.CurrentIntent;
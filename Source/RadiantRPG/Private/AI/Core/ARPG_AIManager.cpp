@@ -4,6 +4,11 @@
 #include "AI/Core/ARPG_AIEventManager.h"
 #include "AI/Core/ARPG_AIBrainComponent.h"
 #include "Characters/ARPG_BaseNPCCharacter.h"
+#include "Core/RadiantGameplayTags.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Core/RadiantReplicationGraph.h"
 
 // Constructor
 UARPG_AIManager::UARPG_AIManager()
@@ -36,6 +41,7 @@ bool UARPG_AIManager::ShouldCreateSubsystem(UObject* Outer) const
 void UARPG_AIManager::OnWorldBeginPlay(UWorld& InWorld)
 {
     StartUpdateTimer();
+    StartSignificanceTimer();
 }
 
 void UARPG_AIManager::OnSystemInitialized()
@@ -56,6 +62,14 @@ void UARPG_AIManager::OnSystemShutdown()
     RegisteredAIs.Empty();
     RegisteredNPCs.Empty();
     RegisteredBrains.Empty();
+    NPCSignificance.Empty();
+    NearbyNPCs.Empty();
+    HighPriorityNPCs.Empty();
+
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
+    {
+        RadiantTimers->ClearTimer(SignificanceTimerHandle);
+    }
 }
 
 // AI Registration
@@ -96,12 +110,19 @@ void UARPG_AIManager::RegisterNPC(AARPG_BaseNPCCharacter* NPC)
     if (NPC && !RegisteredNPCs.Contains(NPC))
     {
         RegisteredNPCs.Add(NPC);
+
+        FARPG_NPCSignificance& State = NPCSignificance.Add(NPC);
+        State.LastLocation = NPC->GetActorLocation();
+        State.LastChangeTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
     }
 }
 
 void UARPG_AIManager::UnregisterNPC(AARPG_BaseNPCCharacter* NPC)
 {
     RegisteredNPCs.Remove(NPC);
+    NPCSignificance.Remove(NPC);
+    NearbyNPCs.Remove(NPC);
+    HighPriorityNPCs.Remove(NPC);
 }
 
 TArray<AARPG_BaseNPCCharacter*> UARPG_AIManager::GetAllNPCs() const
@@ -242,6 +263,14 @@ void UARPG_AIManager::BroadcastStimulus(const FARPG_AIStimulus& Stimulus, FVecto
 // Configuration
 void UARPG_AIManager::UpdateConfiguration(const FARPG_AIManagerConfig& NewConfig)
 {
+    const bool bSignificanceRateChanged = !FMath::IsNearlyEqual(Configuration.SignificanceUpdateInterval, NewConfig.SignificanceUpdateInterval);
+    Configuration = NewConfig;
+
+    if (bSignificanceRateChanged)
+    {
+        StartSignificanceTimer();
+    }
+
     // Update configuration settings
     SetGlobalUpdateRate(NewConfig.GlobalUpdateRate);
     MaxActiveNPCs = NewConfig.MaxActiveNPCs;
@@ -317,6 +346,9 @@ void UARPG_AIManager::CleanupInvalidReferences()
     {
         if (!IsValid(RegisteredNPCs[i]))
         {
+            NPCSignificance.Remove(RegisteredNPCs[i]);
+            NearbyNPCs.Remove(RegisteredNPCs[i]);
+            HighPriorityNPCs.Remove(RegisteredNPCs[i]);
             RegisteredNPCs.RemoveAtSwap(i);
         }
     }
@@ -605,4 +637,180 @@ void UARPG_AIManager::EnableDebugVisualization(bool bEnabled)
 bool UARPG_AIManager::IsDebugVisualizationEnabled() const
 {
     return IsAIDebugEnabled();
-}
\ No newline at end of file
+}
+
+// === Significance ===
+
+FARPG_NPCSignificance UARPG_AIManager::GetNPCSignificance(AARPG_BaseNPCCharacter* NPC) const
+{
+    const FARPG_NPCSignificance* State = NPCSignificance.Find(NPC);
+    return State ? *State : FARPG_NPCSignificance();
+}
+
+void UARPG_AIManager::StartSignificanceTimer()
+{
+    UWorld* World = GetWorld();
+    URadiantTimerManager* RadiantTimers = World ? World->GetSubsystem<URadiantTimerManager>() : nullptr;
+    if (!RadiantTimers)
+    {
+        return;
+    }
+
+    RadiantTimers->ClearTimer(SignificanceTimerHandle);
+
+    if (World->HasBegunPlay())
+    {
+        SignificanceTimerHandle = RadiantTimers->SetTimer(this, &UARPG_AIManager::UpdateNPCSignificance,
+            Configuration.SignificanceUpdateInterval, true);
+    }
+}
+
+void UARPG_AIManager::UpdateNPCSignificance()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    struct FViewer
+    {
+        FVector Location;
+        FVector Direction;
+    };
+
+    // Every local and remote player's view this pass
+    TArray<FViewer, TInlineAllocator<64>> Viewers;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (!PlayerController)
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        Viewers.Add({ ViewLocation, ViewRotation.Vector() });
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+    const float MaxDistance = Configuration.SignificanceMaxDistance;
+    const float ViewConeCos = FMath::Cos(FMath::DegreesToRadians(Configuration.ViewConeHalfAngle));
+    const bool bApplyNet = World->GetNetMode() != NM_Client && World->GetNetMode() != NM_Standalone;
+
+    NearbyNPCs.Reset();
+    HighPriorityNPCs.Reset();
+
+    for (AARPG_BaseNPCCharacter* NPC : RegisteredNPCs)
+    {
+        if (!IsValid(NPC))
+        {
+            continue;
+        }
+
+        FARPG_NPCSignificance& State = NPCSignificance.FindOrAdd(NPC);
+        const FVector NPCLocation = NPC->GetActorLocation();
+
+        State.bInCombat = NPC->GetCharacterState() == ECharacterState::InCombat
+            || NPC->GetCurrentBehavior().MatchesTag(TAG_Behavior_Combat);
+        State.bVisible = false;
+        State.NearestViewerDistance = MAX_flt;
+
+        // Most significant view wins - an NPC in front of one player matters even if the rest are far away
+        float Significance = 0.0f;
+        for (const FViewer& Viewer : Viewers)
+        {
+            const FVector ToNPC = NPCLocation - Viewer.Location;
+            const float Distance = ToNPC.Size();
+            State.NearestViewerDistance = FMath::Min(State.NearestViewerDistance, Distance);
+
+            if (Distance >= MaxDistance)
+            {
+                continue;
+            }
+
+            float ViewSignificance = 1.0f - Distance / MaxDistance;
+            if ((ToNPC.GetSafeNormal() | Viewer.Direction) >= ViewConeCos)
+            {
+                State.bVisible = true;
+            }
+            else
+            {
+                ViewSignificance *= Configuration.OffscreenSignificanceScale;
+            }
+
+            Significance = FMath::Max(Significance, ViewSignificance);
+        }
+
+        if (State.bInCombat && Significance > 0.0f)
+        {
+            Significance += Configuration.CombatSignificanceBonus;
+        }
+
+        State.Significance = FMath::Clamp(Significance, 0.0f, 1.0f);
+
+        if (State.NearestViewerDistance <= Configuration.LODDistance)
+        {
+            NearbyNPCs.Add(NPC);
+        }
+
+        if (State.bInCombat || State.Significance >= 0.75f)
+        {
+            HighPriorityNPCs.Add(NPC);
+        }
+
+        if (bApplyNet)
+        {
+            ApplyNetSignificance(NPC, State, CurrentTime);
+        }
+    }
+}
+
+void UARPG_AIManager::ApplyNetSignificance(AARPG_BaseNPCCharacter* NPC, FARPG_NPCSignificance& State, float CurrentTime)
+{
+    // Anything replicated that moved or changed resets the idle clock
+    const FVector Location = NPC->GetActorLocation();
+    const bool bChanged = State.bInCombat
+        || FVector::DistSquared(Location, State.LastLocation) > FMath::Square(Configuration.DormancyMoveTolerance)
+        || NPC->GetCurrentBehavior() != State.LastBehavior
+        || NPC->GetCharacterState() != State.LastState;
+
+    State.LastLocation = Location;
+    State.LastBehavior = NPC->GetCurrentBehavior();
+    State.LastState = NPC->GetCharacterState();
+
+    if (bChanged)
+    {
+        State.LastChangeTime = CurrentTime;
+    }
+
+    const bool bShouldSleep = Configuration.DormancyDelay > 0.0f && CurrentTime - State.LastChangeTime >= Configuration.DormancyDelay;
+    if (bShouldSleep != State.bNetDormant)
+    {
+        NPC->SetNetDormancy(bShouldSleep ? DORM_DormantAll : DORM_Awake);
+        State.bNetDormant = bShouldSleep;
+    }
+
+    if (State.bNetDormant)
+    {
+        return;
+    }
+
+    const float Frequency = FMath::Lerp(Configuration.MinNetUpdateFrequency, Configuration.MaxNetUpdateFrequency, State.Significance);
+    if (!FMath::IsNearlyEqual(NPC->GetNetUpdateFrequency(), Frequency, 0.5f))
+    {
+        NPC->SetNetUpdateFrequency(Frequency);
+        NPC->SetMinNetUpdateFrequency(FMath::Min(Configuration.MinNetUpdateFrequency, Frequency));
+
+        // The replication graph keeps its own copy of the rate
+        UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+        if (URadiantReplicationGraph* Graph = NetDriver ? NetDriver->GetReplicationDriver<URadiantReplicationGraph>() : nullptr)
+        {
+            Graph->SetActorNetUpdateFrequency(NPC, Frequency);
+        }
+    }
+
+    NPC->NetPriority = FMath::Lerp(Configuration.MinNetPriority, Configuration.MaxNetPriority, State.Significance);
+}
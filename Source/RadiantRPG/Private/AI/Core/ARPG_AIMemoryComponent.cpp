@@ -1356,6 +1356,18 @@ void UARPG_AIMemoryComponent::ClearAllMemories()
     }
 }
 
+void UARPG_AIMemoryComponent::ResetMemory()
+{
+    for (auto& TypePair : ShortTermMemories)
+    {
+        TypePair.Value.Reset();
+    }
+    for (auto& TypePair : LongTermMemories)
+    {
+        TypePair.Value.Reset();
+    }
+}
+
 int32 UARPG_AIMemoryComponent::GetMemoryCount(EARPG_MemoryType MemoryType) const
 {
     if (MemoryType == EARPG_MemoryType::MAX)
@@ -0,0 +1,680 @@
+// Private/AI/Core/ARPG_CrowdManager.cpp
+
+#include "AI/Core/ARPG_CrowdManager.h"
+#include "AI/Core/ARPG_RoutineManager.h"
+#include "AI/Core/ARPG_AIBrainComponent.h"
+#include "AI/Core/ARPG_AINeedsComponent.h"
+#include "AI/Components/ARPG_RelationshipComponent.h"
+#include "Characters/ARPG_BaseNPCCharacter.h"
+#include "World/RadiantZoneManager.h"
+#include "GameFramework/PlayerController.h"
+#include "RadiantRPG.h"
+#include "Engine/World.h"
+
+void UARPG_CrowdManager::Deinitialize()
+{
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
+    {
+        RadiantTimers->ClearTimer(PromotionTimerHandle);
+        RadiantTimers->ClearTimer(SimulationTimerHandle);
+    }
+
+    Slots.Empty();
+    FreeSlots.Empty();
+    Zones.Empty();
+    Pool.Empty();
+    NumProxies = 0;
+    NumPromoted = 0;
+
+    Super::Deinitialize();
+}
+
+void UARPG_CrowdManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    LastSimulationTime = InWorld.GetTimeSeconds();
+    RestartTimers();
+}
+
+bool UARPG_CrowdManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UARPG_CrowdManager::ConfigureCrowd(const FARPG_CrowdConfig& Config)
+{
+    CrowdConfig = Config;
+    CrowdConfig.DemoteDistance = FMath::Max(CrowdConfig.DemoteDistance, CrowdConfig.PromoteDistance);
+
+    RestartTimers();
+}
+
+void UARPG_CrowdManager::RestartTimers()
+{
+    UWorld* World = GetWorld();
+    URadiantTimerManager* RadiantTimers = World ? World->GetSubsystem<URadiantTimerManager>() : nullptr;
+    if (!RadiantTimers)
+    {
+        return;
+    }
+
+    RadiantTimers->ClearTimer(PromotionTimerHandle);
+    RadiantTimers->ClearTimer(SimulationTimerHandle);
+
+    // Clients only ever see promoted actors
+    if (World->HasBegunPlay() && World->GetNetMode() != NM_Client)
+    {
+        PromotionTimerHandle = RadiantTimers->SetTimer(this, &UARPG_CrowdManager::UpdatePromotion, CrowdConfig.PromotionInterval, true);
+        SimulationTimerHandle = RadiantTimers->SetTimer(this, &UARPG_CrowdManager::SimulateProxies, CrowdConfig.SimulationInterval, true);
+    }
+}
+
+// Proxies
+FARPG_CrowdProxyHandle UARPG_CrowdManager::AddProxy(const FARPG_CrowdProxy& Proxy)
+{
+    if (!Proxy.NPCClass)
+    {
+        UE_LOG(LogARPG, Warning, TEXT("CrowdManager: proxy has no NPC class"));
+        return FARPG_CrowdProxyHandle();
+    }
+
+    const int32 Index = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+    FProxySlot& Slot = Slots[Index];
+    Slot.Proxy = Proxy;
+    Slot.Actor.Reset();
+    Slot.HeldRelationships.Reset();
+    Slot.bInUse = true;
+
+    ++NumProxies;
+    AddToZone(Slot);
+
+    return MakeHandle(Index);
+}
+
+void UARPG_CrowdManager::RemoveProxy(FARPG_CrowdProxyHandle& Handle)
+{
+    if (FProxySlot* Slot = FindSlot(Handle))
+    {
+        RemoveFromZone(*Slot);
+        Slot->bInUse = false;
+
+        // Invalidates every outstanding handle to this slot
+        ++Slot->Serial;
+
+        if (AARPG_BaseNPCCharacter* NPC = Slot->Actor.Get())
+        {
+            // The handle is stale now, so the others just forget this NPC
+            DetachRelationships(Handle, NPC);
+            ReleaseNPC(NPC);
+            --NumPromoted;
+        }
+
+        Slot->Actor.Reset();
+        Slot->HeldRelationships.Reset();
+
+        FreeSlots.Add(Handle.Index);
+        --NumProxies;
+    }
+
+    Handle.Invalidate();
+}
+
+FARPG_CrowdProxyHandle UARPG_CrowdManager::DemoteNPC(AARPG_BaseNPCCharacter* NPC)
+{
+    return IsValid(NPC) ? DemoteNPCAt(NPC, NPC->GetActorLocation()) : FARPG_CrowdProxyHandle();
+}
+
+FARPG_CrowdProxyHandle UARPG_CrowdManager::DemoteNPCAt(AARPG_BaseNPCCharacter* NPC, const FVector& ProxyLocation)
+{
+    if (!IsValid(NPC) || NPC->IsCrowdPooled())
+    {
+        return FARPG_CrowdProxyHandle();
+    }
+
+    // Already standing in for a proxy
+    if (FProxySlot* Slot = FindSlot(NPC->GetCrowdHandle()))
+    {
+        const FARPG_CrowdProxyHandle Handle = NPC->GetCrowdHandle();
+        Demote(*Slot, &ProxyLocation);
+        return Handle;
+    }
+
+    FARPG_CrowdProxy Proxy;
+    Proxy.NPCClass = NPC->GetClass();
+    CaptureNPC(NPC, {}, Proxy);
+    Proxy.Location = ProxyLocation;
+
+    const FARPG_CrowdProxyHandle Handle = AddProxy(Proxy);
+    DetachRelationships(Handle, NPC);
+    ReleaseNPC(NPC);
+    return Handle;
+}
+
+bool UARPG_CrowdManager::GetProxy(const FARPG_CrowdProxyHandle& Handle, FARPG_CrowdProxy& OutProxy) const
+{
+    const FProxySlot* Slot = FindSlot(Handle);
+    if (!Slot)
+    {
+        return false;
+    }
+
+    OutProxy = Slot->Proxy;
+
+    // A promoted proxy's live state is on the actor
+    if (const AARPG_BaseNPCCharacter* NPC = Slot->Actor.Get())
+    {
+        CaptureNPC(NPC, Slot->HeldRelationships, OutProxy);
+    }
+
+    return true;
+}
+
+AARPG_BaseNPCCharacter* UARPG_CrowdManager::GetPromotedNPC(const FARPG_CrowdProxyHandle& Handle) const
+{
+    const FProxySlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->Actor.Get() : nullptr;
+}
+
+// Zones
+void UARPG_CrowdManager::RegisterZone(ARadiantZoneManager* Zone)
+{
+    if (!Zone)
+    {
+        return;
+    }
+
+    int32 ZoneIndex = Zones.IndexOfByPredicate([Zone](const FCrowdZone& Entry) { return Entry.Zone == Zone; });
+    if (ZoneIndex == INDEX_NONE)
+    {
+        ZoneIndex = Zones.IndexOfByPredicate([](const FCrowdZone& Entry) { return !Entry.Zone.IsValid(); });
+        if (ZoneIndex == INDEX_NONE)
+        {
+            ZoneIndex = Zones.AddDefaulted();
+        }
+
+        Zones[ZoneIndex].Zone = Zone;
+        Zones[ZoneIndex].NumProxies = 0;
+    }
+
+    // Proxies added before the zone loaded
+    for (FProxySlot& Slot : Slots)
+    {
+        if (Slot.bInUse && Slot.ZoneIndex == INDEX_NONE && !Slot.Actor.IsValid() && Zone->IsLocationInZone(Slot.Proxy.Location))
+        {
+            Slot.ZoneIndex = ZoneIndex;
+            ++Zones[ZoneIndex].NumProxies;
+        }
+    }
+
+    Zone->SetCrowdResidents(Zones[ZoneIndex].NumProxies);
+}
+
+void UARPG_CrowdManager::UnregisterZone(ARadiantZoneManager* Zone)
+{
+    const int32 ZoneIndex = Zones.IndexOfByPredicate([Zone](const FCrowdZone& Entry) { return Entry.Zone == Zone; });
+    if (ZoneIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    for (FProxySlot& Slot : Slots)
+    {
+        if (Slot.ZoneIndex == ZoneIndex)
+        {
+            Slot.ZoneIndex = INDEX_NONE;
+        }
+    }
+
+    Zones[ZoneIndex] = FCrowdZone();
+}
+
+void UARPG_CrowdManager::AddToZone(FProxySlot& Slot)
+{
+    Slot.ZoneIndex = FindZoneIndexAt(Slot.Proxy.Location);
+    if (Slot.ZoneIndex != INDEX_NONE)
+    {
+        FCrowdZone& Entry = Zones[Slot.ZoneIndex];
+        Entry.Zone->SetCrowdResidents(++Entry.NumProxies);
+    }
+}
+
+void UARPG_CrowdManager::RemoveFromZone(FProxySlot& Slot)
+{
+    if (Slot.ZoneIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FCrowdZone& Entry = Zones[Slot.ZoneIndex];
+    Entry.NumProxies = FMath::Max(Entry.NumProxies - 1, 0);
+    if (ARadiantZoneManager* Zone = Entry.Zone.Get())
+    {
+        Zone->SetCrowdResidents(Entry.NumProxies);
+    }
+
+    Slot.ZoneIndex = INDEX_NONE;
+}
+
+int32 UARPG_CrowdManager::FindZoneIndexAt(const FVector& Location) const
+{
+    for (int32 Index = 0; Index < Zones.Num(); ++Index)
+    {
+        const ARadiantZoneManager* Zone = Zones[Index].Zone.Get();
+        if (Zone && Zone->IsLocationInZone(Location))
+        {
+            return Index;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+// Promotion
+void UARPG_CrowdManager::UpdatePromotion()
+{
+    UWorld* World = GetWorld();
+    if (!World || NumProxies == 0)
+    {
+        return;
+    }
+
+    TArray<FVector, TInlineAllocator<64>> ViewLocations;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APlayerController* PlayerController = It->Get())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            ViewLocations.Add(ViewLocation);
+        }
+    }
+
+    const float PromoteDistSq = FMath::Square(CrowdConfig.PromoteDistance);
+    const float DemoteDistSq = FMath::Square(CrowdConfig.DemoteDistance);
+    int32 PromotionBudget = CrowdConfig.MaxPromotionsPerUpdate;
+
+    for (FProxySlot& Slot : Slots)
+    {
+        if (!Slot.bInUse)
+        {
+            continue;
+        }
+
+        AARPG_BaseNPCCharacter* NPC = Slot.Actor.Get();
+        if (Slot.Actor.IsStale())
+        {
+            // Actor destroyed out from under us - fall back to the last proxy state
+            Slot.Actor.Reset();
+            Slot.HeldRelationships.Reset();
+            --NumPromoted;
+            AddToZone(Slot);
+        }
+
+        const FVector Location = NPC ? NPC->GetActorLocation() : Slot.Proxy.Location;
+
+        float NearestDistSq = MAX_flt;
+        for (const FVector& ViewLocation : ViewLocations)
+        {
+            NearestDistSq = FMath::Min(NearestDistSq, (float)FVector::DistSquared(Location, ViewLocation));
+        }
+
+        if (NPC)
+        {
+            if (NearestDistSq > DemoteDistSq)
+            {
+                Demote(Slot);
+            }
+        }
+        else if (NearestDistSq < PromoteDistSq && PromotionBudget > 0)
+        {
+            Promote(Slot);
+            --PromotionBudget;
+        }
+    }
+}
+
+void UARPG_CrowdManager::Promote(FProxySlot& Slot)
+{
+    const FARPG_CrowdProxy& Proxy = Slot.Proxy;
+
+    AARPG_BaseNPCCharacter* NPC = AcquireNPC(Proxy.NPCClass, Proxy.Location, FRotator(0.0f, Proxy.Yaw, 0.0f));
+    if (!NPC)
+    {
+        return;
+    }
+
+    const FARPG_CrowdProxyHandle Handle = MakeHandle(UE_PTRDIFF_TO_INT32(&Slot - Slots.GetData()));
+    NPC->SetCrowdHandle(Handle);
+
+    Slot.Actor = NPC;
+    ++NumPromoted;
+    RemoveFromZone(Slot);
+
+    ApplyProxy(Slot, NPC);
+    AttachRelationships(Handle, NPC);
+}
+
+void UARPG_CrowdManager::Demote(FProxySlot& Slot, const FVector* ProxyLocation)
+{
+    AARPG_BaseNPCCharacter* NPC = Slot.Actor.Get();
+    if (!NPC)
+    {
+        return;
+    }
+
+    CaptureNPC(NPC, Slot.HeldRelationships, Slot.Proxy);
+    if (ProxyLocation)
+    {
+        Slot.Proxy.Location = *ProxyLocation;
+    }
+
+    DetachRelationships(NPC->GetCrowdHandle(), NPC);
+    ReleaseNPC(NPC);
+
+    Slot.Actor.Reset();
+    Slot.HeldRelationships.Reset();
+    --NumPromoted;
+    AddToZone(Slot);
+}
+
+// Simulation
+void UARPG_CrowdManager::SimulateProxies()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+    const float DeltaTime = CurrentTime - LastSimulationTime;
+    LastSimulationTime = CurrentTime;
+
+    // One routine lookup per archetype, not per proxy
+    FGameplayTag Activities[(int32)EARPG_NPCArchetype::MAX];
+    if (const UARPG_RoutineManager* RoutineManager = World->GetSubsystem<UARPG_RoutineManager>())
+    {
+        for (int32 Index = 0; Index < (int32)EARPG_NPCArchetype::MAX; ++Index)
+        {
+            Activities[Index] = RoutineManager->GetCurrentActivity((EARPG_NPCArchetype)Index);
+        }
+    }
+
+    const int32 NeedGrowth = FMath::RoundToInt(CrowdConfig.NeedGrowthRate * DeltaTime * MAX_uint16);
+
+    for (FProxySlot& Slot : Slots)
+    {
+        // Promoted proxies are simulated by their actor
+        if (!Slot.bInUse || Slot.Actor.IsValid())
+        {
+            continue;
+        }
+
+        FARPG_CrowdProxy& Proxy = Slot.Proxy;
+
+        for (uint16& Level : Proxy.NeedLevels)
+        {
+            Level = (uint16)FMath::Min((int32)Level + NeedGrowth, (int32)MAX_uint16);
+        }
+
+        if (Proxy.bFollowDailyRoutine)
+        {
+            Proxy.CurrentActivity = Activities[(int32)Proxy.Archetype];
+        }
+    }
+}
+
+// State transfer
+void UARPG_CrowdManager::CaptureNPC(const AARPG_BaseNPCCharacter* NPC, TConstArrayView<FARPG_CrowdRelationship> HeldRelationships, FARPG_CrowdProxy& OutProxy)
+{
+    OutProxy.Location = NPC->GetActorLocation();
+    OutProxy.Yaw = NPC->GetActorRotation().Yaw;
+    OutProxy.Faction = NPC->GetFaction();
+    OutProxy.Archetype = NPC->GetArchetype();
+    OutProxy.bFollowDailyRoutine = NPC->IsFollowingDailyRoutine();
+
+    if (const UARPG_AIBrainComponent* Brain = NPC->GetBrainComponent())
+    {
+        OutProxy.CurrentActivity = Brain->GetCurrentIntent().IntentTag;
+    }
+
+    if (const UARPG_AINeedsComponent* Needs = NPC->GetNeedsComponent())
+    {
+        for (int32 Index = 0; Index < FARPG_CrowdProxy::NumNeeds; ++Index)
+        {
+            OutProxy.SetNeedLevel((EARPG_NeedType)Index, Needs->GetNeedLevel((EARPG_NeedType)Index));
+        }
+    }
+
+    TArray<FARPG_CrowdRelationship, TInlineAllocator<16>> Candidates;
+    Candidates.Append(HeldRelationships.GetData(), HeldRelationships.Num());
+
+    if (const UARPG_RelationshipComponent* Relationships = NPC->FindComponentByClass<UARPG_RelationshipComponent>())
+    {
+        for (const FARPG_RelationshipEntry& Entry : Relationships->GetRelationships())
+        {
+            AActor* Target = Entry.TargetActor.Get();
+            if (!Target)
+            {
+                continue;
+            }
+
+            FARPG_CrowdRelationship& Relationship = Candidates.AddDefaulted_GetRef();
+            Relationship.Value = Entry.RelationshipValue;
+
+            // Crowd actors are reused - key them by the proxy they stand in for
+            const AARPG_BaseNPCCharacter* TargetNPC = Cast<AARPG_BaseNPCCharacter>(Target);
+            if (TargetNPC && TargetNPC->GetCrowdHandle().IsValid())
+            {
+                Relationship.TargetProxy = TargetNPC->GetCrowdHandle();
+            }
+            else if (!TargetNPC || !TargetNPC->IsCrowdPooled())
+            {
+                Relationship.TargetActor = Target;
+            }
+            else
+            {
+                Candidates.Pop(EAllowShrinking::No);
+            }
+        }
+    }
+
+    // Keep only the strongest feelings, either way
+    Candidates.Sort([](const FARPG_CrowdRelationship& A, const FARPG_CrowdRelationship& B)
+    {
+        return FMath::Abs(A.Value) > FMath::Abs(B.Value);
+    });
+
+    for (int32 Index = 0; Index < FARPG_CrowdProxy::MaxKeyRelationships; ++Index)
+    {
+        OutProxy.KeyRelationships[Index] = Candidates.IsValidIndex(Index) ? Candidates[Index] : FARPG_CrowdRelationship();
+    }
+}
+
+void UARPG_CrowdManager::ApplyProxy(FProxySlot& Slot, AARPG_BaseNPCCharacter* NPC)
+{
+    const FARPG_CrowdProxy& Proxy = Slot.Proxy;
+
+    NPC->SetFaction(Proxy.Faction);
+
+    if (UARPG_AINeedsComponent* Needs = NPC->GetNeedsComponent())
+    {
+        for (int32 Index = 0; Index < FARPG_CrowdProxy::NumNeeds; ++Index)
+        {
+            Needs->SetNeedLevel((EARPG_NeedType)Index, Proxy.GetNeedLevel((EARPG_NeedType)Index));
+        }
+    }
+
+    Slot.HeldRelationships.Reset();
+
+    UARPG_RelationshipComponent* Relationships = NPC->FindComponentByClass<UARPG_RelationshipComponent>();
+    for (const FARPG_CrowdRelationship& Relationship : Proxy.KeyRelationships)
+    {
+        AActor* Target = Relationship.TargetActor.Get();
+        if (Relationship.TargetProxy.IsValid())
+        {
+            const FProxySlot* TargetSlot = FindSlot(Relationship.TargetProxy);
+            if (!TargetSlot)
+            {
+                // Removed since - nobody left to feel anything about
+                continue;
+            }
+
+            Target = TargetSlot->Actor.Get();
+            if (!Target)
+            {
+                Slot.HeldRelationships.Add(Relationship);
+                continue;
+            }
+        }
+
+        if (Target && Relationships)
+        {
+            Relationships->SetRelationshipValue(Target, Relationship.Value);
+        }
+    }
+
+    // Routine last - it picks the activity for the current hour
+    NPC->SetDailyRoutine(Proxy.Archetype, Proxy.bFollowDailyRoutine);
+}
+
+void UARPG_CrowdManager::DetachRelationships(const FARPG_CrowdProxyHandle& Handle, AARPG_BaseNPCCharacter* NPC)
+{
+    // Only worth holding on to while the proxy still exists
+    const bool bKeep = FindSlot(Handle) != nullptr;
+
+    for (FProxySlot& Slot : Slots)
+    {
+        AARPG_BaseNPCCharacter* Other = Slot.Actor.Get();
+        if (!Slot.bInUse || !Other || Other == NPC)
+        {
+            continue;
+        }
+
+        UARPG_RelationshipComponent* Relationships = Other->FindComponentByClass<UARPG_RelationshipComponent>();
+        float Value = 0.0f;
+        if (Relationships && Relationships->RemoveRelationship(NPC, Value) && bKeep)
+        {
+            FARPG_CrowdRelationship& Relationship = Slot.HeldRelationships.AddDefaulted_GetRef();
+            Relationship.TargetProxy = Handle;
+            Relationship.Value = Value;
+        }
+    }
+}
+
+void UARPG_CrowdManager::AttachRelationships(const FARPG_CrowdProxyHandle& Handle, AARPG_BaseNPCCharacter* NPC)
+{
+    for (FProxySlot& Slot : Slots)
+    {
+        AARPG_BaseNPCCharacter* Other = Slot.Actor.Get();
+        if (!Slot.bInUse || !Other || Other == NPC)
+        {
+            continue;
+        }
+
+        UARPG_RelationshipComponent* Relationships = Other->FindComponentByClass<UARPG_RelationshipComponent>();
+        for (int32 Index = Slot.HeldRelationships.Num() - 1; Index >= 0; --Index)
+        {
+            if (Slot.HeldRelationships[Index].TargetProxy == Handle)
+            {
+                if (Relationships)
+                {
+                    Relationships->SetRelationshipValue(NPC, Slot.HeldRelationships[Index].Value);
+                }
+                Slot.HeldRelationships.RemoveAtSwap(Index);
+            }
+        }
+    }
+}
+
+// Pool
+AARPG_BaseNPCCharacter* UARPG_CrowdManager::AcquireNPC(UClass* NPCClass, const FVector& Location, const FRotator& Rotation)
+{
+    for (int32 Index = Pool.Num() - 1; Index >= 0; --Index)
+    {
+        AARPG_BaseNPCCharacter* Pooled = Pool[Index];
+        if (!IsValid(Pooled))
+        {
+            Pool.RemoveAtSwap(Index);
+            continue;
+        }
+
+        if (Pooled->GetClass() == NPCClass)
+        {
+            Pool.RemoveAtSwap(Index);
+            Pooled->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+            Pooled->SetCrowdPooled(false);
+            return Pooled;
+        }
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    AARPG_BaseNPCCharacter* NPC = GetWorld()->SpawnActor<AARPG_BaseNPCCharacter>(NPCClass, Location, Rotation, SpawnParams);
+    if (!NPC)
+    {
+        UE_LOG(LogARPG, Warning, TEXT("CrowdManager: failed to spawn %s"), *GetNameSafe(NPCClass));
+    }
+
+    return NPC;
+}
+
+void UARPG_CrowdManager::ReleaseNPC(AARPG_BaseNPCCharacter* NPC)
+{
+    NPC->SetCrowdHandle(FARPG_CrowdProxyHandle());
+
+    int32 NumOfClass = 0;
+    for (const AARPG_BaseNPCCharacter* Pooled : Pool)
+    {
+        if (Pooled && Pooled->GetClass() == NPC->GetClass())
+        {
+            ++NumOfClass;
+        }
+    }
+
+    if (NumOfClass >= CrowdConfig.MaxPooledPerClass)
+    {
+        NPC->Destroy();
+        return;
+    }
+
+    NPC->SetCrowdPooled(true);
+    Pool.Add(NPC);
+}
+
+FARPG_CrowdProxyHandle UARPG_CrowdManager::MakeHandle(int32 Index) const
+{
+    FARPG_CrowdProxyHandle Handle;
+    Handle.Index = Index;
+    Handle.Serial = Slots[Index].Serial;
+    return Handle;
+}
+
+UARPG_CrowdManager::FProxySlot* UARPG_CrowdManager::FindSlot(const FARPG_CrowdProxyHandle& Handle)
+{
+    return const_cast<FProxySlot*>(AsConst(*this).FindSlot(Handle));
+}
+
+const FARPG_CrowdProxyHandle UARPG_CrowdManager::MakeHandle(int32 Index) const
+{
+    FARPG_CrowdProxyHandle Handle;
+    Handle.Index = Index;
+    Handle.Serial = Slots[Index].Serial;
+    return Handle;
+}
+
+UARPG_CrowdManager::FProxySlot* UARPG_CrowdManager::FindSlot(const FARPG_CrowdProxyHandle& Handle) const
+{
+    if (!Slots.IsValidIndex(Handle.Index))
+    {
+        return nullptr;
+    }
+
+    const FProxySlot& Slot = Slots[Handle.Index];
+    return Slot.bInUse && Slot.Serial == Handle.Serial ? &Slot : nullptr;
+}
@@ -0,0 +1,344 @@
+// Private/AI/Core/ARPG_RoutineManager.cpp
+
+#include "AI/Core/ARPG_RoutineManager.h"
+#include "AI/Core/ARPG_AIBrainComponent.h"
+#include "Core/RadiantGameplayTags.h"
+#include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "World/RadiantWorldManager.h"
+#include "RadiantRPG.h"
+
+namespace RoutineDefaults
+{
+    static void AddBlock(FARPG_NPCRoutine& Routine, int32 StartHour, int32 EndHour, const FGameplayTag& Activity)
+    {
+        FARPG_RoutineEntry& Entry = Routine.Entries.AddDefaulted_GetRef();
+        Entry.StartHour = StartHour;
+        Entry.EndHour = EndHour;
+        Entry.ActivityIntent = Activity;
+    }
+}
+
+void UARPG_RoutineManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    BuildDefaultRoutines();
+
+    UE_LOG(LogARPG, Log, TEXT("RoutineManager initialized with %d archetype routines"), NumArchetypes);
+}
+
+void UARPG_RoutineManager::Deinitialize()
+{
+    if (URadiantWorldManager* WorldManager = GetWorldManager())
+    {
+        WorldManager->GetCalendar().Cancel(HourEventHandle);
+    }
+
+    for (TArray<TWeakObjectPtr<UARPG_AIBrainComponent>>& ArchetypeFollowers : Followers)
+    {
+        ArchetypeFollowers.Empty();
+    }
+
+    Super::Deinitialize();
+}
+
+void UARPG_RoutineManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    RestartHourSchedule();
+}
+
+bool UARPG_RoutineManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UARPG_RoutineManager::RestartHourSchedule()
+{
+    URadiantWorldManager* WorldManager = GetWorldManager();
+    if (!WorldManager)
+    {
+        return;
+    }
+
+    FGameCalendar& Calendar = WorldManager->GetCalendar();
+    Calendar.Cancel(HourEventHandle);
+
+    HourEventHandle = Calendar.ScheduleRecurring(ECalendarRecurrence::Hourly, 0,
+        FCalendarCallback::CreateUObject(this, &UARPG_RoutineManager::HandleHourBoundary));
+
+    LastHour = GetCurrentHour();
+}
+
+// Routines
+void UARPG_RoutineManager::LoadRoutineTable(UDataTable* RoutineTable)
+{
+    if (!RoutineTable)
+    {
+        return;
+    }
+
+    TArray<FARPG_NPCRoutine*> Rows;
+    RoutineTable->GetAllRows<FARPG_NPCRoutine>(TEXT("RoutineManager"), Rows);
+
+    for (const FARPG_NPCRoutine* Row : Rows)
+    {
+        if (Row)
+        {
+            SetRoutine(*Row);
+        }
+    }
+
+    UE_LOG(LogARPG, Log, TEXT("RoutineManager loaded %d routines from %s"), Rows.Num(), *RoutineTable->GetName());
+}
+
+void UARPG_RoutineManager::SetRoutine(const FARPG_NPCRoutine& Routine)
+{
+    const int32 ArchetypeIndex = (int32)Routine.Archetype;
+    if (ArchetypeIndex >= NumArchetypes)
+    {
+        return;
+    }
+
+    FARPG_CompiledRoutine& Compiled = Routines[ArchetypeIndex];
+    const FGameplayTag OldActivity = LastHour != INDEX_NONE ? Compiled.HourActivities[LastHour] : FGameplayTag();
+
+    CompileRoutine(Routine, Compiled);
+
+    // Followers switch immediately if the current block changed
+    if (LastHour != INDEX_NONE && Compiled.HourActivities[LastHour] != OldActivity)
+    {
+        NotifyFollowers(ArchetypeIndex, Compiled.HourActivities[LastHour]);
+    }
+}
+
+FGameplayTag UARPG_RoutineManager::GetRoutineActivity(EARPG_NPCArchetype Archetype, int32 Hour) const
+{
+    const int32 ArchetypeIndex = (int32)Archetype;
+    if (ArchetypeIndex >= NumArchetypes)
+    {
+        return TAG_AI_Intent_Idle;
+    }
+
+    return Routines[ArchetypeIndex].HourActivities[FMath::Clamp(Hour, 0, FARPG_CompiledRoutine::HoursPerDay - 1)];
+}
+
+FGameplayTag UARPG_RoutineManager::GetCurrentActivity(EARPG_NPCArchetype Archetype) const
+{
+    return GetRoutineActivity(Archetype, GetCurrentHour());
+}
+
+// Followers
+void UARPG_RoutineManager::RegisterFollower(UARPG_AIBrainComponent* Brain, EARPG_NPCArchetype Archetype)
+{
+    const int32 ArchetypeIndex = (int32)Archetype;
+    if (Brain && ArchetypeIndex < NumArchetypes)
+    {
+        Followers[ArchetypeIndex].AddUnique(Brain);
+    }
+}
+
+void UARPG_RoutineManager::UnregisterFollower(UARPG_AIBrainComponent* Brain, EARPG_NPCArchetype Archetype)
+{
+    const int32 ArchetypeIndex = (int32)Archetype;
+    if (ArchetypeIndex < NumArchetypes)
+    {
+        Followers[ArchetypeIndex].RemoveSwap(Brain);
+    }
+}
+
+int32 UARPG_RoutineManager::GetNumFollowers(EARPG_NPCArchetype Archetype) const
+{
+    const int32 ArchetypeIndex = (int32)Archetype;
+    return ArchetypeIndex < NumArchetypes ? Followers[ArchetypeIndex].Num() : 0;
+}
+
+// Transitions
+void UARPG_RoutineManager::HandleHourBoundary(const FSimpleWorldTime& Time, int32 Occurrences)
+{
+    const int32 Hour = FMath::Clamp(Time.Hour, 0, FARPG_CompiledRoutine::HoursPerDay - 1);
+
+    // A single step can use the compiled transition hours; a time skip compares against the hour we left
+    const bool bSingleStep = Occurrences == 1 && LastHour == (Hour + FARPG_CompiledRoutine::HoursPerDay - 1) % FARPG_CompiledRoutine::HoursPerDay;
+
+    for (int32 ArchetypeIndex = 0; ArchetypeIndex < NumArchetypes; ++ArchetypeIndex)
+    {
+        if (Followers[ArchetypeIndex].Num() == 0)
+        {
+            continue;
+        }
+
+        const FARPG_CompiledRoutine& Routine = Routines[ArchetypeIndex];
+        const bool bChanged = bSingleStep
+            ? Routine.IsTransitionHour(Hour)
+            : LastHour == INDEX_NONE || Routine.HourActivities[Hour] != Routine.HourActivities[LastHour];
+
+        if (bChanged)
+        {
+            NotifyFollowers(ArchetypeIndex, Routine.HourActivities[Hour]);
+        }
+    }
+
+    LastHour = Hour;
+}
+
+void UARPG_RoutineManager::NotifyFollowers(int32 ArchetypeIndex, const FGameplayTag& Activity)
+{
+    TArray<TWeakObjectPtr<UARPG_AIBrainComponent>>& ArchetypeFollowers = Followers[ArchetypeIndex];
+
+    for (int32 Index = ArchetypeFollowers.Num() - 1; Index >= 0; --Index)
+    {
+        if (UARPG_AIBrainComponent* Brain = ArchetypeFollowers[Index].Get())
+        {
+            Brain->ApplyRoutineIntent(Activity);
+        }
+        else
+        {
+            ArchetypeFollowers.RemoveAtSwap(Index);
+        }
+    }
+}
+
+// Compilation
+void UARPG_RoutineManager::CompileRoutine(const FARPG_NPCRoutine& Routine, FARPG_CompiledRoutine& OutRoutine)
+{
+    constexpr int32 HoursPerDay = FARPG_CompiledRoutine::HoursPerDay;
+
+    for (FGameplayTag& Activity : OutRoutine.HourActivities)
+    {
+        Activity = TAG_AI_Intent_Idle;
+    }
+
+    for (const FARPG_RoutineEntry& Entry : Routine.Entries)
+    {
+        if (!Entry.ActivityIntent.IsValid())
+        {
+            continue;
+        }
+
+        const int32 StartHour = FMath::Clamp(Entry.StartHour, 0, HoursPerDay - 1);
+        const int32 EndHour = FMath::Clamp(Entry.EndHour, 0, HoursPerDay);
+
+        int32 NumHours = EndHour - StartHour;
+        if (NumHours < 0)
+        {
+            NumHours += HoursPerDay;
+        }
+
+        for (int32 Offset = 0; Offset < NumHours; ++Offset)
+        {
+            OutRoutine.HourActivities[(StartHour + Offset) % HoursPerDay] = Entry.ActivityIntent;
+        }
+    }
+
+    OutRoutine.TransitionMask = 0;
+    for (int32 Hour = 0; Hour < HoursPerDay; ++Hour)
+    {
+        if (OutRoutine.HourActivities[Hour] != OutRoutine.HourActivities[(Hour + HoursPerDay - 1) % HoursPerDay])
+        {
+            OutRoutine.TransitionMask |= 1u << Hour;
+        }
+    }
+}
+
+void UARPG_RoutineManager::BuildDefaultRoutines()
+{
+    using namespace RoutineDefaults;
+
+    for (int32 ArchetypeIndex = 0; ArchetypeIndex < NumArchetypes; ++ArchetypeIndex)
+    {
+        FARPG_NPCRoutine Routine;
+        Routine.Archetype = (EARPG_NPCArchetype)ArchetypeIndex;
+
+        switch (Routine.Archetype)
+        {
+            case EARPG_NPCArchetype::Villager:
+            case EARPG_NPCArchetype::Crafter:
+                AddBlock(Routine, 22, 6, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 6, 7, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 7, 12, TAG_AI_Intent_Work);
+                AddBlock(Routine, 12, 13, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 13, 18, TAG_AI_Intent_Work);
+                AddBlock(Routine, 18, 20, TAG_AI_Intent_Social_Talk);
+                AddBlock(Routine, 20, 21, TAG_AI_Intent_Survival_Eat);
+                break;
+
+            case EARPG_NPCArchetype::Merchant:
+                AddBlock(Routine, 22, 6, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 6, 7, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 7, 12, TAG_AI_Intent_Social_Trade);
+                AddBlock(Routine, 12, 13, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 13, 19, TAG_AI_Intent_Social_Trade);
+                AddBlock(Routine, 19, 22, TAG_AI_Intent_Social_Talk);
+                break;
+
+            case EARPG_NPCArchetype::Guard:
+            case EARPG_NPCArchetype::Soldier:
+                AddBlock(Routine, 22, 5, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 5, 12, TAG_AI_Intent_Patrol);
+                AddBlock(Routine, 12, 13, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 13, 22, TAG_AI_Intent_Guard);
+                break;
+
+            case EARPG_NPCArchetype::Bandit:
+                AddBlock(Routine, 6, 14, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 14, 15, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 19, 6, TAG_AI_Intent_Patrol);
+                break;
+
+            case EARPG_NPCArchetype::Noble:
+                AddBlock(Routine, 0, 8, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 8, 9, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 9, 13, TAG_AI_Intent_Social_Talk);
+                AddBlock(Routine, 13, 14, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 18, 24, TAG_AI_Intent_Social_Talk);
+                break;
+
+            case EARPG_NPCArchetype::Mage:
+                AddBlock(Routine, 2, 10, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 10, 11, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 11, 19, TAG_AI_Intent_Work);
+                AddBlock(Routine, 19, 20, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 20, 2, TAG_AI_Intent_Work);
+                break;
+
+            case EARPG_NPCArchetype::Hunter:
+                AddBlock(Routine, 20, 4, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 4, 11, TAG_AI_Intent_Work);
+                AddBlock(Routine, 11, 12, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 12, 17, TAG_AI_Intent_Work);
+                AddBlock(Routine, 17, 18, TAG_AI_Intent_Survival_Eat);
+                break;
+
+            default:
+                AddBlock(Routine, 22, 6, TAG_AI_Intent_Survival_Sleep);
+                AddBlock(Routine, 6, 7, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 7, 12, TAG_AI_Intent_Wander);
+                AddBlock(Routine, 12, 13, TAG_AI_Intent_Survival_Eat);
+                AddBlock(Routine, 13, 19, TAG_AI_Intent_Wander);
+                AddBlock(Routine, 19, 20, TAG_AI_Intent_Survival_Eat);
+                break;
+        }
+
+        CompileRoutine(Routine, Routines[ArchetypeIndex]);
+    }
+}
+
+// Utilities
+URadiantWorldManager* UARPG_RoutineManager::GetWorldManager() const
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<URadiantWorldManager>() : nullptr;
+}
+
+int32 UARPG_RoutineManager::GetCurrentHour() const
+{
+    const URadiantWorldManager* WorldManager = GetWorldManager();
+    return WorldManager ? FMath::Clamp(WorldManager->GetCurrentHour(), 0, FARPG_CompiledRoutine::HoursPerDay - 1) : 0;
+}
@@ -4,6 +4,27 @@
 #include "Core/RadiantGameState.h"
 #include "Engine/World.h"
 #include "Core/RadiantGameplayTags.h"
+#include "Managers/FactionRegistry.h"
+#include "Engine/GameInstance.h"
+
+namespace
+{
+    /** Registry lookup for tag pairs - returns null if there is no registry or either faction is not registered */
+    const UFactionRegistry* FindRegistryFactions(const UObject* Context, const FGameplayTag& FactionA, const FGameplayTag& FactionB, int32& OutA, int32& OutB)
+    {
+        const UWorld* World = Context ? Context->GetWorld() : nullptr;
+        const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        const UFactionRegistry* Registry = GameInstance ? GameInstance->GetSubsystem<UFactionRegistry>() : nullptr;
+        if (!Registry)
+        {
+            return nullptr;
+        }
+
+        OutA = Registry->FindFactionIDByTag(FactionA);
+        OutB = Registry->FindFactionIDByTag(FactionB);
+        return (OutA != INDEX_NONE && OutB != INDEX_NONE) ? Registry : nullptr;
+    }
+}
 
 bool IARPG_FactionInterface::IsHostileToFaction_Implementation(const FGameplayTag& OtherFaction) const
 {
@@ -47,6 +68,13 @@ bool IARPG_FactionInterface::IsHostileToFaction_Implementation(const FGameplayTa
         return false;
     }
 
+    // Registered factions answer from the registry's relationship matrix - the game state keeps it in step on clients
+    int32 MyID, OtherID;
+    if (const UFactionRegistry* Registry = FindRegistryFactions(Cast<UObject>(this), MyFaction, OtherFaction, MyID, OtherID))
+    {
+        return Registry->AreAtWar(MyID, OtherID);
+    }
+
     // Check game state for faction relationships
     if (const UWorld* World = Cast<UObject>(this)->GetWorld())
     {
@@ -105,6 +133,13 @@ bool IARPG_FactionInterface::IsAlliedWithFaction_Implementation(const FGameplayT
         return true;
     }
 
+    // Registered factions answer from the registry's relationship matrix - the game state keeps it in step on clients
+    int32 MyID, OtherID;
+    if (const UFactionRegistry* Registry = FindRegistryFactions(Cast<UObject>(this), MyFaction, OtherFaction, MyID, OtherID))
+    {
+        return Registry->AreAllied(MyID, OtherID);
+    }
+
     // Check game state for specific alliances
     if (const UWorld* World = Cast<UObject>(this)->GetWorld())
     {
@@ -146,6 +181,13 @@ float IARPG_FactionInterface::GetFactionRelationship_Implementation(const FGamep
         return 1.0f;
     }
 
+    // Registry values are -100 to 100
+    int32 MyID, OtherID;
+    if (const UFactionRegistry* Registry = FindRegistryFactions(Cast<UObject>(this), MyFaction, OtherFaction, MyID, OtherID))
+    {
+        return Registry->GetRelationshipValue(MyID, OtherID) / 100.0f;
+    }
+
     // Check game state for specific relationship values
     if (const UWorld* World = Cast<UObject>(this)->GetWorld())
     {
@@ -6,15 +6,17 @@
 #include "AI/Core/ARPG_AIPerceptionComponent.h"
 #include "AI/Core/ARPG_AINeedsComponent.h"
 #include "AI/Core/ARPG_AIPersonalityComponent.h"
+#include "AI/Core/ARPG_AIManager.h"
+#include "AI/Components/ARPG_RelationshipComponent.h"
+#include "Components/HealthComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Types/ARPG_AITypes.h"
 #include "GameplayTagsManager.h"
 #include "Core/RadiantGameplayTags.h"
 
 AARPG_BaseNPCCharacter::AARPG_BaseNPCCharacter()
 {
-    PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.TickInterval = 0.1f; // 10 FPS for NPCs
-
+    // No actor tick - brain and AI components schedule their own updates
     // Set character type for BaseCharacter
     CharacterType = ECharacterType::NPC;
 
@@ -48,10 +50,21 @@ void AARPG_BaseNPCCharacter::BeginPlay()
     InitializeAIComponents();
     SetupComponentReferences();
 
+    // Significance drives AI LOD and replication rate
+    if (UARPG_AIManager* AIManager = GetWorld()->GetSubsystem<UARPG_AIManager>())
+    {
+        AIManager->RegisterNPC(this);
+    }
+
     // Bind to brain events
     if (BrainComponent)
     {
         BrainComponent->OnIntentChanged.AddDynamic(this, &AARPG_BaseNPCCharacter::OnIntentChanged);
+
+        if (bFollowDailyRoutine)
+        {
+            BrainComponent->StartRoutine(Archetype);
+        }
     }
 
     BP_OnNPCInitialized();
@@ -65,21 +78,12 @@ void AARPG_BaseNPCCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
         BrainComponent->OnIntentChanged.RemoveAll(this);
     }
 
-    Super::EndPlay(EndPlayReason);
-}
-
-void AARPG_BaseNPCCharacter::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    // Only tick if active
-    if (!bIsActive)
+    if (UARPG_AIManager* AIManager = GetWorld()->GetSubsystem<UARPG_AIManager>())
     {
-        return;
+        AIManager->UnregisterNPC(this);
     }
 
-    // Brain component handles its own ticking
-    // This allows for custom NPC logic in derived classes
+    Super::EndPlay(EndPlayReason);
 }
 
 // === IARPG_AIBrainInterface Implementation ===
@@ -177,11 +181,25 @@ void AARPG_BaseNPCCharacter::InitializeNPC(const FARPG_NPCConfiguration& Config)
     // Set NPC properties from config
     NPCType = Config.NPCType;
     Faction = Config.Faction;
+    Archetype = Config.Archetype;
+    bFollowDailyRoutine = Config.bFollowDailyRoutine;
 
     // Initialize AI systems with configuration
     if (BrainComponent)
     {
         BrainComponent->InitializeBrain(Config.BrainConfig);
+
+        if (HasActorBegunPlay())
+        {
+            if (bFollowDailyRoutine)
+            {
+                BrainComponent->StartRoutine(Archetype);
+            }
+            else
+            {
+                BrainComponent->StopRoutine();
+            }
+        }
     }
 
     if (NeedsComponent && Config.bUseCustomNeeds)
@@ -198,6 +216,137 @@ void AARPG_BaseNPCCharacter::InitializeNPC(const FARPG_NPCConfiguration& Config)
     }
 }
 
+void AARPG_BaseNPCCharacter::SetDailyRoutine(EARPG_NPCArchetype NewArchetype, bool bFollow)
+{
+    Archetype = NewArchetype;
+    bFollowDailyRoutine = bFollow;
+
+    if (BrainComponent && HasActorBegunPlay())
+    {
+        if (bFollowDailyRoutine)
+        {
+            BrainComponent->StartRoutine(Archetype);
+        }
+        else
+        {
+            BrainComponent->StopRoutine();
+        }
+    }
+}
+
+void AARPG_BaseNPCCharacter::SetCrowdPooled(bool bPooled)
+{
+    if (bCrowdPooled == bPooled)
+    {
+        return;
+    }
+
+    bCrowdPooled = bPooled;
+
+    SetActorHiddenInGame(bPooled);
+    SetActorEnableCollision(!bPooled);
+    SetActorTickEnabled(!bPooled);
+
+    UARPG_AIManager* AIManager = GetWorld()->GetSubsystem<UARPG_AIManager>();
+
+    if (bPooled)
+    {
+        // Only resume the components that were ticking - some start disabled on purpose
+        PooledTickComponents.Reset();
+        for (UActorComponent* Component : GetComponents())
+        {
+            if (Component && Component->IsComponentTickEnabled())
+            {
+                PooledTickComponents.Add(Component);
+                Component->SetComponentTickEnabled(false);
+            }
+        }
+
+        if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+        {
+            Movement->StopMovementImmediately();
+            Movement->DisableMovement();
+        }
+
+        if (BrainComponent)
+        {
+            BrainComponent->StopRoutine();
+        }
+
+        SetBrainEnabled(false);
+        ResetCrowdIdentity();
+
+        if (AIManager)
+        {
+            AIManager->UnregisterNPC(this);
+        }
+
+        if (HasAuthority())
+        {
+            SetNetDormancy(DORM_DormantAll);
+        }
+    }
+    else
+    {
+        for (const TWeakObjectPtr<UActorComponent>& Component : PooledTickComponents)
+        {
+            if (Component.IsValid())
+            {
+                Component->SetComponentTickEnabled(true);
+            }
+        }
+        PooledTickComponents.Reset();
+
+        if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+        {
+            Movement->SetMovementMode(MOVE_Walking);
+        }
+
+        if (HasAuthority())
+        {
+            SetNetDormancy(DORM_Awake);
+        }
+
+        if (AIManager)
+        {
+            AIManager->RegisterNPC(this);
+        }
+
+        SetBrainEnabled(true);
+    }
+}
+
+void AARPG_BaseNPCCharacter::ResetCrowdIdentity()
+{
+    // The next proxy applied to this actor is a different person
+    if (UARPG_RelationshipComponent* Relationships = FindComponentByClass<UARPG_RelationshipComponent>())
+    {
+        Relationships->ClearRelationships();
+    }
+
+    if (MemoryComponent)
+    {
+        MemoryComponent->ResetMemory();
+    }
+
+    if (BrainComponent)
+    {
+        BrainComponent->ClearBrainState();
+    }
+
+    if (HealthComponent)
+    {
+        if (HealthComponent->IsDead())
+        {
+            HealthComponent->Revive(1.0f);
+        }
+        else
+        {
+            HealthComponent->SetHealth(HealthComponent->GetMaxHealth());
+        }
+    }
+}
+
 void AARPG_BaseNPCCharacter::SetFaction(FGameplayTag NewFaction)
 {
     FGameplayTag OldFaction = Faction;
@@ -303,6 +452,10 @@ void AARPG_BaseNPCCharacter::UpdateBehaviorFromIntent(const FARPG_AIIntent& Inte
     {
         CurrentBehavior = TAG_Behavior_Idle; // Standing guard
     }
+    else if (Intent.IntentTag.MatchesTag(TAG_AI_Intent_Work))
+    {
+        CurrentBehavior = TAG_Behavior_Working;
+    }
     else
     {
         // Default fallback behavior
@@ -312,6 +465,12 @@ void AARPG_BaseNPCCharacter::UpdateBehaviorFromIntent(const FARPG_AIIntent& Inte
     // Notify about behavior change if it actually changed
     if (OldBehavior != CurrentBehavior)
     {
+        // New behavior usually means movement - wake before it starts rather than at the next significance pass
+        if (HasAuthority() && NetDormancy > DORM_Awake)
+        {
+            SetNetDormancy(DORM_Awake);
+        }
+
         OnBehaviorChanged.Broadcast(this, CurrentBehavior);
         BP_OnBehaviorChanged(OldBehavior, CurrentBehavior);
     }
@@ -17,9 +17,10 @@
 
 ABaseCharacter::ABaseCharacter()
 {
-    PrimaryActorTick.bCanEverTick = true;
-    // Optimize tick rate for NPCs - will be overridden by PlayerCharacter
-    PrimaryActorTick.TickInterval = 0.1f; // 10Hz for NPCs
+    // Characters are event-driven - cached stats are maintained from component
+    // change delegates. Subclasses that need per-frame work opt back in.
+    PrimaryActorTick.bCanEverTick = false;
+    PrimaryActorTick.bStartWithTickEnabled = false;
 
     // Set default capsule size
     GetCapsuleComponent()->SetCapsuleSize(42.0f, 96.0f);
@@ -99,27 +100,6 @@ void ABaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
-void ABaseCharacter::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    // Minimal tick logic - most work should be event-driven
-    // Only update critical cached values if they've changed significantly
-    
-    if (HealthComponent)
-    {
-        float NewHealth = HealthComponent->GetHealth();
-        float NewMaxHealth = HealthComponent->GetMaxHealth();
-        
-        if (FMath::Abs(NewHealth - CurrentHealth) > 0.1f || 
-            FMath::Abs(NewMaxHealth - MaxHealth) > 0.1f)
-        {
-            CurrentHealth = NewHealth;
-            MaxHealth = NewMaxHealth;
-        }
-    }
-}
-
 void ABaseCharacter::InitializeExistingComponents()
 {
     // Only initialize components that were created in the constructor
@@ -197,9 +177,34 @@ void ABaseCharacter::BindAllComponentEvents()
         StaminaComponent->OnStaminaChanged.AddDynamic(this, &ABaseCharacter::OnStaminaComponentChanged);
     }
 
+    // Components broadcast their initial values during their own BeginPlay,
+    // before we were bound - seed the caches once here
+    RefreshCachedStats();
+
     UE_LOG(LogTemp, Log, TEXT("Component events bound for %s"), *GetName());
 }
 
+void ABaseCharacter::RefreshCachedStats()
+{
+    if (HealthComponent)
+    {
+        CurrentHealth = HealthComponent->GetHealth();
+        MaxHealth = HealthComponent->GetMaxHealth();
+    }
+
+    if (ManaComponent)
+    {
+        CurrentMana = ManaComponent->GetMana();
+        MaxMana = ManaComponent->GetMaxMana();
+    }
+
+    if (StaminaComponent)
+    {
+        CurrentStamina = StaminaComponent->GetStamina();
+        MaxStamina = StaminaComponent->GetMaxStamina();
+    }
+}
+
 bool ABaseCharacter::HasCharacterTag(const FGameplayTag& Tag) const
 {
     return CharacterTags.HasTag(Tag);
@@ -220,6 +225,9 @@ void ABaseCharacter::SetCharacterState(ECharacterState NewState)
     PreviousState = CurrentState;
     CurrentState = NewState;
 
+    // Dormant characters still need to send state changes
+    FlushNetDormancy();
+
     // Broadcast state change
     OnCharacterStateChanged.Broadcast(CurrentState);
     OnCharacterStateChangedBP(PreviousState, CurrentState);
@@ -236,6 +244,7 @@ void ABaseCharacter::SetFactionTag(const FGameplayTag& NewFactionTag)
     {
         FGameplayTag OldFaction = FactionTag;
         FactionTag = NewFactionTag;
+        FlushNetDormancy();
 
         UE_LOG(LogTemp, Log, TEXT("Character %s faction changed from %s to %s"),
                *GetName(),
@@ -371,6 +380,7 @@ void ABaseCharacter::OnHealthComponentChanged(float NewHealth, float NewMaxHealt
 {
     CurrentHealth = NewHealth;
     MaxHealth = NewMaxHealth;
+    FlushNetDormancy();
     
     float HealthPercent = MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 0.0f;
     float DamageAmount = 0.0f; // Could track this if needed
@@ -27,8 +27,9 @@ APlayerCharacter::APlayerCharacter()
     // CRITICAL: Set character type FIRST so BaseCharacter constructor creates all components
     CharacterType = ECharacterType::Player;
 
-    // Override tick settings for player - needs faster updates
+    // Opt in to actor tick - player needs per-frame camera, interaction and sprint updates
     PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = true;
     PrimaryActorTick.TickInterval = 0.0f; // Full framerate for player
 
     // Configure character movement for player
@@ -0,0 +1,193 @@
+// Private/Components/EquipmentComponent.cpp
+
+#include "Components/EquipmentComponent.h"
+#include "Engine/DataTable.h"
+
+UEquipmentComponent::UEquipmentComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    ItemDataTable = nullptr;
+
+    EquippedItems.SetNum((int32)EEquipmentSlot::MAX);
+    SlotContributions.SetNum((int32)EEquipmentSlot::MAX);
+}
+
+void UEquipmentComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    EquippedItems.SetNum((int32)EEquipmentSlot::MAX);
+    SlotContributions.SetNum((int32)EEquipmentSlot::MAX);
+
+    // Fold in any items equipped before play
+    for (int32 SlotIndex = 0; SlotIndex < EquippedItems.Num(); ++SlotIndex)
+    {
+        if (!EquippedItems[SlotIndex].ItemID.IsNone())
+        {
+            FEquipmentStatContribution Contribution;
+            BuildContribution(EquippedItems[SlotIndex], Contribution);
+            ReplaceSlotContribution(SlotIndex, Contribution);
+        }
+    }
+}
+
+// Equipment
+bool UEquipmentComponent::EquipItem(EEquipmentSlot Slot, const FItemInstance& Item, FItemInstance& OutPrevious)
+{
+    if (!IsValidSlot(Slot) || Item.ItemID.IsNone())
+    {
+        return false;
+    }
+
+    const int32 SlotIndex = (int32)Slot;
+    const bool bReplaced = !EquippedItems[SlotIndex].ItemID.IsNone();
+    if (bReplaced)
+    {
+        OutPrevious = EquippedItems[SlotIndex];
+    }
+
+    EquippedItems[SlotIndex] = Item;
+
+    FEquipmentStatContribution Contribution;
+    BuildContribution(Item, Contribution);
+    ReplaceSlotContribution(SlotIndex, Contribution);
+
+    OnSlotChanged.Broadcast(Slot, Item.ItemID);
+    return bReplaced;
+}
+
+bool UEquipmentComponent::UnequipItem(EEquipmentSlot Slot, FItemInstance& OutItem)
+{
+    if (!IsSlotOccupied(Slot))
+    {
+        return false;
+    }
+
+    const int32 SlotIndex = (int32)Slot;
+    OutItem = EquippedItems[SlotIndex];
+    EquippedItems[SlotIndex] = FItemInstance();
+
+    ReplaceSlotContribution(SlotIndex, FEquipmentStatContribution());
+
+    OnSlotChanged.Broadcast(Slot, NAME_None);
+    return true;
+}
+
+void UEquipmentComponent::SetItemDurability(EEquipmentSlot Slot, float NewDurability)
+{
+    if (!IsSlotOccupied(Slot))
+    {
+        return;
+    }
+
+    FItemInstance& Item = EquippedItems[(int32)Slot];
+    const bool bWasBroken = Item.Durability <= 0.0f;
+
+    Item.Durability = FMath::Clamp(NewDurability, 0.0f, Item.MaxDurability);
+
+    // Stats only change when the item breaks or is repaired
+    const bool bIsBroken = Item.Durability <= 0.0f;
+    if (bWasBroken != bIsBroken)
+    {
+        FEquipmentStatContribution Contribution;
+        BuildContribution(Item, Contribution);
+        ReplaceSlotContribution((int32)Slot, Contribution);
+    }
+}
+
+bool UEquipmentComponent::IsSlotOccupied(EEquipmentSlot Slot) const
+{
+    return IsValidSlot(Slot) && !EquippedItems[(int32)Slot].ItemID.IsNone();
+}
+
+bool UEquipmentComponent::GetEquippedItem(EEquipmentSlot Slot, FItemInstance& OutItem) const
+{
+    if (!IsSlotOccupied(Slot))
+    {
+        return false;
+    }
+
+    OutItem = EquippedItems[(int32)Slot];
+    return true;
+}
+
+// Stat totals
+float UEquipmentComponent::GetFlatBonus(ERadiantStatType StatType) const
+{
+    const int32 StatIndex = (int32)StatType;
+    return StatIndex < (int32)ERadiantStatType::MAX ? Totals.Flat[StatIndex] : 0.0f;
+}
+
+float UEquipmentComponent::GetPercentBonus(ERadiantStatType StatType) const
+{
+    const int32 StatIndex = (int32)StatType;
+    return StatIndex < (int32)ERadiantStatType::MAX ? Totals.Percent[StatIndex] : 0.0f;
+}
+
+float UEquipmentComponent::ApplyStatBonus(ERadiantStatType StatType, float BaseValue) const
+{
+    return (BaseValue + GetFlatBonus(StatType)) * (1.0f + GetPercentBonus(StatType) / 100.0f);
+}
+
+// Internal
+void UEquipmentComponent::BuildContribution(const FItemInstance& Item, FEquipmentStatContribution& OutContribution) const
+{
+    OutContribution.Reset();
+
+    if (Item.ItemID.IsNone() || Item.Durability <= 0.0f)
+    {
+        return;
+    }
+
+    if (const FItemData* Data = ItemDataTable ? ItemDataTable->FindRow<FItemData>(Item.ItemID, TEXT("Equipment"), false) : nullptr)
+    {
+        for (const FItemStatBonus& Bonus : Data->BaseStats)
+        {
+            OutContribution.AddBonus(Bonus);
+        }
+    }
+
+    if (const FItemUniqueData* UniqueData = Item.GetUniqueData())
+    {
+        for (const FItemAffix& Affix : UniqueData->Affixes)
+        {
+            for (const FItemStatBonus& Bonus : Affix.StatBonuses)
+            {
+                OutContribution.AddBonus(Bonus);
+            }
+        }
+
+        for (const FItemStatBonus& Bonus : UniqueData->BonusStats)
+        {
+            OutContribution.AddBonus(Bonus);
+        }
+    }
+}
+
+void UEquipmentComponent::ReplaceSlotContribution(int32 SlotIndex, const FEquipmentStatContribution& NewContribution)
+{
+    FEquipmentStatContribution& OldContribution = SlotContributions[SlotIndex];
+
+    for (int32 StatIndex = 0; StatIndex < (int32)ERadiantStatType::MAX; ++StatIndex)
+    {
+        const float FlatDelta = NewContribution.Flat[StatIndex] - OldContribution.Flat[StatIndex];
+        const float PercentDelta = NewContribution.Percent[StatIndex] - OldContribution.Percent[StatIndex];
+        if (FlatDelta == 0.0f && PercentDelta == 0.0f)
+        {
+            continue;
+        }
+
+        Totals.Flat[StatIndex] += FlatDelta;
+        Totals.Percent[StatIndex] += PercentDelta;
+
+        OnStatChanged.Broadcast((ERadiantStatType)StatIndex, Totals.Flat[StatIndex], Totals.Percent[StatIndex]);
+    }
+
+    OldContribution = NewContribution;
+}
+
+bool UEquipmentComponent::IsValidSlot(EEquipmentSlot Slot)
+{
+    return Slot != EEquipmentSlot::None && Slot < EEquipmentSlot::MAX;
+}
@@ -0,0 +1,539 @@
+// Private/Components/InventoryComponent.cpp
+
+#include "Components/InventoryComponent.h"
+#include "Engine/DataTable.h"
+#include "Net/UnrealNetwork.h"
+
+// Fast array callbacks
+void FInventoryEntry::PreReplicatedRemove(const FInventoryList& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->UnaccountEntry(*this);
+        InArraySerializer.OwnerComponent->MarkSlotIndicesDirty();
+    }
+}
+
+void FInventoryEntry::PostReplicatedAdd(const FInventoryList& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->AccountEntry(*this);
+        InArraySerializer.OwnerComponent->MarkSlotIndicesDirty();
+    }
+}
+
+void FInventoryEntry::PostReplicatedChange(const FInventoryList& InArraySerializer)
+{
+    if (InArraySerializer.OwnerComponent)
+    {
+        InArraySerializer.OwnerComponent->AccountEntry(*this);
+    }
+}
+
+UInventoryComponent::UInventoryComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+
+    ItemDataTable = nullptr;
+    MaxSlots = 40;
+    MaxWeight = 0.0f;
+
+    CachedTotalWeight = 0.0f;
+    BatchDepth = 0;
+    bTotalsDirty = false;
+
+    NextSlotId = 0;
+    bSlotIndicesDirty = false;
+
+    InventoryList.OwnerComponent = this;
+}
+
+void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(UInventoryComponent, InventoryList);
+}
+
+void UInventoryComponent::ConfigureInventory(UDataTable* InItemDataTable, int32 InMaxSlots, float InMaxWeight)
+{
+    ItemDataTable = InItemDataTable;
+    MaxSlots = FMath::Max(1, InMaxSlots);
+    MaxWeight = FMath::Max(0.0f, InMaxWeight);
+}
+
+void UInventoryComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    InventoryList.OwnerComponent = this;
+
+    // Fold in any slots authored on the component
+    const bool bAssignSlotIds = GetOwner() && GetOwner()->HasAuthority();
+    for (const FInventoryEntry& Entry : InventoryList.Entries)
+    {
+        NextSlotId = FMath::Max(NextSlotId, Entry.SlotId + 1);
+    }
+    for (FInventoryEntry& Entry : InventoryList.Entries)
+    {
+        if (bAssignSlotIds && Entry.SlotId == INDEX_NONE)
+        {
+            Entry.SlotId = NextSlotId++;
+        }
+        AccountEntry(Entry);
+    }
+    bSlotIndicesDirty = true;
+}
+
+// Mutation
+int32 UInventoryComponent::AddItem(const FItemInstance& Item)
+{
+    if (!HasInventoryAuthority())
+    {
+        return Item.Quantity;
+    }
+
+    return AddItemInternal(Item);
+}
+
+int32 UInventoryComponent::AddItemStack(const FItemStack& Stack)
+{
+    return AddItem(FItemInstance(Stack));
+}
+
+void UInventoryComponent::AddItemStacks(const TArray<FItemStack>& Stacks, TArray<FItemStack>& OutLeftovers)
+{
+    if (!HasInventoryAuthority())
+    {
+        OutLeftovers.Append(Stacks);
+        return;
+    }
+
+    ++BatchDepth;
+
+    for (const FItemStack& Stack : Stacks)
+    {
+        const int32 Leftover = AddItemInternal(FItemInstance(Stack));
+        if (Leftover > 0)
+        {
+            OutLeftovers.Add(FItemStack(Stack.ItemID, Leftover, Stack.Quality));
+        }
+    }
+
+    EndBatch();
+}
+
+int32 UInventoryComponent::RemoveItem(FName ItemID, int32 Quantity)
+{
+    if (!HasInventoryAuthority() || Quantity <= 0 || GetItemCount(ItemID) == 0)
+    {
+        return 0;
+    }
+
+    ++BatchDepth;
+
+    int32 Remaining = Quantity;
+
+    // Walk backwards so swap-removal never skips a slot
+    TArray<FInventoryEntry>& Entries = InventoryList.Entries;
+    for (int32 SlotIndex = Entries.Num() - 1; SlotIndex >= 0 && Remaining > 0; --SlotIndex)
+    {
+        if (Entries[SlotIndex].Item.ItemID == ItemID)
+        {
+            Remaining -= RemoveFromSlotIndex(SlotIndex, Remaining);
+        }
+    }
+
+    EndBatch();
+
+    return Quantity - Remaining;
+}
+
+int32 UInventoryComponent::RemoveFromSlot(int32 SlotId, int32 Quantity)
+{
+    if (!HasInventoryAuthority())
+    {
+        return 0;
+    }
+
+    return RemoveFromSlotIndex(FindSlotIndex(SlotId), Quantity);
+}
+
+int32 UInventoryComponent::SplitStack(int32 SlotId, int32 Amount)
+{
+    const int32 SlotIndex = FindSlotIndex(SlotId);
+    if (!HasInventoryAuthority() || SlotIndex == INDEX_NONE || InventoryList.Entries.Num() >= MaxSlots)
+    {
+        return INDEX_NONE;
+    }
+
+    if (Amount <= 0 || Amount >= InventoryList.Entries[SlotIndex].Item.Quantity)
+    {
+        return INDEX_NONE;
+    }
+
+    FInventoryEntry NewEntry;
+    NewEntry.Item = InventoryList.Entries[SlotIndex].Item;
+    NewEntry.Item.Quantity = Amount;
+
+    // The split-off slot is a separate instance
+    NewEntry.Item.UniqueID = FGuid();
+    if (NewEntry.Item.HasUniqueData())
+    {
+        NewEntry.Item.EnsureUniqueID();
+    }
+
+    ++BatchDepth;
+
+    FInventoryEntry& Source = InventoryList.Entries[SlotIndex];
+    Source.Item.Quantity -= Amount;
+    AccountEntry(Source);
+    MarkSlotDirty(SlotIndex);
+
+    const int32 NewIndex = AddSlotInternal(MoveTemp(NewEntry));
+
+    EndBatch();
+
+    return InventoryList.Entries[NewIndex].SlotId;
+}
+
+bool UInventoryComponent::MergeStacks(int32 FromSlotId, int32 ToSlotId)
+{
+    const int32 FromSlot = FindSlotIndex(FromSlotId);
+    const int32 ToSlot = FindSlotIndex(ToSlotId);
+    if (!HasInventoryAuthority() || FromSlot == ToSlot || FromSlot == INDEX_NONE || ToSlot == INDEX_NONE)
+    {
+        return false;
+    }
+
+    TArray<FInventoryEntry>& Entries = InventoryList.Entries;
+    FInventoryEntry& From = Entries[FromSlot];
+    FInventoryEntry& To = Entries[ToSlot];
+    if (!From.Item.CanStackWith(To.Item))
+    {
+        return false;
+    }
+
+    const int32 Moved = FMath::Min(From.Item.Quantity, GetMaxStackSize(To.Item.ItemID) - To.Item.Quantity);
+    if (Moved <= 0)
+    {
+        return false;
+    }
+
+    ++BatchDepth;
+
+    To.Item.Quantity += Moved;
+    AccountEntry(To);
+    MarkSlotDirty(ToSlot);
+
+    RemoveFromSlotIndex(FromSlot, Moved);
+
+    EndBatch();
+
+    return true;
+}
+
+void UInventoryComponent::ClearInventory()
+{
+    if (!HasInventoryAuthority())
+    {
+        return;
+    }
+
+    ++BatchDepth;
+
+    for (FInventoryEntry& Entry : InventoryList.Entries)
+    {
+        UnaccountEntry(Entry);
+    }
+
+    InventoryList.Entries.Empty();
+    InventoryList.MarkArrayDirty();
+    SlotIndices.Reset();
+
+    EndBatch();
+}
+
+// Queries
+int32 UInventoryComponent::GetItemCount(FName ItemID) const
+{
+    const int32* Count = CachedItemCounts.Find(ItemID);
+    return Count ? *Count : 0;
+}
+
+bool UInventoryComponent::GetSlot(int32 SlotId, FItemInstance& OutItem) const
+{
+    const int32 SlotIndex = FindSlotIndex(SlotId);
+    if (SlotIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutItem = InventoryList.Entries[SlotIndex].Item;
+    return true;
+}
+
+TArray<int32> UInventoryComponent::GetSlotIds() const
+{
+    TArray<int32> SlotIds;
+    SlotIds.Reserve(InventoryList.Entries.Num());
+    for (const FInventoryEntry& Entry : InventoryList.Entries)
+    {
+        SlotIds.Add(Entry.SlotId);
+    }
+
+    // Ids only grow, so sorting gives creation order whatever the array order is
+    SlotIds.Sort();
+    return SlotIds;
+}
+
+// Replication bookkeeping
+void UInventoryComponent::AccountEntry(FInventoryEntry& Entry)
+{
+    if (Entry.AccountedQuantity == 0)
+    {
+        Entry.UnitWeight = GetUnitWeight(Entry.Item.ItemID);
+    }
+
+    const int32 Delta = Entry.Item.Quantity - Entry.AccountedQuantity;
+    if (Delta == 0)
+    {
+        return;
+    }
+
+    Entry.AccountedQuantity = Entry.Item.Quantity;
+    CachedTotalWeight += Delta * Entry.UnitWeight;
+    ApplyItemCountDelta(Entry.Item.ItemID, Delta);
+    BroadcastTotals();
+}
+
+void UInventoryComponent::UnaccountEntry(FInventoryEntry& Entry)
+{
+    if (Entry.AccountedQuantity == 0)
+    {
+        return;
+    }
+
+    const int32 Delta = -Entry.AccountedQuantity;
+    Entry.AccountedQuantity = 0;
+    CachedTotalWeight = FMath::Max(0.0f, CachedTotalWeight + Delta * Entry.UnitWeight);
+    ApplyItemCountDelta(Entry.Item.ItemID, Delta);
+    BroadcastTotals();
+}
+
+// Internal
+bool UInventoryComponent::HasInventoryAuthority() const
+{
+    const AActor* Owner = GetOwner();
+    if (Owner && Owner->HasAuthority())
+    {
+        return true;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("InventoryComponent: Inventory changes must be made on the server"));
+    return false;
+}
+
+int32 UInventoryComponent::GetMaxStackSize(FName ItemID) const
+{
+    const FItemData* Data = ItemDataTable ? ItemDataTable->FindRow<FItemData>(ItemID, TEXT("Inventory"), false) : nullptr;
+    return Data ? FMath::Max(1, Data->MaxStackSize) : 1;
+}
+
+float UInventoryComponent::GetUnitWeight(FName ItemID) const
+{
+    const FItemData* Data = ItemDataTable ? ItemDataTable->FindRow<FItemData>(ItemID, TEXT("Inventory"), false) : nullptr;
+    return Data ? FMath::Max(0.0f, Data->Weight) : 0.0f;
+}
+
+int32 UInventoryComponent::GetWeightCapacityFor(FName ItemID) const
+{
+    const float UnitWeight = GetUnitWeight(ItemID);
+    if (MaxWeight <= 0.0f || UnitWeight <= 0.0f)
+    {
+        return MAX_int32;
+    }
+
+    return FMath::Max(0, FMath::FloorToInt((MaxWeight - CachedTotalWeight) / UnitWeight));
+}
+
+int32 UInventoryComponent::AddItemInternal(const FItemInstance& Item)
+{
+    if (Item.Quantity <= 0 || Item.ItemID.IsNone())
+    {
+        return 0;
+    }
+
+    ++BatchDepth;
+
+    const int32 MaxStack = GetMaxStackSize(Item.ItemID);
+    const int32 Accepted = FMath::Min(Item.Quantity, GetWeightCapacityFor(Item.ItemID));
+    int32 Remaining = Accepted;
+
+    TArray<FInventoryEntry>& Entries = InventoryList.Entries;
+
+    // Top up existing stacks first
+    if (Item.IsStackable())
+    {
+        for (int32 SlotIndex = 0; SlotIndex < Entries.Num() && Remaining > 0; ++SlotIndex)
+        {
+            FInventoryEntry& Entry = Entries[SlotIndex];
+            if (Entry.Item.Quantity >= MaxStack || !Entry.Item.CanStackWith(Item))
+            {
+                continue;
+            }
+
+            const int32 Moved = FMath::Min(Remaining, MaxStack - Entry.Item.Quantity);
+            Entry.Item.Quantity += Moved;
+            Remaining -= Moved;
+
+            AccountEntry(Entry);
+            MarkSlotDirty(SlotIndex);
+        }
+    }
+
+    // Then open new slots
+    bool bFirstNewSlot = true;
+    while (Remaining > 0 && Entries.Num() < MaxSlots)
+    {
+        FInventoryEntry NewEntry;
+        NewEntry.Item = Item;
+        NewEntry.Item.Quantity = FMath::Min(Remaining, MaxStack);
+
+        if (!bFirstNewSlot)
+        {
+            NewEntry.Item.UniqueID = FGuid();
+        }
+        if (NewEntry.Item.HasUniqueData())
+        {
+            NewEntry.Item.EnsureUniqueID();
+        }
+        bFirstNewSlot = false;
+
+        Remaining -= NewEntry.Item.Quantity;
+
+        AddSlotInternal(MoveTemp(NewEntry));
+    }
+
+    EndBatch();
+
+    return Item.Quantity - (Accepted - Remaining);
+}
+
+int32 UInventoryComponent::AddSlotInternal(FInventoryEntry&& NewEntry)
+{
+    NewEntry.SlotId = NextSlotId++;
+
+    const int32 NewIndex = InventoryList.Entries.Add(MoveTemp(NewEntry));
+    FInventoryEntry& Entry = InventoryList.Entries[NewIndex];
+    SlotIndices.Add(Entry.SlotId, NewIndex);
+
+    AccountEntry(Entry);
+    MarkSlotDirty(NewIndex);
+    return NewIndex;
+}
+
+int32 UInventoryComponent::RemoveFromSlotIndex(int32 SlotIndex, int32 Quantity)
+{
+    if (!InventoryList.Entries.IsValidIndex(SlotIndex) || Quantity <= 0)
+    {
+        return 0;
+    }
+
+    ++BatchDepth;
+
+    FInventoryEntry& Entry = InventoryList.Entries[SlotIndex];
+    const int32 Removed = FMath::Min(Quantity, Entry.Item.Quantity);
+
+    if (Removed >= Entry.Item.Quantity)
+    {
+        RemoveSlotInternal(SlotIndex);
+    }
+    else
+    {
+        Entry.Item.Quantity -= Removed;
+        AccountEntry(Entry);
+        MarkSlotDirty(SlotIndex);
+    }
+
+    EndBatch();
+
+    return Removed;
+}
+
+void UInventoryComponent::RemoveSlotInternal(int32 SlotIndex)
+{
+    TArray<FInventoryEntry>& Entries = InventoryList.Entries;
+    UnaccountEntry(Entries[SlotIndex]);
+    SlotIndices.Remove(Entries[SlotIndex].SlotId);
+
+    // Swap-removal only moves the last entry's array index, its SlotId is untouched.
+    // The moved entry is not marked dirty, so clients only see the removal
+    Entries.RemoveAtSwap(SlotIndex, 1, EAllowShrinking::No);
+    if (Entries.IsValidIndex(SlotIndex))
+    {
+        SlotIndices.Add(Entries[SlotIndex].SlotId, SlotIndex);
+    }
+
+    InventoryList.MarkArrayDirty();
+    bTotalsDirty = true;
+}
+
+void UInventoryComponent::MarkSlotDirty(int32 SlotIndex)
+{
+    InventoryList.MarkItemDirty(InventoryList.Entries[SlotIndex]);
+}
+
+int32 UInventoryComponent::FindSlotIndex(int32 SlotId) const
+{
+    if (bSlotIndicesDirty)
+    {
+        SlotIndices.Reset();
+        for (int32 SlotIndex = 0; SlotIndex < InventoryList.Entries.Num(); ++SlotIndex)
+        {
+            SlotIndices.Add(InventoryList.Entries[SlotIndex].SlotId, SlotIndex);
+        }
+        bSlotIndicesDirty = false;
+    }
+
+    const int32* SlotIndex = SlotIndices.Find(SlotId);
+    return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+void UInventoryComponent::ApplyItemCountDelta(FName ItemID, int32 Delta)
+{
+    int32& Count = CachedItemCounts.FindOrAdd(ItemID);
+    Count += Delta;
+
+    const int32 NewCount = Count;
+    if (NewCount <= 0)
+    {
+        CachedItemCounts.Remove(ItemID);
+    }
+
+    OnItemCountChanged.Broadcast(ItemID, FMath::Max(0, NewCount));
+}
+
+void UInventoryComponent::BroadcastTotals()
+{
+    if (BatchDepth > 0)
+    {
+        bTotalsDirty = true;
+        return;
+    }
+
+    bTotalsDirty = false;
+    OnTotalsChanged.Broadcast(CachedTotalWeight, InventoryList.Entries.Num());
+}
+
+void UInventoryComponent::EndBatch()
+{
+    --BatchDepth;
+
+    if (BatchDepth == 0 && bTotalsDirty)
+    {
+        BroadcastTotals();
+    }
+}
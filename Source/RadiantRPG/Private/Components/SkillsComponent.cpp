@@ -5,6 +5,7 @@
 #include "Types/RadiantTypes.h"
 #include "Engine/DataTable.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "Types/SkillTypes.h"
 
 USkillsComponent::USkillsComponent()
@@ -16,9 +17,12 @@ USkillsComponent::USkillsComponent()
     TotalSkillCap = 700.0f;
     ExperienceGainMultiplier = 1.0f;
     bEnforceSkillCaps = true;
+    ExperienceBatchWindow = 0.0f;
     CurrentTotalSkillPoints = 0.0f;
     
     SetIsReplicatedByDefault(true);
+
+    ResetSkillStorage();
 }
 
 void USkillsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -26,6 +30,7 @@ void USkillsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     
     DOREPLIFETIME(USkillsComponent, Skills);
+    DOREPLIFETIME(USkillsComponent, KnownSkills);
     DOREPLIFETIME(USkillsComponent, CurrentTotalSkillPoints);
 }
 
@@ -34,7 +39,18 @@ void USkillsComponent::BeginPlay()
     Super::BeginPlay();
     
     OwnerCharacter = Cast<ABaseCharacter>(GetOwner());
+
+    SynergyGraph.Compile(SkillSynergies);
     InitializeDefaultSkills();
+    RebuildSynergyBonuses();
+}
+
+void USkillsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Experience still inside the batch window would otherwise be lost
+    FlushSkillExperience();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void USkillsComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -44,8 +60,10 @@ void USkillsComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 
 void USkillsComponent::InitializeDefaultSkills()
 {
-    if (Skills.Num() > 0)
+    if (SkillRanking.Num() > 0)
         return; // Already initialized
+
+    ResetSkillStorage();
     
     // Initialize basic skills with starting values
     TArray<ESkillType> AllSkills = {
@@ -80,38 +98,134 @@ void USkillsComponent::InitializeDefaultSkills()
         SkillData.Modifier = 0.0f;
         SkillData.bIsLocked = false;
         
-        Skills.Add(SkillType, SkillData);
+        SetKnownSkill(SkillType, SkillData);
     }
     
+    RebuildSkillRanking();
+    RebuildSynergyBonuses();
     UpdateTotalSkillPoints();
     
     UE_LOG(LogTemp, Log, TEXT("%s initialized %d skills"), 
            OwnerCharacter ? *OwnerCharacter->GetName() : TEXT("Unknown"), 
-           Skills.Num());
+           SkillRanking.Num());
 }
 
 void USkillsComponent::GainSkillExperience(ESkillType SkillType, float ExperienceAmount)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
-    if (!SkillData || SkillData->bIsLocked)
+    const FSkillData* SkillData = FindSkill(SkillType);
+    if (!SkillData || SkillData->bIsLocked || ExperienceAmount == 0.0f)
         return;
     
-    float AdjustedExperience = ExperienceAmount * ExperienceGainMultiplier;
-    SkillData->Experience += AdjustedExperience;
-    SkillData->TotalExperience += AdjustedExperience; // Sync legacy field
+    // Accumulate - repeated grants in the same window cost one level evaluation
+    const int32 SkillIndex = (int32)SkillType;
+    if (PendingExperience[SkillIndex] == 0.0f && !PendingSkills.Contains(SkillType))
+    {
+        PendingSkills.Add(SkillType);
+    }
+    PendingExperience[SkillIndex] += ExperienceAmount;
     
-    float OldValue = SkillData->CurrentValue;
-    CalculateLevelFromExperience(*SkillData);
+    ScheduleExperienceFlush();
+}
+
+void USkillsComponent::ScheduleExperienceFlush()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        FlushSkillExperience();
+        return;
+    }
+    
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (TimerManager.TimerExists(ExperienceFlushHandle))
+        return;
+    
+    if (ExperienceBatchWindow > 0.0f)
+    {
+        TimerManager.SetTimer(ExperienceFlushHandle, this, &USkillsComponent::FlushSkillExperience, ExperienceBatchWindow, false);
+    }
+    else
+    {
+        ExperienceFlushHandle = TimerManager.SetTimerForNextTick(this, &USkillsComponent::FlushSkillExperience);
+    }
+}
+
+void USkillsComponent::FlushSkillExperience()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ExperienceFlushHandle);
+    }
+    
+    if (PendingSkills.Num() == 0)
+        return;
+    
+    TArray<ESkillType, TInlineAllocator<8>> SkillsToApply(PendingSkills);
+    PendingSkills.Reset();
+    
+    bool bAnyLevelChanged = false;
+    for (ESkillType SkillType : SkillsToApply)
+    {
+        float& Pending = PendingExperience[(int32)SkillType];
+        const float ExperienceAmount = Pending;
+        Pending = 0.0f;
+        
+        bAnyLevelChanged |= ApplySkillExperience(SkillType, ExperienceAmount);
+    }
     
-    if (SkillData->CurrentValue != OldValue)
+    // Totals and cap handling once per batch
+    if (bAnyLevelChanged)
     {
         UpdateTotalSkillPoints();
         
-        // Handle skill cap if needed
         if (bEnforceSkillCaps)
         {
             HandleSkillCap();
         }
+    }
+}
+
+float USkillsComponent::GetPendingSkillExperience(ESkillType SkillType) const
+{
+    const FSkillData* SkillData = FindSkill(SkillType);
+    if (!SkillData || SkillData->bIsLocked)
+        return 0.0f;
+    
+    return PendingExperience[(int32)SkillType] * ExperienceGainMultiplier * (1.0f + GetSynergyBonus(SkillType));
+}
+
+FSkillData USkillsComponent::GetProjectedSkillData(ESkillType SkillType, const FSkillData& SkillData) const
+{
+    FSkillData Result = SkillData;
+    
+    // Fold in the unflushed batch so readers never see stale experience or levels
+    const float PendingAmount = GetPendingSkillExperience(SkillType);
+    if (PendingAmount != 0.0f)
+    {
+        Result.Experience += PendingAmount;
+        Result.TotalExperience += PendingAmount;
+        CalculateLevelFromExperience(Result);
+    }
+    return Result;
+}
+
+bool USkillsComponent::ApplySkillExperience(ESkillType SkillType, float ExperienceAmount)
+{
+    FSkillData* SkillData = FindSkill(SkillType);
+    if (!SkillData || SkillData->bIsLocked)
+        return false;
+    
+    float AdjustedExperience = ExperienceAmount * ExperienceGainMultiplier * (1.0f + GetSynergyBonus(SkillType));
+    SkillData->Experience += AdjustedExperience;
+    SkillData->TotalExperience += AdjustedExperience; // Sync legacy field
+    
+    float OldValue = SkillData->CurrentValue;
+    CalculateLevelFromExperience(*SkillData);
+    
+    const bool bLevelChanged = SkillData->CurrentValue != OldValue;
+    if (bLevelChanged)
+    {
+        HandleSkillValueChanged(SkillType);
         
         // Broadcast skill level up
         OnSkillLevelUp.Broadcast(SkillType, SkillData->CurrentValue);
@@ -123,9 +237,11 @@ void USkillsComponent::GainSkillExperience(ESkillType SkillType, float Experienc
     
     // Always broadcast skill changed with experience
     BroadcastSkillChanged(SkillType);
+    
+    return bLevelChanged;
 }
 
-void USkillsComponent::CalculateLevelFromExperience(FSkillData& SkillData)
+void USkillsComponent::CalculateLevelFromExperience(FSkillData& SkillData) const
 {
     float RequiredExperience = CalculateExperienceForLevel(SkillData.CurrentValue + 1.0f);
     
@@ -166,27 +282,28 @@ void USkillsComponent::HandleSkillCap()
     // Fixed: Add the required parameter (CurrentTotalSkillPoints)
     OnSkillCapReached.Broadcast(CurrentTotalSkillPoints);
     
-    // Find the lowest skill that isn't locked and decay it
-    float LowestSkillValue = 100.0f;
+    // Find the lowest skill that isn't locked and decay it - walk the ranking from the bottom
     ESkillType LowestSkillType = ESkillType::OneHanded;
     
-    for (const auto& SkillPair : Skills)
+    for (int32 RankIndex = SkillRanking.Num() - 1; RankIndex >= 0; --RankIndex)
     {
-        if (!SkillPair.Value.bIsLocked && SkillPair.Value.CurrentValue < LowestSkillValue)
+        if (!FindSkill(SkillRanking[RankIndex])->bIsLocked)
         {
-            LowestSkillValue = SkillPair.Value.CurrentValue;
-            LowestSkillType = SkillPair.Key;
+            LowestSkillType = SkillRanking[RankIndex];
+            break;
         }
     }
     
     // Decay the lowest skill
-    FSkillData* LowestSkill = Skills.Find(LowestSkillType);
+    FSkillData* LowestSkill = FindSkill(LowestSkillType);
     if (LowestSkill && LowestSkill->CurrentValue > 0.0f)
     {
         LowestSkill->CurrentValue = FMath::Max(0.0f, LowestSkill->CurrentValue - 0.1f);
         LowestSkill->Experience = CalculateExperienceForLevel(LowestSkill->CurrentValue);
         LowestSkill->TotalExperience = LowestSkill->Experience; // Sync legacy field
         
+        HandleSkillValueChanged(LowestSkillType);
+        
         UE_LOG(LogTemp, Log, TEXT("%s skill %s decayed to %.1f due to skill cap"), 
                OwnerCharacter ? *OwnerCharacter->GetName() : TEXT("Unknown"),
                *UEnum::GetValueAsString(LowestSkillType), LowestSkill->CurrentValue);
@@ -199,15 +316,15 @@ void USkillsComponent::UpdateTotalSkillPoints()
 {
     CurrentTotalSkillPoints = 0.0f;
     
-    for (const auto& SkillPair : Skills)
+    for (ESkillType SkillType : SkillRanking)
     {
-        CurrentTotalSkillPoints += SkillPair.Value.CurrentValue;
+        CurrentTotalSkillPoints += FindSkill(SkillType)->CurrentValue;
     }
 }
 
 void USkillsComponent::BroadcastSkillChanged(ESkillType SkillType)
 {
-    if (const FSkillData* SkillData = Skills.Find(SkillType))
+    if (const FSkillData* SkillData = FindSkill(SkillType))
     {
         // Fixed: Add the required third parameter (Experience)
         OnSkillChanged.Broadcast(SkillType, SkillData->CurrentValue, SkillData->Experience);
@@ -216,7 +333,7 @@ void USkillsComponent::BroadcastSkillChanged(ESkillType SkillType)
 
 void USkillsComponent::SetSkillValue(ESkillType SkillType, float NewValue)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
+    FSkillData* SkillData = FindSkill(SkillType);
     if (!SkillData)
         return;
         
@@ -227,13 +344,14 @@ void USkillsComponent::SetSkillValue(ESkillType SkillType, float NewValue)
     SkillData->Experience = CalculateExperienceForLevel(NewValue);
     SkillData->TotalExperience = SkillData->Experience; // Sync legacy field
     
+    HandleSkillValueChanged(SkillType);
     UpdateTotalSkillPoints();
     BroadcastSkillChanged(SkillType);
 }
 
 void USkillsComponent::AddSkillModifier(ESkillType SkillType, float ModifierAmount)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
+    FSkillData* SkillData = FindSkill(SkillType);
     if (!SkillData)
         return;
         
@@ -244,7 +362,7 @@ void USkillsComponent::AddSkillModifier(ESkillType SkillType, float ModifierAmou
 
 void USkillsComponent::RemoveSkillModifier(ESkillType SkillType, float ModifierAmount)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
+    FSkillData* SkillData = FindSkill(SkillType);
     if (!SkillData)
         return;
         
@@ -255,7 +373,7 @@ void USkillsComponent::RemoveSkillModifier(ESkillType SkillType, float ModifierA
 
 void USkillsComponent::LockSkill(ESkillType SkillType, bool bLocked)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
+    FSkillData* SkillData = FindSkill(SkillType);
     if (!SkillData)
         return;
         
@@ -269,37 +387,41 @@ void USkillsComponent::LockSkill(ESkillType SkillType, bool bLocked)
 
 float USkillsComponent::GetSkillValue(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
-    return SkillData ? SkillData->CurrentValue : 0.0f;
+    const FSkillData* SkillData = FindSkill(SkillType);
+    return SkillData ? GetProjectedSkillData(SkillType, *SkillData).CurrentValue : 0.0f;
 }
 
 float USkillsComponent::GetEffectiveSkillValue(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
-    return SkillData ? SkillData->CurrentValue + SkillData->TemporaryModifier : 0.0f;
+    const FSkillData* SkillData = FindSkill(SkillType);
+    return SkillData ? GetProjectedSkillData(SkillType, *SkillData).CurrentValue + SkillData->TemporaryModifier : 0.0f;
 }
 
 float USkillsComponent::GetSkillExperience(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
-    return SkillData ? SkillData->Experience : 0.0f;
+    const FSkillData* SkillData = FindSkill(SkillType);
+    return SkillData ? SkillData->Experience + GetPendingSkillExperience(SkillType) : 0.0f;
 }
 
 float USkillsComponent::GetSkillProgress(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
-    if (!SkillData || SkillData->CurrentValue >= SkillData->MaxValue)
+    const FSkillData* StoredData = FindSkill(SkillType);
+    if (!StoredData)
+        return 1.0f;
+    
+    const FSkillData SkillData = GetProjectedSkillData(SkillType, *StoredData);
+    if (SkillData.CurrentValue >= SkillData.MaxValue)
         return 1.0f;
     
-    float CurrentLevelExp = CalculateExperienceForLevel(SkillData->CurrentValue);
-    float NextLevelExp = CalculateExperienceForLevel(SkillData->CurrentValue + 1.0f);
+    float CurrentLevelExp = CalculateExperienceForLevel(SkillData.CurrentValue);
+    float NextLevelExp = CalculateExperienceForLevel(SkillData.CurrentValue + 1.0f);
     
-    return FMath::Clamp((SkillData->Experience - CurrentLevelExp) / (NextLevelExp - CurrentLevelExp), 0.0f, 1.0f);
+    return FMath::Clamp((SkillData.Experience - CurrentLevelExp) / (NextLevelExp - CurrentLevelExp), 0.0f, 1.0f);
 }
 
 bool USkillsComponent::IsSkillLocked(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
+    const FSkillData* SkillData = FindSkill(SkillType);
     return SkillData ? SkillData->bIsLocked : false;
 }
 
@@ -310,7 +432,7 @@ float USkillsComponent::GetRemainingSkillPoints() const
 
 void USkillsComponent::ResetSkill(ESkillType SkillType)
 {
-    FSkillData* SkillData = Skills.Find(SkillType);
+    FSkillData* SkillData = FindSkill(SkillType);
     if (!SkillData)
         return;
     
@@ -321,6 +443,7 @@ void USkillsComponent::ResetSkill(ESkillType SkillType)
     SkillData->Modifier = 0.0f;
     SkillData->bIsLocked = false;
     
+    HandleSkillValueChanged(SkillType);
     UpdateTotalSkillPoints();
     BroadcastSkillChanged(SkillType);
     
@@ -385,11 +508,13 @@ ESkillType USkillsComponent::GameplayTagToSkillType(FGameplayTag SkillTag)
 
 void USkillsComponent::OnRep_Skills()
 {
+    RebuildSkillRanking();
+    RebuildSynergyBonuses();
     UpdateTotalSkillPoints();
     
     UE_LOG(LogTemp, Verbose, TEXT("%s skills replicated (%d skills, %.1f total points)"), 
            OwnerCharacter ? *OwnerCharacter->GetName() : TEXT("Unknown"),
-           Skills.Num(), CurrentTotalSkillPoints);
+           SkillRanking.Num(), CurrentTotalSkillPoints);
 }
 
 bool USkillsComponent::IsAtSkillCap() const
@@ -399,36 +524,17 @@ bool USkillsComponent::IsAtSkillCap() const
 
 TArray<ESkillType> USkillsComponent::GetHighestSkills(int32 Count) const
 {
-    TArray<TPair<ESkillType, float>> SkillValuePairs;
-    
-    // Create array of skill type/value pairs
-    for (const auto& SkillPair : Skills)
-    {
-        SkillValuePairs.Add(TPair<ESkillType, float>(SkillPair.Key, SkillPair.Value.CurrentValue));
-    }
-    
-    // Sort by skill value in descending order
-    SkillValuePairs.Sort([](const TPair<ESkillType, float>& A, const TPair<ESkillType, float>& B)
-    {
-        return A.Value > B.Value;
-    });
-    
-    // Extract the top N skill types
-    TArray<ESkillType> HighestSkills;
-    for (int32 i = 0; i < FMath::Min(Count, SkillValuePairs.Num()); ++i)
-    {
-        HighestSkills.Add(SkillValuePairs[i].Key);
-    }
-    
-    return HighestSkills;
+    // Ranking is kept sorted as levels change - just copy the prefix
+    const int32 NumSkills = FMath::Clamp(Count, 0, SkillRanking.Num());
+    return TArray<ESkillType>(SkillRanking.GetData(), NumSkills);
 }
 
 FSkillData USkillsComponent::GetSkillData(ESkillType SkillType) const
 {
-    const FSkillData* SkillData = Skills.Find(SkillType);
+    const FSkillData* SkillData = FindSkill(SkillType);
     if (SkillData)
     {
-        return *SkillData;
+        return GetProjectedSkillData(SkillType, *SkillData);
     }
     
     // Return default skill data if not found
@@ -454,7 +560,7 @@ void USkillsComponent::InitializeSkillsFromDataTable()
     }
     
     // Clear existing skills
-    Skills.Empty();
+    ResetSkillStorage();
     
     // Get all rows from the data table
     TArray<FName> RowNames = SkillDataTable->GetRowNames();
@@ -487,7 +593,7 @@ void USkillsComponent::InitializeSkillsFromDataTable()
             }
             
             // Add to skills map using the skill type from the table
-            Skills.Add(SkillRow->SkillType, SkillData);
+            SetKnownSkill(SkillRow->SkillType, SkillData);
             
             UE_LOG(LogTemp, Log, TEXT("Loaded skill %s from data table"), *UEnum::GetValueAsString(SkillRow->SkillType));
         }
@@ -498,25 +604,26 @@ void USkillsComponent::InitializeSkillsFromDataTable()
     }
     
     // If no skills were loaded from table, fall back to default initialization
-    if (Skills.Num() == 0)
+    if (SkillRanking.Num() == 0)
     {
         UE_LOG(LogTemp, Warning, TEXT("No skills loaded from data table, falling back to default initialization"));
         InitializeDefaultSkills();
         return;
     }
     
+    RebuildSynergyBonuses();
     UpdateTotalSkillPoints();
     
     UE_LOG(LogTemp, Log, TEXT("%s initialized %d skills from data table"), 
            OwnerCharacter ? *OwnerCharacter->GetName() : TEXT("Unknown"), 
-           Skills.Num());
+           SkillRanking.Num());
 }
 
 void USkillsComponent::ResetAllSkills()
 {
-    for (auto& SkillPair : Skills)
+    for (ESkillType SkillType : SkillRanking)
     {
-        FSkillData& SkillData = SkillPair.Value;
+        FSkillData& SkillData = *FindSkill(SkillType);
         
         // Reset to default starting values
         SkillData.CurrentValue = 5.0f; // Default starting value
@@ -527,11 +634,175 @@ void USkillsComponent::ResetAllSkills()
         SkillData.bIsLocked = false;
         
         // Broadcast change for each skill
-        BroadcastSkillChanged(SkillPair.Key);
+        BroadcastSkillChanged(SkillType);
     }
     
+    RebuildSkillRanking();
+    RebuildSynergyBonuses();
     UpdateTotalSkillPoints();
     
     UE_LOG(LogTemp, Log, TEXT("%s reset all skills to default values"), 
            OwnerCharacter ? *OwnerCharacter->GetName() : TEXT("Unknown"));
-}
\ No newline at end of file
+}
+
+FSkillData* USkillsComponent::FindSkill(ESkillType SkillType)
+{
+    const int32 SkillIndex = (int32)SkillType;
+    return KnownSkills.IsValidIndex(SkillIndex) && KnownSkills[SkillIndex] ? &Skills[SkillIndex] : nullptr;
+}
+
+const FSkillData* USkillsComponent::FindSkill(ESkillType SkillType) const
+{
+    const int32 SkillIndex = (int32)SkillType;
+    return KnownSkills.IsValidIndex(SkillIndex) && KnownSkills[SkillIndex] ? &Skills[SkillIndex] : nullptr;
+}
+
+void USkillsComponent::ResetSkillStorage()
+{
+    const int32 NumSkillTypes = (int32)ESkillType::MAX;
+
+    Skills.Reset();
+    Skills.SetNum(NumSkillTypes);
+    KnownSkills.Init(false, NumSkillTypes);
+    SkillRankPositions.Init(INDEX_NONE, NumSkillTypes);
+    SkillRanking.Reset();
+    PendingExperience.Init(0.0f, NumSkillTypes);
+    PendingSkills.Reset();
+}
+
+void USkillsComponent::SetKnownSkill(ESkillType SkillType, const FSkillData& SkillData)
+{
+    const int32 SkillIndex = (int32)SkillType;
+    if (!Skills.IsValidIndex(SkillIndex))
+        return;
+
+    Skills[SkillIndex] = SkillData;
+    Skills[SkillIndex].SkillType = SkillType;
+
+    if (!KnownSkills[SkillIndex])
+    {
+        KnownSkills[SkillIndex] = true;
+        SkillRankPositions[SkillIndex] = SkillRanking.Add(SkillType);
+    }
+
+    UpdateSkillRank(SkillType);
+}
+
+bool USkillsComponent::RanksAbove(ESkillType A, ESkillType B) const
+{
+    const float ValueA = Skills[(int32)A].CurrentValue;
+    const float ValueB = Skills[(int32)B].CurrentValue;
+    return ValueA != ValueB ? ValueA > ValueB : A < B;
+}
+
+void USkillsComponent::UpdateSkillRank(ESkillType SkillType)
+{
+    int32 Position = SkillRankPositions.IsValidIndex((int32)SkillType) ? SkillRankPositions[(int32)SkillType] : INDEX_NONE;
+    if (Position == INDEX_NONE)
+        return;
+
+    // Levels move a step at a time, so the skill only shifts a few places
+    while (Position > 0 && RanksAbove(SkillType, SkillRanking[Position - 1]))
+    {
+        SkillRanking[Position] = SkillRanking[Position - 1];
+        SkillRankPositions[(int32)SkillRanking[Position]] = Position;
+        --Position;
+    }
+
+    while (Position < SkillRanking.Num() - 1 && RanksAbove(SkillRanking[Position + 1], SkillType))
+    {
+        SkillRanking[Position] = SkillRanking[Position + 1];
+        SkillRankPositions[(int32)SkillRanking[Position]] = Position;
+        ++Position;
+    }
+
+    SkillRanking[Position] = SkillType;
+    SkillRankPositions[(int32)SkillType] = Position;
+}
+
+void USkillsComponent::RebuildSkillRanking()
+{
+    const int32 NumSkillTypes = (int32)ESkillType::MAX;
+
+    // Replicated arrays may arrive before the local storage is sized
+    if (Skills.Num() != NumSkillTypes || KnownSkills.Num() != NumSkillTypes)
+    {
+        Skills.SetNum(NumSkillTypes);
+        KnownSkills.SetNum(NumSkillTypes);
+    }
+
+    SkillRanking.Reset();
+    for (int32 SkillIndex = 0; SkillIndex < NumSkillTypes; ++SkillIndex)
+    {
+        if (KnownSkills[SkillIndex])
+        {
+            SkillRanking.Add((ESkillType)SkillIndex);
+        }
+    }
+
+    SkillRanking.Sort([this](ESkillType A, ESkillType B)
+    {
+        return RanksAbove(A, B);
+    });
+
+    SkillRankPositions.Init(INDEX_NONE, NumSkillTypes);
+    for (int32 Position = 0; Position < SkillRanking.Num(); ++Position)
+    {
+        SkillRankPositions[(int32)SkillRanking[Position]] = Position;
+    }
+}
+
+float USkillsComponent::GetSynergyBonus(ESkillType SkillType) const
+{
+    const int32 SkillIndex = (int32)SkillType;
+    return SynergyBonuses.IsValidIndex(SkillIndex) ? SynergyBonuses[SkillIndex] : 0.0f;
+}
+
+void USkillsComponent::SetSkillSynergies(const TArray<FSkillSynergy>& NewSynergies)
+{
+    SkillSynergies = NewSynergies;
+    SynergyGraph.Compile(SkillSynergies);
+    RebuildSynergyBonuses();
+}
+
+void USkillsComponent::HandleSkillValueChanged(ESkillType SkillType)
+{
+    UpdateSkillRank(SkillType);
+    RefreshSynergiesFrom(SkillType);
+}
+
+void USkillsComponent::RefreshSynergiesFrom(ESkillType SkillType)
+{
+    if (SynergyGraph.IsEmpty() || ActiveSynergyEdges.Num() != SynergyGraph.Edges.Num())
+        return;
+
+    // Committed value - synergies follow applied levels, not the pending batch
+    const FSkillData* SecondarySkill = FindSkill(SkillType);
+    const float SecondaryValue = SecondarySkill ? SecondarySkill->CurrentValue : 0.0f;
+
+    for (int32 EdgeIndex : SynergyGraph.GetEdgesFromSecondary(SkillType))
+    {
+        const FSkillSynergyGraph::FEdge& Edge = SynergyGraph.Edges[EdgeIndex];
+        const bool bActive = FindSkill(Edge.PrimarySkill) && SecondaryValue >= Edge.RequiredSecondaryLevel;
+
+        if (ActiveSynergyEdges[EdgeIndex] != bActive)
+        {
+            ActiveSynergyEdges[EdgeIndex] = bActive;
+            SynergyBonuses[(int32)Edge.PrimarySkill] += bActive ? Edge.Bonus : -Edge.Bonus;
+        }
+    }
+}
+
+void USkillsComponent::RebuildSynergyBonuses()
+{
+    SynergyBonuses.Init(0.0f, (int32)ESkillType::MAX);
+    ActiveSynergyEdges.Init(false, SynergyGraph.Edges.Num());
+
+    for (int32 SkillIndex = 0; SkillIndex < (int32)ESkillType::MAX; ++SkillIndex)
+    {
+        if (SynergyGraph.GetEdgesFromSecondary((ESkillType)SkillIndex).Num() > 0)
+        {
+            RefreshSynergiesFrom((ESkillType)SkillIndex);
+        }
+    }
+}
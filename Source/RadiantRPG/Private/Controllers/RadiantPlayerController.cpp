@@ -14,6 +14,7 @@
 // Game-specific includes
 #include "Characters/PlayerCharacter.h"
 #include "UI/RadiantHUD.h"
+#include "World/WorldEventFeedComponent.h"
 
 ARadiantPlayerController::ARadiantPlayerController()
 {
@@ -34,6 +35,9 @@ ARadiantPlayerController::ARadiantPlayerController()
     PossessedPlayerCharacter = nullptr;
     HUDWidget = nullptr;
     
+    // World event feed for this connection
+    WorldEventFeed = CreateDefaultSubobject<UWorldEventFeedComponent>(TEXT("WorldEventFeed"));
+    
     bHUDInitialized = false;
     bInputContextsInitialized = false;
     
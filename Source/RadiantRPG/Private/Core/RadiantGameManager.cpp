@@ -16,6 +16,8 @@
 #include "Stats/StatsHierarchical.h"
 #include "Types/SystemTypes.h"
 #include "World/RadiantWorldManager.h"
+#include "Characters/BaseCharacter.h"
+#include "Components/SkillsComponent.h"
 
 URadiantGameManager::URadiantGameManager()
 {
@@ -368,6 +370,9 @@ bool URadiantGameManager::SaveGame(const FString& SaveSlotName)
     
     UE_LOG(LogTemp, Log, TEXT("GameManager: Saving game to slot: %s"), *SlotName);
     
+    // Skill grants still inside their batch window belong in the save
+    FlushPendingSkillExperience();
+    
     // TODO: Implement save system
     // 1. Collect data from WorldManager (time, world state)
     // 2. Collect data from other systems
@@ -377,6 +382,23 @@ bool URadiantGameManager::SaveGame(const FString& SaveSlotName)
     return true;
 }
 
+void URadiantGameManager::FlushPendingSkillExperience()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+    
+    for (TActorIterator<ABaseCharacter> It(World); It; ++It)
+    {
+        if (USkillsComponent* Skills = It->GetSkillsComponent())
+        {
+            Skills->FlushSkillExperience();
+        }
+    }
+}
+
 bool URadiantGameManager::LoadGame(const FString& SaveSlotName)
 {
     UE_LOG(LogTemp, Log, TEXT("GameManager: Loading game from slot: %s"), *SaveSlotName);
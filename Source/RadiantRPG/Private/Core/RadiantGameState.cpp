@@ -4,6 +4,7 @@
 #include "Core/RadiantGameState.h"
 #include "Core/RadiantGameManager.h"
 #include "World/RadiantWorldManager.h"
+#include "Managers/FactionRegistry.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -50,6 +51,11 @@ void ARadiantGameState::BeginPlay()
     {
         InitializeWorldState();
     }
+    else
+    {
+        // Clients answer faction queries from their own copy of the registry
+        RegisterFactions();
+    }
 
     bGameStateInitialized = true;
     UE_LOG(LogTemp, Log, TEXT("RadiantGameState BeginPlay completed - %s"), 
@@ -60,6 +66,11 @@ void ARadiantGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UE_LOG(LogTemp, Log, TEXT("RadiantGameState EndPlay"));
     
+    if (UFactionRegistry* Registry = GetFactionRegistry())
+    {
+        Registry->OnFactionEvent.RemoveDynamic(this, &ARadiantGameState::HandleRegistryFactionEvent);
+    }
+
     // Clear references
     GameManager = nullptr;
     WorldManager = nullptr;
@@ -91,9 +102,6 @@ void ARadiantGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
     DOREPLIFETIME(ARadiantGameState, WorldTime);
     DOREPLIFETIME(ARadiantGameState, bTimeProgressionEnabled);
 
-    // Replicate world events
-    DOREPLIFETIME(ARadiantGameState, ActiveWorldEvents);
-
     // Replicate global state
     DOREPLIFETIME(ARadiantGameState, GlobalFlags);
     DOREPLIFETIME(ARadiantGameState, GlobalVariables);
@@ -101,6 +109,8 @@ void ARadiantGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 
     // Replicate faction data
     DOREPLIFETIME(ARadiantGameState, ActiveWars);
+    DOREPLIFETIME(ARadiantGameState, FactionStandings);
+    DOREPLIFETIME_CONDITION(ARadiantGameState, FactionDefinitions, COND_InitialOnly);
 }
 
 // === WORLD TIME INTERFACE (DELEGATED TO WORLDMANAGER) ===
@@ -273,6 +283,13 @@ void ARadiantGameState::StartWar(FGameplayTag FactionA, FGameplayTag FactionB)
     if (!ActiveWars.Contains(WarTag))
     {
         ActiveWars.Add(WarTag);
+
+        // Registered factions answer hostility queries from the registry - keep it in step
+        if (UFactionRegistry* Registry = GetFactionRegistry())
+        {
+            Registry->SetAtWar(Registry->FindFactionIDByTag(FactionA), Registry->FindFactionIDByTag(FactionB), true);
+        }
+
         OnFactionRelationshipChanged.Broadcast(FactionA, FactionB);
         OnFactionRelationshipChangedBP(FactionA, FactionB, -100.0f); // War = -100 relationship
 
@@ -298,6 +315,11 @@ void ARadiantGameState::EndWar(FGameplayTag FactionA, FGameplayTag FactionB)
 
     if (bWarEnded)
     {
+        if (UFactionRegistry* Registry = GetFactionRegistry())
+        {
+            Registry->SetAtWar(Registry->FindFactionIDByTag(FactionA), Registry->FindFactionIDByTag(FactionB), false);
+        }
+
         OnFactionRelationshipChanged.Broadcast(FactionA, FactionB);
         OnFactionRelationshipChangedBP(FactionA, FactionB, 0.0f); // Peace = neutral relationship
 
@@ -414,9 +436,139 @@ void ARadiantGameState::InitializeWorldState()
     GlobalStrings.Empty();
     ActiveWars.Empty();
 
+    RegisterFactions();
+
     UE_LOG(LogTemp, Log, TEXT("World state initialized - Time: %s"), *WorldTime.GetFullTimeString());
 }
 
+void ARadiantGameState::RegisterFactions()
+{
+    UFactionRegistry* Registry = GetFactionRegistry();
+    if (!Registry)
+    {
+        return;
+    }
+
+    // The registry outlives the world - start each world from the definitions
+    Registry->ResetRegistry();
+    Registry->RegisterFactions(FactionDefinitions);
+
+    if (!HasAuthority())
+    {
+        ApplyFactionStandings();
+        return;
+    }
+
+    for (int32 FactionA = 0; FactionA < Registry->GetNumFactions(); ++FactionA)
+    {
+        for (int32 FactionB = FactionA + 1; FactionB < Registry->GetNumFactions(); ++FactionB)
+        {
+            if (!Registry->AreAtWar(FactionA, FactionB))
+            {
+                continue;
+            }
+
+            const FGameplayTag TagA = Registry->GetFactionData(FactionA)->FactionTags.First();
+            const FGameplayTag TagB = Registry->GetFactionData(FactionB)->FactionTags.First();
+            if (TagA.IsValid() && TagB.IsValid())
+            {
+                StartWar(TagA, TagB);
+            }
+        }
+    }
+
+    RefreshFactionStandings();
+    Registry->OnFactionEvent.AddUniqueDynamic(this, &ARadiantGameState::HandleRegistryFactionEvent);
+}
+
+void ARadiantGameState::RefreshFactionStandings()
+{
+    UFactionRegistry* Registry = GetFactionRegistry();
+    if (!Registry || !HasAuthority())
+    {
+        return;
+    }
+
+    FactionStandings.Reset();
+    for (int32 FactionA = 0; FactionA < Registry->GetNumFactions(); ++FactionA)
+    {
+        for (int32 FactionB = FactionA + 1; FactionB < Registry->GetNumFactions(); ++FactionB)
+        {
+            const bool bAtWar = Registry->AreAtWar(FactionA, FactionB);
+            const bool bAllied = Registry->AreAllied(FactionA, FactionB);
+            if (bAtWar || bAllied)
+            {
+                FFactionPairStanding& Standing = FactionStandings.AddDefaulted_GetRef();
+                Standing.FactionA = Registry->GetFactionName(FactionA);
+                Standing.FactionB = Registry->GetFactionName(FactionB);
+                Standing.bAtWar = bAtWar;
+                Standing.bAllied = bAllied;
+            }
+        }
+    }
+}
+
+void ARadiantGameState::ApplyFactionStandings()
+{
+    UFactionRegistry* Registry = GetFactionRegistry();
+    if (!Registry || HasAuthority())
+    {
+        return;
+    }
+
+    const int32 NumFactions = Registry->GetNumFactions();
+    TArray<bool> Wars, Alliances;
+    Wars.Init(false, NumFactions * NumFactions);
+    Alliances.Init(false, NumFactions * NumFactions);
+
+    for (const FFactionPairStanding& Standing : FactionStandings)
+    {
+        const int32 FactionA = Registry->FindFactionID(Standing.FactionA);
+        const int32 FactionB = Registry->FindFactionID(Standing.FactionB);
+        if (FactionA == INDEX_NONE || FactionB == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const int32 Cell = FMath::Min(FactionA, FactionB) * NumFactions + FMath::Max(FactionA, FactionB);
+        Wars[Cell] = Standing.bAtWar;
+        Alliances[Cell] = Standing.bAllied;
+    }
+
+    // Every pair, so standings the server cleared are cleared here too. War first - it breaks alliances
+    for (int32 FactionA = 0; FactionA < NumFactions; ++FactionA)
+    {
+        for (int32 FactionB = FactionA + 1; FactionB < NumFactions; ++FactionB)
+        {
+            const int32 Cell = FactionA * NumFactions + FactionB;
+            Registry->SetAtWar(FactionA, FactionB, Wars[Cell]);
+            Registry->SetAlliance(FactionA, FactionB, Alliances[Cell]);
+        }
+    }
+}
+
+void ARadiantGameState::HandleRegistryFactionEvent(const FFactionEvent& Event)
+{
+    switch (Event.Payload.Kind)
+    {
+        case EFactionEventKind::WarDeclared:
+        case EFactionEventKind::PeaceMade:
+        case EFactionEventKind::AllianceFormed:
+        case EFactionEventKind::AllianceBroken:
+            RefreshFactionStandings();
+            break;
+
+        default:
+            break;
+    }
+}
+
+UFactionRegistry* ARadiantGameState::GetFactionRegistry() const
+{
+    const UGameInstance* GameInstance = GetGameInstance();
+    return GameInstance ? GameInstance->GetSubsystem<UFactionRegistry>() : nullptr;
+}
+
 void ARadiantGameState::UpdateWorldState(float DeltaTime)
 {
     // Sync time from WorldManager periodically
@@ -582,11 +734,6 @@ void ARadiantGameState::OnRep_WorldTime()
     UE_LOG(LogTemp, Verbose, TEXT("World time replicated: %s"), *WorldTime.GetFullTimeString());
 }
 
-void ARadiantGameState::OnRep_ActiveWorldEvents()
-{
-    UE_LOG(LogTemp, Verbose, TEXT("World events replicated: %d active events"), ActiveWorldEvents.Num());
-}
-
 void ARadiantGameState::OnRep_GlobalFlags()
 {
     UE_LOG(LogTemp, Verbose, TEXT("Global flags replicated: %d flags"), GlobalFlags.Num());
@@ -597,6 +744,15 @@ void ARadiantGameState::OnRep_ActiveWars()
     UE_LOG(LogTemp, Verbose, TEXT("Active wars replicated: %d wars"), ActiveWars.Num());
 }
 
+void ARadiantGameState::OnRep_FactionStandings()
+{
+    // Before BeginPlay the registry is not filled yet - RegisterFactions applies the standings then
+    if (bGameStateInitialized)
+    {
+        ApplyFactionStandings();
+    }
+}
+
 // === SERVER RPC IMPLEMENTATIONS ===
 
 void ARadiantGameState::ServerSetGlobalVariable_Implementation(const FString& VariableName, float Value)
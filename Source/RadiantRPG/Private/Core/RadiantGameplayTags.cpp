@@ -56,6 +56,19 @@ UE_DEFINE_GAMEPLAY_TAG(TAG_Faction_Wildlife, "Faction.Wildlife");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Faction_Hostile, "Faction.Hostile");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Faction_Player, "Faction.Player");
 
+// === FACTION EVENT TAGS ===
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent, "FactionEvent");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_WarDeclared, "FactionEvent.WarDeclared");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_PeaceMade, "FactionEvent.PeaceMade");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_AllianceFormed, "FactionEvent.AllianceFormed");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_AllianceBroken, "FactionEvent.AllianceBroken");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_TradeOpened, "FactionEvent.TradeOpened");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_TradeClosed, "FactionEvent.TradeClosed");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_RelationshipChanged, "FactionEvent.RelationshipChanged");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_TerritoryChanged, "FactionEvent.TerritoryChanged");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_MemberJoined, "FactionEvent.MemberJoined");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FactionEvent_MemberLeft, "FactionEvent.MemberLeft");
+
 // === AI INTENT TAGS ===
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI, "AI");
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent, "AI.Intent");
@@ -65,6 +78,7 @@ UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Idle, "AI.Intent.Idle");
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Wander, "AI.Intent.Wander");
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Patrol, "AI.Intent.Patrol");
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Guard, "AI.Intent.Guard");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Work, "AI.Intent.Work");
 
 // Survival Intents
 UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Intent_Survival, "AI.Intent.Survival");
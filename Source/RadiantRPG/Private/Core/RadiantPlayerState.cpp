@@ -7,6 +7,7 @@
 #include "AbilitySystemComponent.h"
 #include "GameplayAbilitySet.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "Components/PrimitiveComponent.h"
 #include "Types/SkillTypes.h"
 
@@ -29,6 +30,7 @@ ARadiantPlayerState::ARadiantPlayerState()
     TotalSkillCap = 700.0f; // UO-style total skill cap
     IndividualSkillCap = 100.0f; // Maximum value for any single skill
     ExperienceMultiplier = 1.0f;
+    ExperienceBatchWindow = 0.0f;
 
     // Initialize internal state
     CachedEffectiveLevel = 1;
@@ -70,6 +72,7 @@ void ARadiantPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // Update final playtime statistics
     if (HasAuthority())
     {
+        FlushSkillExperience();
         UpdatePlaytimeStatistics();
     }
 
@@ -136,8 +139,81 @@ void ARadiantPlayerState::AddSkillExperience(FGameplayTag SkillTag, float Experi
 
     // Apply experience multiplier
     float AdjustedExperience = ExperienceAmount * ExperienceMultiplier;
-    
-    ApplySkillExperience(SkillTag, AdjustedExperience);
+    if (AdjustedExperience == 0.0f)
+    {
+        return;
+    }
+
+    // Accumulate - grants from gathering, crafting and combat loops are applied together
+    PendingSkillExperience.FindOrAdd(SkillTag) += AdjustedExperience;
+    ScheduleSkillExperienceFlush();
+}
+
+void ARadiantPlayerState::ScheduleSkillExperienceFlush()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        FlushSkillExperience();
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (TimerManager.TimerExists(SkillExperienceFlushHandle))
+    {
+        return;
+    }
+
+    if (ExperienceBatchWindow > 0.0f)
+    {
+        TimerManager.SetTimer(SkillExperienceFlushHandle, this, &ARadiantPlayerState::FlushSkillExperience, ExperienceBatchWindow, false);
+    }
+    else
+    {
+        SkillExperienceFlushHandle = TimerManager.SetTimerForNextTick(this, &ARadiantPlayerState::FlushSkillExperience);
+    }
+}
+
+void ARadiantPlayerState::FlushSkillExperience()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(SkillExperienceFlushHandle);
+    }
+
+    if (PendingSkillExperience.Num() == 0)
+    {
+        return;
+    }
+
+    TMap<FGameplayTag, float> Pending = MoveTemp(PendingSkillExperience);
+    PendingSkillExperience.Reset();
+
+    struct FSkillValueChange
+    {
+        FGameplayTag SkillTag;
+        float OldValue;
+        float NewValue;
+    };
+    TArray<FSkillValueChange, TInlineAllocator<8>> Changes;
+
+    for (const TPair<FGameplayTag, float>& Grant : Pending)
+    {
+        const float OldValue = ApplySkillExperience(Grant.Key, Grant.Value);
+        const float NewValue = GetSkillValue(Grant.Key);
+        if (NewValue != OldValue)
+        {
+            Changes.Add({ Grant.Key, OldValue, NewValue });
+        }
+    }
+
+    // Derived values once per batch, then one notification per changed skill
+    UpdateCachedValues();
+
+    for (const FSkillValueChange& Change : Changes)
+    {
+        OnSkillChanged.Broadcast(Change.SkillTag, Change.OldValue, Change.NewValue);
+    }
 }
 
 void ARadiantPlayerState::SetSkillValue(FGameplayTag SkillTag, float NewValue)
@@ -158,7 +234,7 @@ void ARadiantPlayerState::SetSkillValue(FGameplayTag SkillTag, float NewValue)
     SkillData.CurrentExperience = CalculateSkillLevelFromExperience(NewValue);
 
     // Update replicated array
-    UpdateReplicatedSkillEntries();
+    UpdateReplicatedSkillEntry(SkillTag, SkillData);
 
     // Update cached values
     UpdateCachedValues();
@@ -338,7 +414,7 @@ void ARadiantPlayerState::UpdateCachedValues()
     }
 }
 
-void ARadiantPlayerState::ApplySkillExperience(FGameplayTag SkillTag, float ExperienceAmount)
+float ARadiantPlayerState::ApplySkillExperience(FGameplayTag SkillTag, float ExperienceAmount)
 {
     FSkillData& SkillData = SkillsCache.FindOrAdd(SkillTag);
     
@@ -351,20 +427,16 @@ void ARadiantPlayerState::ApplySkillExperience(FGameplayTag SkillTag, float Expe
     
     SkillData.CurrentValue = NewValue;
 
-    // Update replicated array
-    UpdateReplicatedSkillEntries();
-
-    // Update cached values
-    UpdateCachedValues();
+    // Update replicated entry in place
+    UpdateReplicatedSkillEntry(SkillTag, SkillData);
 
-    // Broadcast change
     if (NewValue != OldValue)
     {
-        OnSkillChanged.Broadcast(SkillTag, OldValue, NewValue);
-        
         UE_LOG(LogTemp, Log, TEXT("Skill %s gained %.1f experience (%.1f -> %.1f)"),
                *SkillTag.ToString(), ExperienceAmount, OldValue, NewValue);
     }
+
+    return OldValue;
 }
 
 void ARadiantPlayerState::GrantDefaultAbilities()
@@ -442,6 +514,28 @@ void ARadiantPlayerState::UpdateReplicatedSkillEntries()
     }
 }
 
+void ARadiantPlayerState::UpdateReplicatedSkillEntry(FGameplayTag SkillTag, const FSkillData& SkillData)
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    FSkillEntry* Entry = SkillEntries.FindByPredicate([&SkillTag](const FSkillEntry& Candidate)
+    {
+        return Candidate.SkillTag == SkillTag;
+    });
+
+    if (Entry)
+    {
+        Entry->SkillData = SkillData;
+    }
+    else
+    {
+        SkillEntries.Add(FSkillEntry(SkillTag, SkillData));
+    }
+}
+
 void ARadiantPlayerState::UpdateReplicatedFactionEntries()
 {
     if (!HasAuthority())
@@ -0,0 +1,233 @@
+// Private/Core/RadiantReplicationGraph.cpp
+
+#include "Core/RadiantReplicationGraph.h"
+#include "Characters/ARPG_BaseNPCCharacter.h"
+#include "Interaction/SimpleInteractable.h"
+#include "World/RadiantZoneManager.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/NetDriver.h"
+#include "UObject/UObjectIterator.h"
+
+// === CONNECTION NODE ===
+
+void URadiantReplicationGraphNode_ZoneForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+    // The base list is rebuilt each gather - it only holds this connection's own actors
+    ReplicationActorList.Reset();
+    ZoneActorList.Reset();
+
+    const URadiantReplicationGraph* Graph = CastChecked<URadiantReplicationGraph>(GetOuter());
+
+    for (const FNetViewer& Viewer : Params.Viewers)
+    {
+        if (Viewer.InViewer)
+        {
+            ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+        }
+
+        if (Viewer.ViewTarget)
+        {
+            ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+        }
+
+        if (const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer))
+        {
+            APawn* Pawn = PlayerController->GetPawn();
+            if (Pawn && Pawn != Viewer.ViewTarget)
+            {
+                ReplicationActorList.ConditionalAdd(Pawn);
+            }
+        }
+
+        for (const TWeakObjectPtr<ARadiantZoneManager>& ZonePtr : Graph->GetZoneActors())
+        {
+            ARadiantZoneManager* Zone = ZonePtr.Get();
+            if (Zone && Zone->IsLocationInZone(Viewer.ViewLocation))
+            {
+                ZoneActorList.ConditionalAdd(Zone);
+            }
+        }
+    }
+
+    Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+
+    if (ZoneActorList.Num() > 0)
+    {
+        Params.OutGatheredReplicationLists.AddReplicationActorList(ZoneActorList);
+    }
+}
+
+// === GRAPH ===
+
+void URadiantReplicationGraph::ResetGameWorldState()
+{
+    Super::ResetGameWorldState();
+
+    ZoneActors.Reset();
+}
+
+ERadiantClassRepNodeMapping URadiantReplicationGraph::GetMappingPolicy(const UClass* Class) const
+{
+    const ERadiantClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class);
+    return Policy ? *Policy : ERadiantClassRepNodeMapping::NotRouted;
+}
+
+void URadiantReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const
+{
+    const AActor* CDO = Class->GetDefaultObject<AActor>();
+    if (bSpatialize)
+    {
+        Info.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+    }
+
+    Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(CDO->GetNetUpdateFrequency());
+}
+
+void URadiantReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    // Explicit routes - subclasses inherit them through the class map
+    ClassRepNodePolicies.Set(AARPG_BaseNPCCharacter::StaticClass(), ERadiantClassRepNodeMapping::Spatialize_Dormancy);
+    ClassRepNodePolicies.Set(ASimpleInteractable::StaticClass(), ERadiantClassRepNodeMapping::Spatialize_Dormancy);
+    ClassRepNodePolicies.Set(ARadiantZoneManager::StaticClass(), ERadiantClassRepNodeMapping::ZoneForConnection);
+    ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), ERadiantClassRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(APlayerState::StaticClass(), ERadiantClassRepNodeMapping::NotRouted);
+    ClassRepNodePolicies.Set(APlayerController::StaticClass(), ERadiantClassRepNodeMapping::NotRouted);
+
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        const AActor* CDO = Cast<AActor>(Class->GetDefaultObject(false));
+        if (!CDO || !CDO->GetIsReplicated())
+        {
+            continue;
+        }
+
+        // Skip blueprint compile leftovers
+        if (Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+        {
+            continue;
+        }
+
+        ERadiantClassRepNodeMapping Mapping;
+        if (const ERadiantClassRepNodeMapping* Explicit = ClassRepNodePolicies.Get(Class))
+        {
+            Mapping = *Explicit;
+        }
+        else if (CDO->bOnlyRelevantToOwner)
+        {
+            Mapping = ERadiantClassRepNodeMapping::NotRouted;
+        }
+        else if (CDO->bAlwaysRelevant)
+        {
+            Mapping = ERadiantClassRepNodeMapping::RelevantAllConnections;
+        }
+        else
+        {
+            const USceneComponent* Root = CDO->GetRootComponent();
+            Mapping = Root && Root->Mobility == EComponentMobility::Static
+                ? ERadiantClassRepNodeMapping::Spatialize_Static
+                : ERadiantClassRepNodeMapping::Spatialize_Dynamic;
+        }
+
+        ClassRepNodePolicies.Set(Class, Mapping);
+
+        FClassReplicationInfo ClassInfo;
+        InitClassReplicationInfo(ClassInfo, Class, IsSpatialized(Mapping));
+        GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+    }
+}
+
+void URadiantReplicationGraph::InitGlobalGraphNodes()
+{
+    GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+    GridNode->CellSize = GridCellSize;
+    GridNode->SpatialBias = GridSpatialBias;
+    AddGlobalGraphNode(GridNode);
+
+    AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+    AddGlobalGraphNode(AlwaysRelevantNode);
+
+    UReplicationGraphNode_PlayerStateFrequencyLimiter* PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+    PlayerStateNode->TargetActorsPerFrame = PlayerStatesPerFrame;
+    AddGlobalGraphNode(PlayerStateNode);
+}
+
+void URadiantReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    Super::InitConnectionGraphNodes(RepGraphConnection);
+
+    URadiantReplicationGraphNode_ZoneForConnection* ConnectionNode = CreateNewNode<URadiantReplicationGraphNode_ZoneForConnection>();
+    AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+}
+
+void URadiantReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+        case ERadiantClassRepNodeMapping::RelevantAllConnections:
+            AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Static:
+            GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Dynamic:
+            GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Dormancy:
+            GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::ZoneForConnection:
+            ZoneActors.AddUnique(CastChecked<ARadiantZoneManager>(ActorInfo.Actor));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void URadiantReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+        case ERadiantClassRepNodeMapping::RelevantAllConnections:
+            AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Static:
+            GridNode->RemoveActor_Static(ActorInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Dynamic:
+            GridNode->RemoveActor_Dynamic(ActorInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::Spatialize_Dormancy:
+            GridNode->RemoveActor_Dormancy(ActorInfo);
+            break;
+
+        case ERadiantClassRepNodeMapping::ZoneForConnection:
+            ZoneActors.RemoveSwap(Cast<ARadiantZoneManager>(ActorInfo.Actor));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void URadiantReplicationGraph::SetActorNetUpdateFrequency(AActor* Actor, float Frequency)
+{
+    // The graph schedules from its own copy of the rate, not the actor's
+    if (FGlobalActorReplicationInfo* Info = GlobalActorReplicationInfoMap.Find(Actor))
+    {
+        Info->Settings.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(Frequency);
+    }
+}
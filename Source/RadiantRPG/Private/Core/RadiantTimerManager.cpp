@@ -0,0 +1,294 @@
+// Private/Core/RadiantTimerManager.cpp
+
+#include "Core/RadiantTimerManager.h"
+#include "Engine/World.h"
+
+// === TIMER WHEEL ===
+
+FRadiantTimerWheel::FRadiantTimerWheel(float InTickSeconds)
+    : TickSeconds(FMath::Max(InTickSeconds, KINDA_SMALL_NUMBER))
+{
+    for (int32& Head : SlotHeads)
+    {
+        Head = INDEX_NONE;
+    }
+}
+
+FRadiantTimerHandle FRadiantTimerWheel::SetTimer(FRadiantTimerDelegate Callback, float Rate, bool bLoop, float FirstDelay)
+{
+    if (!Callback.IsBound() || Rate <= 0.0f)
+    {
+        return FRadiantTimerHandle();
+    }
+
+    const int32 Index = Allocate();
+    FTimer& Timer = Timers[Index];
+    Timer.Callback = MoveTemp(Callback);
+    Timer.PeriodTicks = bLoop ? ToTicks(Rate) : 0;
+    Timer.ExpiryTick = CurrentTick + ToTicks(FirstDelay >= 0.0f ? FirstDelay : Rate);
+    Link(Index);
+
+    ++NumActive;
+
+    FRadiantTimerHandle Handle;
+    Handle.Index = Index;
+    Handle.Serial = Timer.Serial;
+    return Handle;
+}
+
+void FRadiantTimerWheel::ClearTimer(FRadiantTimerHandle& Handle)
+{
+    if (FindTimer(Handle))
+    {
+        Unlink(Handle.Index);
+        Release(Handle.Index);
+    }
+
+    Handle.Invalidate();
+}
+
+bool FRadiantTimerWheel::IsTimerActive(const FRadiantTimerHandle& Handle) const
+{
+    return FindTimer(Handle) != nullptr;
+}
+
+float FRadiantTimerWheel::GetTimerRemaining(const FRadiantTimerHandle& Handle) const
+{
+    const FTimer* Timer = FindTimer(Handle);
+    if (!Timer)
+    {
+        return -1.0f;
+    }
+
+    return FMath::Max((float)(Timer->ExpiryTick - CurrentTick) * TickSeconds - Accumulator, 0.0f);
+}
+
+void FRadiantTimerWheel::Advance(float DeltaSeconds)
+{
+    CallbacksLastAdvance = 0;
+    CascadedLastAdvance = 0;
+
+    Accumulator += FMath::Max(DeltaSeconds, 0.0f);
+
+    while (Accumulator >= TickSeconds)
+    {
+        Accumulator -= TickSeconds;
+        AdvanceTick();
+    }
+}
+
+void FRadiantTimerWheel::Reset()
+{
+    // Release rather than empty the pool so outstanding handles stay stale
+    for (int32 Index = 0; Index < Timers.Num(); ++Index)
+    {
+        if (Timers[Index].SlotIndex != INDEX_NONE)
+        {
+            Unlink(Index);
+            Release(Index);
+        }
+    }
+}
+
+void FRadiantTimerWheel::AdvanceTick()
+{
+    ++CurrentTick;
+
+    // Find the coarsest level whose block starts on this tick, then cascade from
+    // it downwards so timers can fall more than one level in a single tick
+    int32 TopLevel = 0;
+    while (TopLevel + 1 < NumLevels && (CurrentTick & ((1ull << (SlotBits * (TopLevel + 1))) - 1)) == 0)
+    {
+        ++TopLevel;
+    }
+
+    for (int32 Level = TopLevel; Level > 0; --Level)
+    {
+        Cascade(Level, (int32)((CurrentTick >> (SlotBits * Level)) & (SlotsPerLevel - 1)));
+    }
+
+    // Every timer in this level 0 slot is due now
+    int32& Head = SlotHeads[CurrentTick & (SlotsPerLevel - 1)];
+    while (Head != INDEX_NONE)
+    {
+        const int32 Index = Head;
+        Unlink(Index);
+
+        // Copy out before calling - callbacks may set or clear timers and grow the pool
+        FTimer& Timer = Timers[Index];
+        FRadiantTimerDelegate Callback;
+        const int32 Serial = Timer.Serial;
+
+        if (Timer.PeriodTicks > 0)
+        {
+            Callback = Timer.Callback;
+            Timer.ExpiryTick = CurrentTick + Timer.PeriodTicks;
+            Link(Index);
+        }
+        else
+        {
+            Callback = MoveTemp(Timer.Callback);
+            Release(Index);
+        }
+
+        ++CallbacksLastAdvance;
+
+        // Owner is gone - drop the timer instead of keeping it looping
+        if (!Callback.ExecuteIfBound())
+        {
+            FRadiantTimerHandle Handle;
+            Handle.Index = Index;
+            Handle.Serial = Serial;
+            ClearTimer(Handle);
+        }
+    }
+}
+
+void FRadiantTimerWheel::Cascade(int32 Level, int32 Slot)
+{
+    int32& Head = SlotHeads[Level * SlotsPerLevel + Slot];
+    int32 Index = Head;
+    Head = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Timers[Index].Next;
+        Timers[Index].SlotIndex = INDEX_NONE;
+        Link(Index);
+
+        ++CascadedLastAdvance;
+        Index = Next;
+    }
+}
+
+void FRadiantTimerWheel::Link(int32 Index)
+{
+    FTimer& Timer = Timers[Index];
+    const uint64 Expiry = FMath::Max(Timer.ExpiryTick, CurrentTick);
+
+    // Lowest level whose current block still contains the expiry
+    int32 Level = 0;
+    while (Level + 1 < NumLevels && (Expiry >> (SlotBits * (Level + 1))) != (CurrentTick >> (SlotBits * (Level + 1))))
+    {
+        ++Level;
+    }
+
+    const int32 Slot = (int32)((Expiry >> (SlotBits * Level)) & (SlotsPerLevel - 1));
+    const int32 SlotIndex = Level * SlotsPerLevel + Slot;
+
+    Timer.SlotIndex = SlotIndex;
+    Timer.Prev = INDEX_NONE;
+    Timer.Next = SlotHeads[SlotIndex];
+
+    if (Timer.Next != INDEX_NONE)
+    {
+        Timers[Timer.Next].Prev = Index;
+    }
+
+    SlotHeads[SlotIndex] = Index;
+}
+
+void FRadiantTimerWheel::Unlink(int32 Index)
+{
+    FTimer& Timer = Timers[Index];
+    if (Timer.SlotIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Timer.Prev != INDEX_NONE)
+    {
+        Timers[Timer.Prev].Next = Timer.Next;
+    }
+    else
+    {
+        SlotHeads[Timer.SlotIndex] = Timer.Next;
+    }
+
+    if (Timer.Next != INDEX_NONE)
+    {
+        Timers[Timer.Next].Prev = Timer.Prev;
+    }
+
+    Timer.SlotIndex = INDEX_NONE;
+    Timer.Prev = INDEX_NONE;
+    Timer.Next = INDEX_NONE;
+}
+
+int32 FRadiantTimerWheel::Allocate()
+{
+    if (FreeList.Num() > 0)
+    {
+        return FreeList.Pop();
+    }
+
+    return Timers.AddDefaulted();
+}
+
+void FRadiantTimerWheel::Release(int32 Index)
+{
+    FTimer& Timer = Timers[Index];
+    Timer.Callback.Unbind();
+    Timer.PeriodTicks = 0;
+
+    // Invalidates every outstanding handle to this entry
+    ++Timer.Serial;
+
+    FreeList.Add(Index);
+    --NumActive;
+}
+
+const FRadiantTimerWheel::FTimer* FRadiantTimerWheel::FindTimer(const FRadiantTimerHandle& Handle) const
+{
+    if (!Timers.IsValidIndex(Handle.Index))
+    {
+        return nullptr;
+    }
+
+    const FTimer& Timer = Timers[Handle.Index];
+    return Timer.Serial == Handle.Serial && Timer.SlotIndex != INDEX_NONE ? &Timer : nullptr;
+}
+
+uint64 FRadiantTimerWheel::ToTicks(float Seconds) const
+{
+    const uint64 Ticks = (uint64)FMath::Max(FMath::CeilToInt(Seconds / TickSeconds), 1);
+    return FMath::Min(Ticks, MaxDelayTicks);
+}
+
+// === SUBSYSTEM ===
+
+void URadiantTimerManager::Deinitialize()
+{
+    Wheel.Reset();
+
+    Super::Deinitialize();
+}
+
+bool URadiantTimerManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void URadiantTimerManager::Tick(float DeltaTime)
+{
+    Wheel.Advance(DeltaTime);
+
+    Stats.ActiveTimers = Wheel.GetNumTimers();
+    Stats.CallbacksLastFrame = Wheel.GetCallbacksLastAdvance();
+    Stats.CascadedLastFrame = Wheel.GetCascadedLastAdvance();
+    Stats.PeakCallbacksPerFrame = FMath::Max(Stats.PeakCallbacksPerFrame, Stats.CallbacksLastFrame);
+    Stats.PeakActiveTimers = FMath::Max(Stats.PeakActiveTimers, Stats.ActiveTimers);
+}
+
+TStatId URadiantTimerManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URadiantTimerManager, STATGROUP_Tickables);
+}
+
+void URadiantTimerManager::ResetPeakStats()
+{
+    Stats.PeakCallbacksPerFrame = 0;
+    Stats.PeakActiveTimers = Stats.ActiveTimers;
+}
@@ -10,11 +10,17 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Engine/CollisionProfile.h"
+#include "Net/UnrealNetwork.h"
 
 ASimpleInteractable::ASimpleInteractable()
 {
     PrimaryActorTick.bCanEverTick = false;
 
+    // Interaction state only changes on use - stay dormant and flush when it does
+    bReplicates = true;
+    NetDormancy = DORM_Initial;
+    SetNetUpdateFrequency(1.0f);
+
     // Create mesh component with explicit null check safety
     MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
     if (!MeshComponent)
@@ -387,6 +393,8 @@ bool ASimpleInteractable::OnInteract_Implementation(ABaseCharacter* InteractingC
         {
             bIsCurrentlyInteractable = false;
         }
+
+        FlushNetDormancy();
     }
     
     OnInteractionSuccessful(InteractingCharacter);
@@ -438,6 +446,8 @@ bool ASimpleInteractable::CanInteract_Implementation(ABaseCharacter* Interacting
 void ASimpleInteractable::SetInteractable(bool bNewInteractable)
 {
     bIsCurrentlyInteractable = bNewInteractable;
+    FlushNetDormancy();
+
     if (!bNewInteractable)
     {
         SetHighlight(false);
@@ -451,6 +461,16 @@ void ASimpleInteractable::ResetUseCount()
     {
         bIsCurrentlyInteractable = true;
     }
+
+    FlushNetDormancy();
+}
+
+void ASimpleInteractable::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ASimpleInteractable, bIsCurrentlyInteractable);
+    DOREPLIFETIME(ASimpleInteractable, CurrentUseCount);
 }
 
 void ASimpleInteractable::SetHighlight(bool bShouldHighlight)
@@ -0,0 +1,343 @@
+// Private/Managers/CraftingManager.cpp
+
+#include "Managers/CraftingManager.h"
+#include "Components/InventoryComponent.h"
+#include "Components/SkillsComponent.h"
+
+// === CRAFTABILITY TRACKER ===
+
+void UCraftabilityTracker::Initialize(UCraftingManager* InManager, UInventoryComponent* InInventory)
+{
+    Manager = InManager;
+    Inventory = InInventory;
+
+    if (InInventory)
+    {
+        InInventory->OnItemCountChanged.AddDynamic(this, &UCraftabilityTracker::HandleItemCountChanged);
+    }
+
+    RebuildAll();
+}
+
+void UCraftabilityTracker::Shutdown()
+{
+    if (UInventoryComponent* InventoryPtr = Inventory.Get())
+    {
+        InventoryPtr->OnItemCountChanged.RemoveDynamic(this, &UCraftabilityTracker::HandleItemCountChanged);
+    }
+
+    Inventory.Reset();
+    SatisfiedLines.Empty();
+    MissingLineCounts.Empty();
+}
+
+void UCraftabilityTracker::RebuildAll()
+{
+    if (!Manager)
+    {
+        return;
+    }
+
+    SatisfiedLines.Init(false, Manager->GetNumIngredientLines());
+
+    MissingLineCounts.SetNumUninitialized(Manager->GetNumRecipes());
+    for (int32 RecipeIndex = 0; RecipeIndex < MissingLineCounts.Num(); ++RecipeIndex)
+    {
+        MissingLineCounts[RecipeIndex] = Manager->GetRecipeLineCount(RecipeIndex);
+    }
+
+    // Only the items actually held can satisfy anything
+    const UInventoryComponent* InventoryPtr = Inventory.Get();
+    if (!InventoryPtr)
+    {
+        return;
+    }
+
+    for (const TPair<FName, int32>& ItemCount : InventoryPtr->GetItemCounts())
+    {
+        HandleItemCountChanged(ItemCount.Key, ItemCount.Value);
+    }
+}
+
+bool UCraftabilityTracker::HasIngredientsFor(int32 RecipeIndex) const
+{
+    return MissingLineCounts.IsValidIndex(RecipeIndex) && MissingLineCounts[RecipeIndex] == 0;
+}
+
+void UCraftabilityTracker::HandleItemCountChanged(FName ItemID, int32 NewCount)
+{
+    const TArray<FRecipeIngredientRef>* Refs = Manager ? Manager->FindIngredientRefs(ItemID) : nullptr;
+    if (!Refs)
+    {
+        return;
+    }
+
+    for (const FRecipeIngredientRef& Ref : *Refs)
+    {
+        SetLineSatisfied(Ref.RecipeIndex, Ref.LineIndex, NewCount >= Ref.RequiredQuantity);
+    }
+}
+
+void UCraftabilityTracker::SetLineSatisfied(int32 RecipeIndex, int32 LineIndex, bool bSatisfied)
+{
+    if (!SatisfiedLines.IsValidIndex(LineIndex) || SatisfiedLines[LineIndex] == bSatisfied)
+    {
+        return;
+    }
+
+    SatisfiedLines[LineIndex] = bSatisfied;
+    MissingLineCounts[RecipeIndex] += bSatisfied ? -1 : 1;
+}
+
+// === SUBSYSTEM LIFECYCLE ===
+
+void UCraftingManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogTemp, Log, TEXT("CraftingManager: Initializing crafting subsystem"));
+}
+
+void UCraftingManager::Deinitialize()
+{
+    for (UCraftabilityTracker* Tracker : Trackers)
+    {
+        if (Tracker)
+        {
+            Tracker->Shutdown();
+        }
+    }
+
+    Trackers.Empty();
+    ResetIndex();
+
+    UE_LOG(LogTemp, Log, TEXT("CraftingManager: Deinitializing crafting subsystem"));
+
+    Super::Deinitialize();
+}
+
+// === CONFIGURATION ===
+
+void UCraftingManager::InitializeRecipes(UDataTable* RecipeDataTable)
+{
+    if (!RecipeDataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CraftingManager: Invalid recipe data table provided"));
+        return;
+    }
+
+    ResetIndex();
+
+    RecipeDataTable->ForeachRow<FCraftingRecipe>(TEXT("LoadingRecipes"), [this](const FName& RowName, const FCraftingRecipe& Row)
+    {
+        FCraftingRecipe Recipe = Row;
+        if (Recipe.RecipeID.IsNone())
+        {
+            Recipe.RecipeID = RowName;
+        }
+        AddRecipe(Recipe);
+    });
+
+    // Recipe and line indices changed - existing trackers start over
+    for (UCraftabilityTracker* Tracker : Trackers)
+    {
+        if (Tracker)
+        {
+            Tracker->RebuildAll();
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CraftingManager: Indexed %d recipes (%d ingredient lines)"), Recipes.Num(), NumIngredientLines);
+}
+
+void UCraftingManager::ResetIndex()
+{
+    Recipes.Empty();
+    RecipeLookup.Empty();
+    StationIndex.Empty();
+    IngredientIndex.Empty();
+    OutputIndex.Empty();
+    RecipeLineCounts.Empty();
+    NumIngredientLines = 0;
+}
+
+void UCraftingManager::AddRecipe(const FCraftingRecipe& Recipe)
+{
+    if (RecipeLookup.Contains(Recipe.RecipeID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CraftingManager: Duplicate recipe %s ignored"), *Recipe.RecipeID.ToString());
+        return;
+    }
+
+    const int32 RecipeIndex = Recipes.Add(Recipe);
+    RecipeLookup.Add(Recipe.RecipeID, RecipeIndex);
+    StationIndex.FindOrAdd(Recipe.CraftingStation).Add(RecipeIndex);
+
+    // Collapse repeated ingredients into one line per item
+    TMap<FName, int32, TInlineSetAllocator<8>> Required;
+    for (const FItemStack& Ingredient : Recipe.RequiredStacks)
+    {
+        if (!Ingredient.ItemID.IsNone() && Ingredient.Quantity > 0)
+        {
+            Required.FindOrAdd(Ingredient.ItemID) += Ingredient.Quantity;
+        }
+    }
+
+    for (const TPair<FName, int32>& Line : Required)
+    {
+        FRecipeIngredientRef Ref;
+        Ref.RecipeIndex = RecipeIndex;
+        Ref.LineIndex = NumIngredientLines++;
+        Ref.RequiredQuantity = Line.Value;
+        IngredientIndex.FindOrAdd(Line.Key).Add(Ref);
+    }
+    RecipeLineCounts.Add(Required.Num());
+
+    for (const FItemStack& Output : Recipe.OutputStacks)
+    {
+        TArray<int32>& Producers = OutputIndex.FindOrAdd(Output.ItemID);
+        Producers.AddUnique(RecipeIndex);
+    }
+}
+
+// === INDEX QUERIES ===
+
+bool UCraftingManager::GetRecipe(FName RecipeID, FCraftingRecipe& OutRecipe) const
+{
+    const int32* RecipeIndex = RecipeLookup.Find(RecipeID);
+    if (!RecipeIndex)
+    {
+        return false;
+    }
+
+    OutRecipe = Recipes[*RecipeIndex];
+    return true;
+}
+
+TArray<FName> UCraftingManager::GetRecipesForStation(FGameplayTag Station) const
+{
+    TArray<FName> Result;
+    AppendRecipeIDs(StationIndex.Find(Station), Result);
+    return Result;
+}
+
+TArray<FName> UCraftingManager::GetRecipesUsingIngredient(FName ItemID) const
+{
+    TArray<FName> Result;
+    if (const TArray<FRecipeIngredientRef>* Refs = IngredientIndex.Find(ItemID))
+    {
+        Result.Reserve(Refs->Num());
+        for (const FRecipeIngredientRef& Ref : *Refs)
+        {
+            Result.Add(Recipes[Ref.RecipeIndex].RecipeID);
+        }
+    }
+    return Result;
+}
+
+TArray<FName> UCraftingManager::GetRecipesProducing(FName ItemID) const
+{
+    TArray<FName> Result;
+    AppendRecipeIDs(OutputIndex.Find(ItemID), Result);
+    return Result;
+}
+
+void UCraftingManager::AppendRecipeIDs(const TArray<int32>* Indices, TArray<FName>& OutIDs) const
+{
+    if (!Indices)
+    {
+        return;
+    }
+
+    OutIDs.Reserve(OutIDs.Num() + Indices->Num());
+    for (int32 RecipeIndex : *Indices)
+    {
+        OutIDs.Add(Recipes[RecipeIndex].RecipeID);
+    }
+}
+
+// === CRAFTABILITY ===
+
+void UCraftingManager::TrackInventory(UInventoryComponent* Inventory)
+{
+    GetTracker(Inventory);
+}
+
+void UCraftingManager::UntrackInventory(UInventoryComponent* Inventory)
+{
+    for (int32 TrackerIndex = Trackers.Num() - 1; TrackerIndex >= 0; --TrackerIndex)
+    {
+        UCraftabilityTracker* Tracker = Trackers[TrackerIndex];
+        if (!Tracker || !Tracker->GetInventory() || Tracker->GetInventory() == Inventory)
+        {
+            if (Tracker)
+            {
+                Tracker->Shutdown();
+            }
+            Trackers.RemoveAtSwap(TrackerIndex);
+        }
+    }
+}
+
+UCraftabilityTracker* UCraftingManager::GetTracker(UInventoryComponent* Inventory)
+{
+    if (!Inventory)
+    {
+        return nullptr;
+    }
+
+    for (UCraftabilityTracker* Tracker : Trackers)
+    {
+        if (Tracker && Tracker->GetInventory() == Inventory)
+        {
+            return Tracker;
+        }
+    }
+
+    UCraftabilityTracker* Tracker = NewObject<UCraftabilityTracker>(this);
+    Tracker->Initialize(this, Inventory);
+    Trackers.Add(Tracker);
+    return Tracker;
+}
+
+TArray<FName> UCraftingManager::GetCraftableRecipes(UInventoryComponent* Inventory, FGameplayTag Station, USkillsComponent* Skills)
+{
+    TArray<FName> Result;
+
+    const UCraftabilityTracker* Tracker = GetTracker(Inventory);
+    const TArray<int32>* StationRecipes = StationIndex.Find(Station);
+    if (!Tracker || !StationRecipes)
+    {
+        return Result;
+    }
+
+    for (int32 RecipeIndex : *StationRecipes)
+    {
+        if (Tracker->HasIngredientsFor(RecipeIndex) && MeetsSkillRequirement(RecipeIndex, Skills))
+        {
+            Result.Add(Recipes[RecipeIndex].RecipeID);
+        }
+    }
+
+    return Result;
+}
+
+bool UCraftingManager::CanCraft(UInventoryComponent* Inventory, FName RecipeID, USkillsComponent* Skills)
+{
+    const int32* RecipeIndex = RecipeLookup.Find(RecipeID);
+    const UCraftabilityTracker* Tracker = GetTracker(Inventory);
+
+    return RecipeIndex && Tracker && Tracker->HasIngredientsFor(*RecipeIndex) && MeetsSkillRequirement(*RecipeIndex, Skills);
+}
+
+bool UCraftingManager::MeetsSkillRequirement(int32 RecipeIndex, const USkillsComponent* Skills) const
+{
+    const FCraftingRecipe& Recipe = Recipes[RecipeIndex];
+    if (!Skills || !Recipe.RequiredSkill.IsValid() || Recipe.RequiredSkillLevel <= 0.0f)
+    {
+        return true;
+    }
+
+    const ESkillType SkillType = USkillsComponent::GameplayTagToSkillType(Recipe.RequiredSkill);
+    return Skills->GetEffectiveSkillValue(SkillType) >= Recipe.RequiredSkillLevel;
+}
@@ -38,16 +38,17 @@ void UEconomyManager::InitializeEconomy(UDataTable* GoodsDataTable, UDataTable*
         return;
     }
 
-    // Load goods data
+    // Load goods data - each good gets its compact index here, once
     TArray<FGoodsData*> GoodsRows;
     GoodsDataTable->GetAllRows<FGoodsData>(TEXT("LoadingGoodsData"), GoodsRows);
     
-    GoodsData.Empty();
+    Goods.Empty(GoodsRows.Num());
+    GoodsIndices.Empty(GoodsRows.Num());
     for (const FGoodsData* Row : GoodsRows)
     {
-        if (Row && Row->GoodsID != NAME_None)
+        if (Row && Row->GoodsID != NAME_None && !GoodsIndices.Contains(Row->GoodsID))
         {
-            GoodsData.Add(Row->GoodsID, *Row);
+            GoodsIndices.Add(Row->GoodsID, Goods.Add(*Row));
         }
     }
 
@@ -56,18 +57,29 @@ void UEconomyManager::InitializeEconomy(UDataTable* GoodsDataTable, UDataTable*
     ZoneEconomicDataTable->GetAllRows<FZoneEconomicData>(TEXT("LoadingZoneData"), ZoneRows);
     
     ZoneEconomicData.Empty();
+    for (TArray<FMarketData>& Markets : ZoneMarkets)
+    {
+        Markets.Empty();
+    }
+    for (TArray<FMarketOrders>& Orders : ZoneOrders)
+    {
+        Orders.Empty();
+    }
+    QueuedMarkets.Reset();
+
     for (const FZoneEconomicData* Row : ZoneRows)
     {
         if (Row && Row->ZoneTag.IsValid())
         {
             ZoneEconomicData.Add(Row->ZoneTag, *Row);
-            InitializeZoneMarkets(Row->ZoneTag);
+            InitializeZoneMarkets(*Row);
         }
     }
 
+    bFlowLinesDirty = true;
     bIsInitialized = true;
     LogEconomyDebug(FString::Printf(TEXT("Economy initialized with %d goods and %d zones"), 
-                                  GoodsData.Num(), ZoneEconomicData.Num()));
+                                  Goods.Num(), ZoneEconomicData.Num()));
 }
 
 void UEconomyManager::StartEconomicSimulation()
@@ -125,6 +137,9 @@ void UEconomyManager::StopEconomicSimulation()
         return;
     }
 
+    // Trades settle immediately from here on, so flush what is still queued
+    ClearOrderBook();
+
     UWorld* World = GetWorld();
     if (World)
     {
@@ -147,6 +162,11 @@ void UEconomyManager::ConfigureSimulation(const FEconomySimulationConfig& Config
 
     SimulationConfig = Config;
 
+    for (int32 Index = 0; Index < ZoneTags.Num(); ++Index)
+    {
+        UpdatePopulationScale(Index);
+    }
+
     if (bWasRunning)
     {
         StartEconomicSimulation();
@@ -157,179 +177,203 @@ void UEconomyManager::ConfigureSimulation(const FEconomySimulationConfig& Config
 
 // === IECONOMYINTERFACE IMPLEMENTATION ===
 
+
 int32 UEconomyManager::GetGoodsPrice_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag) const
 {
-    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
-    {
-        return 0;
-    }
+    return GetGoodsPriceByIndex(ResolveGoodsIndex(GoodsID), ZoneTag);
+}
+
+bool UEconomyManager::AreGoodsAvailable_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag, int32 Quantity) const
+{
+    return AreGoodsAvailableByIndex(ResolveGoodsIndex(GoodsID), ZoneTag, Quantity);
+}
 
-    const FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
+EMarketDemand UEconomyManager::GetGoodsDemand_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag) const
+{
+    const FMarketData* MarketData = FindMarket(ZoneTag, ResolveGoodsIndex(GoodsID));
     if (!MarketData)
     {
-        // Return base price if no market data
-        const FGoodsData* Goods = FindGoodsData(GoodsID);
-        return Goods ? Goods->BaseValue : 0;
+        return EMarketDemand::Normal;
     }
 
-    return MarketData->CurrentPrice;
+    return MarketData->CalculateDemandLevel();
 }
 
-bool UEconomyManager::AreGoodsAvailable_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag, int32 Quantity) const
+bool UEconomyManager::BuyGoods_Implementation(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost)
 {
-    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
+    return BuyGoodsByIndex(ResolveGoodsIndex(GoodsID), Quantity, ZoneTag, TotalCost);
+}
+
+bool UEconomyManager::SellGoods_Implementation(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue)
+{
+    return SellGoodsByIndex(ResolveGoodsIndex(GoodsID), Quantity, ZoneTag, TotalRevenue);
+}
+
+TArray<FName> UEconomyManager::GetAvailableGoods_Implementation(const FGameplayTag& ZoneTag) const
+{
+    TArray<FName> AvailableGoods;
+    
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    if (!ZoneIndex)
     {
-        return false;
+        return AvailableGoods;
     }
 
-    const FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (!MarketData)
+    const TArray<FMarketData>& Markets = ZoneMarkets[*ZoneIndex];
+    for (int32 GoodsIndex = 0; GoodsIndex < Markets.Num(); ++GoodsIndex)
     {
-        return false;
+        if (GetAvailableSupply(*ZoneIndex, GoodsIndex) > 0)
+        {
+            AvailableGoods.Add(Goods[GoodsIndex].GoodsID);
+        }
     }
 
-    return MarketData->Supply >= Quantity;
+    return AvailableGoods;
 }
 
-EMarketDemand UEconomyManager::GetGoodsDemand_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag) const
+FMarketData UEconomyManager::GetMarketData_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag) const
+{
+    return GetMarketDataByIndex(ResolveGoodsIndex(GoodsID), ZoneTag);
+}
+
+FZoneEconomicData UEconomyManager::GetZoneEconomicData_Implementation(const FGameplayTag& ZoneTag) const
 {
     const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
     if (!ZoneData)
     {
-        return EMarketDemand::Normal;
+        return FZoneEconomicData();
     }
 
-    const FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (!MarketData)
+    // Live markets are held by index - rebuild the keyed view for callers
+    FZoneEconomicData Result = *ZoneData;
+    Result.Markets.Reset();
+
+    if (const int32* ZoneIndex = ZoneIndices.Find(ZoneTag))
     {
-        return EMarketDemand::Normal;
+        const TArray<FMarketData>& Markets = ZoneMarkets[*ZoneIndex];
+        for (int32 GoodsIndex = 0; GoodsIndex < Markets.Num(); ++GoodsIndex)
+        {
+            Result.Markets.Add(Goods[GoodsIndex].GoodsID, Markets[GoodsIndex]);
+        }
     }
 
-    return MarketData->CalculateDemandLevel();
+    return Result;
 }
 
-bool UEconomyManager::BuyGoods_Implementation(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost)
+// === GOODS INDEX FAST PATHS ===
+
+int32 UEconomyManager::ResolveGoodsIndex(const FName& GoodsID) const
+{
+    const int32* GoodsIndex = GoodsIndices.Find(GoodsID);
+    return GoodsIndex ? *GoodsIndex : INDEX_NONE;
+}
+
+FName UEconomyManager::GetGoodsName(int32 GoodsIndex) const
+{
+    return Goods.IsValidIndex(GoodsIndex) ? Goods[GoodsIndex].GoodsID : NAME_None;
+}
+
+int32 UEconomyManager::GetGoodsPriceByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const
+{
+    const FMarketData* MarketData = FindMarket(ZoneTag, GoodsIndex);
+    return MarketData ? MarketData->CurrentPrice : 0;
+}
+
+bool UEconomyManager::AreGoodsAvailableByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag, int32 Quantity) const
+{
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    return ZoneIndex && ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex) && GetAvailableSupply(*ZoneIndex, GoodsIndex) >= Quantity;
+}
+
+bool UEconomyManager::BuyGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost)
 {
     TotalCost = 0;
-    
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
+
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    if (!ZoneIndex || !ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex) || Quantity <= 0)
     {
         return false;
     }
 
-    FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (!MarketData || MarketData->Supply < Quantity)
+    // Sells queued this tick can cover the buy
+    if (GetAvailableSupply(*ZoneIndex, GoodsIndex) < Quantity)
     {
         return false;
     }
 
-    TotalCost = MarketData->CurrentPrice * Quantity;
-    MarketData->Supply -= Quantity;
-    MarketData->LastTransactionTime = GetWorld()->GetTimeSeconds();
+    FMarketData& MarketData = ZoneMarkets[*ZoneIndex][GoodsIndex];
+    TotalCost = MarketData.CurrentPrice * Quantity;
+    MarketData.LastTransactionTime = GetWorld()->GetTimeSeconds();
+
+    FMarketOrders& Orders = ZoneOrders[*ZoneIndex][GoodsIndex];
+    Orders.BuyQuantity += Quantity;
 
     // Increase demand slightly after purchase
-    MarketData->Demand += FMath::Max(1, Quantity / 4);
+    Orders.DemandDelta += FMath::Max(1, Quantity / 4);
+
+    if (!bIsSimulationRunning)
+    {
+        SettleOrders(*ZoneIndex, GoodsIndex);
+    }
+    else if (!Orders.bQueued)
+    {
+        Orders.bQueued = true;
+        QueuedMarkets.Add(FIntPoint(*ZoneIndex, GoodsIndex));
+    }
 
     LogEconomyDebug(FString::Printf(TEXT("Sold %d %s for %d copper in %s"), 
-                                  Quantity, *GoodsID.ToString(), TotalCost, *ZoneTag.ToString()));
+                                  Quantity, *Goods[GoodsIndex].GoodsID.ToString(), TotalCost, *ZoneTag.ToString()));
 
     return true;
 }
 
-bool UEconomyManager::SellGoods_Implementation(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue)
+bool UEconomyManager::SellGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue)
 {
     TotalRevenue = 0;
-    
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
+
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    if (!ZoneIndex || !ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex) || Quantity <= 0)
     {
         return false;
     }
 
-    FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (!MarketData)
-    {
-        // Create market data if it doesn't exist
-        const FGoodsData* Goods = FindGoodsData(GoodsID);
-        if (!Goods)
-        {
-            return false;
-        }
-
-        FMarketData NewMarket;
-        NewMarket.CurrentPrice = Goods->BaseValue;
-        NewMarket.AveragePrice = Goods->BaseValue;
-        ZoneData->Markets.Add(GoodsID, NewMarket);
-        MarketData = ZoneData->Markets.Find(GoodsID);
-    }
+    FMarketData& MarketData = ZoneMarkets[*ZoneIndex][GoodsIndex];
+    TotalRevenue = MarketData.CurrentPrice * Quantity;
+    MarketData.LastTransactionTime = GetWorld()->GetTimeSeconds();
 
-    TotalRevenue = MarketData->CurrentPrice * Quantity;
-    MarketData->Supply += Quantity;
-    MarketData->LastTransactionTime = GetWorld()->GetTimeSeconds();
+    FMarketOrders& Orders = ZoneOrders[*ZoneIndex][GoodsIndex];
+    Orders.SellQuantity += Quantity;
 
     // Decrease demand slightly after sale
-    MarketData->Demand = FMath::Max(0, MarketData->Demand - FMath::Max(1, Quantity / 4));
-
-    LogEconomyDebug(FString::Printf(TEXT("Bought %d %s for %d copper from %s"), 
-                                  Quantity, *GoodsID.ToString(), TotalRevenue, *ZoneTag.ToString()));
+    Orders.DemandDelta -= FMath::Max(1, Quantity / 4);
 
-    return true;
-}
-
-TArray<FName> UEconomyManager::GetAvailableGoods_Implementation(const FGameplayTag& ZoneTag) const
-{
-    TArray<FName> AvailableGoods;
-    
-    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
+    if (!bIsSimulationRunning)
     {
-        return AvailableGoods;
+        SettleOrders(*ZoneIndex, GoodsIndex);
     }
-
-    for (const auto& MarketPair : ZoneData->Markets)
+    else if (!Orders.bQueued)
     {
-        if (MarketPair.Value.Supply > 0)
-        {
-            AvailableGoods.Add(MarketPair.Key);
-        }
+        Orders.bQueued = true;
+        QueuedMarkets.Add(FIntPoint(*ZoneIndex, GoodsIndex));
     }
 
-    return AvailableGoods;
-}
-
-FMarketData UEconomyManager::GetMarketData_Implementation(const FName& GoodsID, const FGameplayTag& ZoneTag) const
-{
-    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
-    {
-        return FMarketData();
-    }
+    LogEconomyDebug(FString::Printf(TEXT("Bought %d %s for %d copper from %s"), 
+                                  Quantity, *Goods[GoodsIndex].GoodsID.ToString(), TotalRevenue, *ZoneTag.ToString()));
 
-    const FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    return MarketData ? *MarketData : FMarketData();
+    return true;
 }
 
-FZoneEconomicData UEconomyManager::GetZoneEconomicData_Implementation(const FGameplayTag& ZoneTag) const
+FMarketData UEconomyManager::GetMarketDataByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const
 {
-    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    return ZoneData ? *ZoneData : FZoneEconomicData();
+    const FMarketData* MarketData = FindMarket(ZoneTag, GoodsIndex);
+    return MarketData ? *MarketData : FMarketData();
 }
 
 // === MARKET MANIPULATION ===
 
 void UEconomyManager::AddSupply(const FName& GoodsID, const FGameplayTag& ZoneTag, int32 Amount)
 {
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
-    {
-        return;
-    }
-
-    FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (MarketData)
+    if (FMarketData* MarketData = FindMarket(ZoneTag, ResolveGoodsIndex(GoodsID)))
     {
         MarketData->Supply += Amount;
         LogEconomyDebug(FString::Printf(TEXT("Added %d supply of %s to %s"), 
@@ -339,14 +383,7 @@ void UEconomyManager::AddSupply(const FName& GoodsID, const FGameplayTag& ZoneTa
 
 void UEconomyManager::AddDemand(const FName& GoodsID, const FGameplayTag& ZoneTag, int32 Amount)
 {
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
-    {
-        return;
-    }
-
-    FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    if (MarketData)
+    if (FMarketData* MarketData = FindMarket(ZoneTag, ResolveGoodsIndex(GoodsID)))
     {
         MarketData->Demand += Amount;
         LogEconomyDebug(FString::Printf(TEXT("Added %d demand of %s to %s"), 
@@ -356,26 +393,12 @@ void UEconomyManager::AddDemand(const FName& GoodsID, const FGameplayTag& ZoneTa
 
 void UEconomyManager::UpdateGoodsPrice(const FName& GoodsID, const FGameplayTag& ZoneTag)
 {
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
-    {
-        return;
-    }
-
-    FMarketData* MarketData = ZoneData->Markets.Find(GoodsID);
-    const FGoodsData* Goods = FindGoodsData(GoodsID);
-    
-    if (!MarketData || !Goods)
-    {
-        return;
-    }
-
-    int32 OldPrice = MarketData->CurrentPrice;
-    MarketData->CurrentPrice = CalculatePrice(GoodsID, *MarketData, *Goods);
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    const int32 GoodsIndex = ResolveGoodsIndex(GoodsID);
 
-    if (FMath::Abs(OldPrice - MarketData->CurrentPrice) > 0)
+    if (ZoneIndex && ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex))
     {
-        OnPriceChanged.Broadcast(GoodsID, ZoneTag, OldPrice, MarketData->CurrentPrice);
+        UpdateMarketPrice(*ZoneIndex, GoodsIndex);
     }
 }
 
@@ -389,7 +412,11 @@ bool UEconomyManager::RegisterZone(const FZoneEconomicData& ZoneData)
     }
 
     ZoneEconomicData.Add(ZoneData.ZoneTag, ZoneData);
-    InitializeZoneMarkets(ZoneData.ZoneTag);
+    InitializeZoneMarkets(ZoneData);
+
+    // Population may have been pushed before the zone's data arrived
+    UpdatePopulationScale(FindOrAddZoneIndex(ZoneData.ZoneTag));
+    bFlowLinesDirty = true;
 
     LogEconomyDebug(FString::Printf(TEXT("Registered economic zone: %s"), *ZoneData.ZoneTag.ToString()));
     return true;
@@ -399,6 +426,11 @@ void UEconomyManager::UnregisterZone(const FGameplayTag& ZoneTag)
 {
     if (ZoneEconomicData.Remove(ZoneTag) > 0)
     {
+        // Keep the dense slot - live inputs may still arrive for the zone
+        const int32 ZoneIndex = ZoneIndices.FindChecked(ZoneTag);
+        ZoneMarkets[ZoneIndex].Empty();
+        ZoneOrders[ZoneIndex].Empty();
+        bFlowLinesDirty = true;
         LogEconomyDebug(FString::Printf(TEXT("Unregistered economic zone: %s"), *ZoneTag.ToString()));
     }
 }
@@ -412,57 +444,274 @@ void UEconomyManager::UpdateZoneProduction(const FGameplayTag& ZoneTag, const TM
     }
 
     ZoneData->ProducedGoods = ProductionRates;
+    bFlowLinesDirty = true;
     LogEconomyDebug(FString::Printf(TEXT("Updated production rates for zone: %s"), *ZoneTag.ToString()));
 }
 
+// === ZONE INPUTS ===
+
+int32 UEconomyManager::FindOrAddZoneIndex(const FGameplayTag& ZoneTag)
+{
+    if (const int32* Existing = ZoneIndices.Find(ZoneTag))
+    {
+        return *Existing;
+    }
+
+    const int32 Index = ZoneTags.Add(ZoneTag);
+    ZoneResidentNPCs.Add(0);
+    ZoneHasLivePopulation.Add(false);
+    ZonePopulationScales.Add(1.0f);
+    ZoneMarkets.AddDefaulted();
+    ZoneOrders.AddDefaulted();
+    ZoneIndices.Add(ZoneTag, Index);
+
+    bFlowLinesDirty = true;
+    return Index;
+}
+
+void UEconomyManager::UpdatePopulationScale(int32 ZoneIndex)
+{
+    // Unloaded zones and zones without data keep their base rates
+    const FZoneEconomicData* ZoneData = FindZoneData(ZoneTags[ZoneIndex]);
+    if (!ZoneHasLivePopulation[ZoneIndex] || !ZoneData)
+    {
+        ZonePopulationScales[ZoneIndex] = 1.0f;
+        return;
+    }
+
+    const float LivePopulation = ZoneResidentNPCs[ZoneIndex] * SimulationConfig.PopulationPerNPC;
+    ZonePopulationScales[ZoneIndex] = FMath::Clamp(LivePopulation / FMath::Max(1, ZoneData->Population), 0.0f, SimulationConfig.MaxPopulationScale);
+}
+
+void UEconomyManager::SetZonePopulation(const FGameplayTag& ZoneTag, int32 ResidentNPCs)
+{
+    if (!ZoneTag.IsValid())
+    {
+        return;
+    }
+
+    const int32 Index = FindOrAddZoneIndex(ZoneTag);
+    ZoneResidentNPCs[Index] = FMath::Max(0, ResidentNPCs);
+    ZoneHasLivePopulation[Index] = true;
+    UpdatePopulationScale(Index);
+}
+
+void UEconomyManager::SetZoneResource(const FGameplayTag& ZoneTag, const FZoneResourceState& Resource, float RegenPerSecond, float Capacity)
+{
+    if (!ZoneTag.IsValid() || !Resource.ResourceType.IsValid())
+    {
+        return;
+    }
+
+    const int32 ZoneIndex = FindOrAddZoneIndex(ZoneTag);
+
+    FResourceInput* Input = ResourceInputs.FindByPredicate([ZoneIndex, &Resource](const FResourceInput& Existing)
+    {
+        return Existing.ZoneIndex == ZoneIndex && Existing.State.ResourceType == Resource.ResourceType;
+    });
+
+    if (!Input)
+    {
+        // A new resource can constrain existing production lines
+        Input = &ResourceInputs.AddDefaulted_GetRef();
+        Input->ZoneIndex = ZoneIndex;
+        bFlowLinesDirty = true;
+    }
+
+    Input->State = Resource;
+    Input->RegenPerSecond = RegenPerSecond;
+    Input->Capacity = FMath::Max(Capacity, KINDA_SMALL_NUMBER);
+}
+
+void UEconomyManager::ClearZoneInputs(const FGameplayTag& ZoneTag)
+{
+    const int32* Index = ZoneIndices.Find(ZoneTag);
+    if (!Index)
+    {
+        return;
+    }
+
+    const int32 ZoneIndex = *Index;
+    ZoneResidentNPCs[ZoneIndex] = 0;
+    ZoneHasLivePopulation[ZoneIndex] = false;
+    UpdatePopulationScale(ZoneIndex);
+
+    if (ResourceInputs.RemoveAll([ZoneIndex](const FResourceInput& Input) { return Input.ZoneIndex == ZoneIndex; }) > 0)
+    {
+        bFlowLinesDirty = true;
+    }
+}
+
+void UEconomyManager::RebuildFlowLines()
+{
+    ProductionLines.Reset();
+    ConsumptionLines.Reset();
+
+    for (const auto& ZonePair : ZoneEconomicData)
+    {
+        const int32 ZoneIndex = FindOrAddZoneIndex(ZonePair.Key);
+        const FZoneEconomicData& ZoneData = ZonePair.Value;
+
+        for (const auto& ProductionPair : ZoneData.ProducedGoods)
+        {
+            const int32 GoodsIndex = ResolveGoodsIndex(ProductionPair.Key);
+            if (GoodsIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            FFlowLine& Line = ProductionLines.AddDefaulted_GetRef();
+            Line.ZoneIndex = ZoneIndex;
+            Line.GoodsIndex = GoodsIndex;
+            Line.RatePerHour = ProductionPair.Value;
+
+            // Goods tagged with a resource the zone tracks are limited by that resource's stock
+            const FGameplayTagContainer& GoodsTags = Goods[GoodsIndex].GoodsTags;
+            Line.ResourceInput = ResourceInputs.IndexOfByPredicate([ZoneIndex, &GoodsTags](const FResourceInput& Input)
+            {
+                return Input.ZoneIndex == ZoneIndex && GoodsTags.HasTag(Input.State.ResourceType);
+            });
+        }
+
+        for (const auto& ConsumptionPair : ZoneData.ConsumedGoods)
+        {
+            const int32 GoodsIndex = ResolveGoodsIndex(ConsumptionPair.Key);
+            if (GoodsIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            FFlowLine& Line = ConsumptionLines.AddDefaulted_GetRef();
+            Line.ZoneIndex = ZoneIndex;
+            Line.GoodsIndex = GoodsIndex;
+            Line.RatePerHour = ConsumptionPair.Value;
+        }
+    }
+
+    bFlowLinesDirty = false;
+}
+
 // === INTERNAL SIMULATION ===
 
 void UEconomyManager::UpdateMarketPrices()
 {
-    for (auto& ZonePair : ZoneEconomicData)
+    for (int32 ZoneIndex = 0; ZoneIndex < ZoneMarkets.Num(); ++ZoneIndex)
     {
-        for (auto& MarketPair : ZonePair.Value.Markets)
+        for (int32 GoodsIndex = 0; GoodsIndex < ZoneMarkets[ZoneIndex].Num(); ++GoodsIndex)
         {
-            UpdateGoodsPrice(MarketPair.Key, ZonePair.Key);
+            UpdateMarketPrice(ZoneIndex, GoodsIndex);
         }
     }
 }
 
+void UEconomyManager::UpdateMarketPrice(int32 ZoneIndex, int32 GoodsIndex)
+{
+    FMarketData& MarketData = ZoneMarkets[ZoneIndex][GoodsIndex];
+
+    const int32 OldPrice = MarketData.CurrentPrice;
+    MarketData.CurrentPrice = CalculatePrice(MarketData, Goods[GoodsIndex]);
+
+    if (OldPrice != MarketData.CurrentPrice)
+    {
+        OnPriceChanged.Broadcast(Goods[GoodsIndex].GoodsID, ZoneTags[ZoneIndex], OldPrice, MarketData.CurrentPrice);
+    }
+}
+
 void UEconomyManager::UpdateSupplyDemand()
 {
+    ClearOrderBook();
+
+    if (bFlowLinesDirty)
+    {
+        RebuildFlowLines();
+    }
+
     ProcessZoneProduction();
     ProcessZoneConsumption();
 }
 
 void UEconomyManager::ProcessZoneProduction()
 {
-    for (auto& ZonePair : ZoneEconomicData)
+    const float Hours = SimulationConfig.SupplyDemandUpdateInterval / 3600.0f;
+    const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+    // Stock fraction per resource, regrown from its last pushed write the same way the zone does
+    TArray<float, TInlineAllocator<32>> ResourceFactors;
+    ResourceFactors.SetNumUninitialized(ResourceInputs.Num());
+    for (int32 Index = 0; Index < ResourceInputs.Num(); ++Index)
     {
-        FZoneEconomicData& ZoneData = ZonePair.Value;
-        
-        for (const auto& ProductionPair : ZoneData.ProducedGoods)
+        const FResourceInput& Input = ResourceInputs[Index];
+        const float Elapsed = FMath::Max(Now - Input.State.LastUpdateTime, 0.0f);
+        const float Stock = FMath::Min(Input.Capacity, Input.State.Amount + Input.RegenPerSecond * Elapsed);
+        ResourceFactors[Index] = Stock / Input.Capacity;
+    }
+
+    for (const FFlowLine& Line : ProductionLines)
+    {
+        float Scale = ZonePopulationScales[Line.ZoneIndex];
+        if (Line.ResourceInput != INDEX_NONE)
+        {
+            Scale *= ResourceFactors[Line.ResourceInput];
+        }
+
+        const int32 ProducedAmount = FMath::RoundToInt(Line.RatePerHour * Hours * Scale);
+        if (ProducedAmount > 0)
         {
-            int32 ProducedAmount = FMath::RoundToInt(ProductionPair.Value * SimulationConfig.SupplyDemandUpdateInterval / 3600.0f);
-            AddSupply(ProductionPair.Key, ZonePair.Key, ProducedAmount);
+            ZoneMarkets[Line.ZoneIndex][Line.GoodsIndex].Supply += ProducedAmount;
         }
     }
 }
 
 void UEconomyManager::ProcessZoneConsumption()
 {
-    for (auto& ZonePair : ZoneEconomicData)
+    const float Hours = SimulationConfig.SupplyDemandUpdateInterval / 3600.0f;
+
+    for (const FFlowLine& Line : ConsumptionLines)
     {
-        FZoneEconomicData& ZoneData = ZonePair.Value;
-        
-        for (const auto& ConsumptionPair : ZoneData.ConsumedGoods)
+        const int32 ConsumedAmount = FMath::RoundToInt(Line.RatePerHour * Hours * ZonePopulationScales[Line.ZoneIndex]);
+        if (ConsumedAmount > 0)
         {
-            int32 ConsumedAmount = FMath::RoundToInt(ConsumptionPair.Value * SimulationConfig.SupplyDemandUpdateInterval / 3600.0f);
-            AddDemand(ConsumptionPair.Key, ZonePair.Key, ConsumedAmount);
+            ZoneMarkets[Line.ZoneIndex][Line.GoodsIndex].Demand += ConsumedAmount;
         }
     }
 }
 
-int32 UEconomyManager::CalculatePrice(const FName& GoodsID, const FMarketData& InMarketData, const FGoodsData& InGoodsData) const
+void UEconomyManager::SettleOrders(int32 ZoneIndex, int32 GoodsIndex)
+{
+    FMarketOrders& Orders = ZoneOrders[ZoneIndex][GoodsIndex];
+    FMarketData& MarketData = ZoneMarkets[ZoneIndex][GoodsIndex];
+
+    // Buys and sells match against each other first - only the net volume touches stock
+    MarketData.Supply = FMath::Max(0, MarketData.Supply + Orders.SellQuantity - Orders.BuyQuantity);
+    MarketData.Demand = FMath::Max(0, MarketData.Demand + Orders.DemandDelta);
+
+    Orders = FMarketOrders();
+}
+
+void UEconomyManager::ClearOrderBook()
+{
+    for (const FIntPoint& Market : QueuedMarkets)
+    {
+        // Skip books dropped by a zone unregistering or reinitializing since the trade
+        if (!ZoneOrders[Market.X].IsValidIndex(Market.Y) || !ZoneOrders[Market.X][Market.Y].bQueued)
+        {
+            continue;
+        }
+
+        // Volume only - repricing stays on the price timer, once per period
+        SettleOrders(Market.X, Market.Y);
+    }
+
+    QueuedMarkets.Reset();
+}
+
+int32 UEconomyManager::GetAvailableSupply(int32 ZoneIndex, int32 GoodsIndex) const
+{
+    const FMarketOrders& Orders = ZoneOrders[ZoneIndex][GoodsIndex];
+    return ZoneMarkets[ZoneIndex][GoodsIndex].Supply + Orders.SellQuantity - Orders.BuyQuantity;
+}
+
+int32 UEconomyManager::CalculatePrice(const FMarketData& InMarketData, const FGoodsData& InGoodsData) const
 {
     float PriceModifier = InMarketData.GetPriceModifier();
     int32 NewPrice = FMath::RoundToInt(InGoodsData.BaseValue * PriceModifier);
@@ -479,26 +728,32 @@ int32 UEconomyManager::CalculatePrice(const FName& GoodsID, const FMarketData& I
     return FMath::Max(1, NewPrice);
 }
 
-void UEconomyManager::InitializeZoneMarkets(const FGameplayTag& ZoneTag)
+void UEconomyManager::InitializeZoneMarkets(const FZoneEconomicData& ZoneData)
 {
-    FZoneEconomicData* ZoneData = FindZoneData(ZoneTag);
-    if (!ZoneData)
+    const int32 ZoneIndex = FindOrAddZoneIndex(ZoneData.ZoneTag);
+    TArray<FMarketData>& Markets = ZoneMarkets[ZoneIndex];
+
+    // Trades queued against the old markets are dropped with them
+    ZoneOrders[ZoneIndex].Reset();
+    ZoneOrders[ZoneIndex].SetNum(Goods.Num());
+
+    // One market for every known good, at base price
+    Markets.SetNum(Goods.Num());
+    for (int32 GoodsIndex = 0; GoodsIndex < Goods.Num(); ++GoodsIndex)
     {
-        return;
+        FMarketData& NewMarket = Markets[GoodsIndex];
+        NewMarket = FMarketData();
+        NewMarket.CurrentPrice = Goods[GoodsIndex].BaseValue;
+        NewMarket.AveragePrice = Goods[GoodsIndex].BaseValue;
     }
 
-    // Initialize markets for all known goods
-    for (const auto& GoodsPair : GoodsData)
+    // Markets authored on the zone row override the defaults
+    for (const auto& MarketPair : ZoneData.Markets)
     {
-        if (!ZoneData->Markets.Contains(GoodsPair.Key))
+        const int32 GoodsIndex = ResolveGoodsIndex(MarketPair.Key);
+        if (GoodsIndex != INDEX_NONE)
         {
-            FMarketData NewMarket;
-            NewMarket.CurrentPrice = GoodsPair.Value.BaseValue;
-            NewMarket.AveragePrice = GoodsPair.Value.BaseValue;
-            NewMarket.Supply = 0;
-            NewMarket.Demand = 0;
-            
-            ZoneData->Markets.Add(GoodsPair.Key, NewMarket);
+            Markets[GoodsIndex] = MarketPair.Value;
         }
     }
 }
@@ -515,9 +770,16 @@ const FZoneEconomicData* UEconomyManager::FindZoneData(const FGameplayTag& ZoneT
     return ZoneEconomicData.Find(ZoneTag);
 }
 
-const FGoodsData* UEconomyManager::FindGoodsData(const FName& GoodsID) const
+FMarketData* UEconomyManager::FindMarket(const FGameplayTag& ZoneTag, int32 GoodsIndex)
+{
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    return ZoneIndex && ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex) ? &ZoneMarkets[*ZoneIndex][GoodsIndex] : nullptr;
+}
+
+const FMarketData* UEconomyManager::FindMarket(const FGameplayTag& ZoneTag, int32 GoodsIndex) const
 {
-    return GoodsData.Find(GoodsID);
+    const int32* ZoneIndex = ZoneIndices.Find(ZoneTag);
+    return ZoneIndex && ZoneMarkets[*ZoneIndex].IsValidIndex(GoodsIndex) ? &ZoneMarkets[*ZoneIndex][GoodsIndex] : nullptr;
 }
 
 void UEconomyManager::LogEconomyDebug(const FString& Message) const
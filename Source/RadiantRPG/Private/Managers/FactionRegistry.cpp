@@ -0,0 +1,664 @@
+// Private/Managers/FactionRegistry.cpp
+
+#include "Managers/FactionRegistry.h"
+#include "Core/RadiantGameplayTags.h"
+
+// === SUBSYSTEM LIFECYCLE ===
+
+void UFactionRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogTemp, Log, TEXT("FactionRegistry: Initializing faction registry subsystem"));
+}
+
+void UFactionRegistry::Deinitialize()
+{
+    ResetRegistry();
+
+    UE_LOG(LogTemp, Log, TEXT("FactionRegistry: Deinitializing faction registry subsystem"));
+
+    Super::Deinitialize();
+}
+
+// === REGISTRATION ===
+
+int32 UFactionRegistry::RegisterFaction(const FFactionData& FactionData)
+{
+    const int32 FactionID = AddFactionInternal(FactionData);
+    if (FactionID != INDEX_NONE)
+    {
+        ResolveRelationships(FactionID);
+    }
+    return FactionID;
+}
+
+void UFactionRegistry::RegisterFactions(const TArray<FFactionData>& InFactions)
+{
+    const int32 FirstNewID = Factions.Num();
+    EnsureMatrixCapacity(FirstNewID + InFactions.Num());
+
+    for (const FFactionData& FactionData : InFactions)
+    {
+        AddFactionInternal(FactionData);
+    }
+
+    if (Factions.Num() > FirstNewID)
+    {
+        ResolveRelationships(FirstNewID);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FactionRegistry: Registered %d factions (%d members, %d territories)"),
+           Factions.Num() - FirstNewID, MemberIndex.Num(), TerritoryIndex.Num());
+}
+
+void UFactionRegistry::ResetRegistry()
+{
+    Factions.Empty();
+    FactionNameLookup.Empty();
+    FactionTagLookup.Empty();
+    MemberIndex.Empty();
+    TerritoryIndex.Empty();
+    RelationMatrix.Empty();
+    RelationshipsDirty.Empty();
+    MatrixStride = 0;
+}
+
+int32 UFactionRegistry::AddFactionInternal(const FFactionData& FactionData)
+{
+    if (FactionData.FactionID.IsNone())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionRegistry: Cannot register faction without FactionID"));
+        return INDEX_NONE;
+    }
+
+    if (FactionNameLookup.Contains(FactionData.FactionID))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionRegistry: Faction %s already registered"), *FactionData.FactionID.ToString());
+        return INDEX_NONE;
+    }
+
+    const int32 FactionID = Factions.Add(FactionData);
+    EnsureMatrixCapacity(Factions.Num());
+    RelationshipsDirty.Add(false);
+
+    FactionNameLookup.Add(FactionData.FactionID, FactionID);
+    for (const FGameplayTag& Tag : FactionData.FactionTags)
+    {
+        FactionTagLookup.FindOrAdd(Tag, FactionID);
+    }
+
+    // Index members, dropping duplicates and members already claimed elsewhere
+    TArray<FFactionMember>& Members = Factions[FactionID].Members;
+    for (int32 i = Members.Num() - 1; i >= 0; --i)
+    {
+        const FName MemberID = Members[i].MemberID;
+        if (MemberID.IsNone() || MemberIndex.Contains(MemberID))
+        {
+            Members.RemoveAtSwap(i);
+            continue;
+        }
+        MemberIndex.Add(MemberID, FFactionSlot(FactionID, i));
+    }
+
+    // Index territories - first registered owner wins
+    TArray<FTerritoryData>& Territories = Factions[FactionID].ControlledTerritories;
+    for (int32 i = Territories.Num() - 1; i >= 0; --i)
+    {
+        const FName ZoneID = Territories[i].ZoneID;
+        if (ZoneID.IsNone() || TerritoryIndex.Contains(ZoneID))
+        {
+            Territories.RemoveAtSwap(i);
+            continue;
+        }
+        Territories[i].ControllingFaction = FactionData.FactionID;
+        TerritoryIndex.Add(ZoneID, FFactionSlot(FactionID, i));
+    }
+
+    // RemoveAtSwap above moved entries - refresh their slots
+    for (int32 i = 0; i < Members.Num(); ++i)
+    {
+        MemberIndex.FindChecked(Members[i].MemberID).Index = i;
+    }
+    for (int32 i = 0; i < Territories.Num(); ++i)
+    {
+        TerritoryIndex.FindChecked(Territories[i].ZoneID).Index = i;
+    }
+
+    return FactionID;
+}
+
+void UFactionRegistry::ResolveRelationships(int32 FirstNewFactionID)
+{
+    // New factions' outgoing relationships, plus existing factions' relationships
+    // that referenced a faction which was not yet registered
+    for (int32 FactionID = 0; FactionID < Factions.Num(); ++FactionID)
+    {
+        for (const FFactionRelationship& Relationship : Factions[FactionID].Relationships)
+        {
+            const int32 OtherID = FindFactionID(Relationship.FactionID);
+            if (OtherID == INDEX_NONE || OtherID == FactionID)
+            {
+                continue;
+            }
+
+            if (FactionID < FirstNewFactionID && OtherID < FirstNewFactionID)
+            {
+                continue;
+            }
+
+            FFactionRelationCell& Cell = *GetCell(FactionID, OtherID);
+            Cell.Value = FMath::Clamp(Relationship.RelationshipValue, -100.0f, 100.0f);
+            Cell.LastConflictTime = Relationship.LastConflictTime;
+            Cell.bAtWar = Relationship.bIsAtWar;
+            Cell.bHasTradingRights = Relationship.bHasTradingRights;
+            Cell.bHasAlliance = Relationship.bHasAlliance;
+        }
+    }
+}
+
+void UFactionRegistry::EnsureMatrixCapacity(int32 RequiredCount)
+{
+    if (RequiredCount <= MatrixStride)
+    {
+        return;
+    }
+
+    const int32 NewStride = FMath::Max(RequiredCount, FMath::Max(8, MatrixStride * 2));
+
+    TArray<FFactionRelationCell> NewMatrix;
+    NewMatrix.SetNum(NewStride * NewStride);
+
+    for (int32 Row = 0; Row < MatrixStride; ++Row)
+    {
+        for (int32 Col = 0; Col < MatrixStride; ++Col)
+        {
+            NewMatrix[Row * NewStride + Col] = RelationMatrix[Row * MatrixStride + Col];
+        }
+    }
+
+    RelationMatrix = MoveTemp(NewMatrix);
+    MatrixStride = NewStride;
+}
+
+int32 UFactionRegistry::FindFactionID(FName FactionName) const
+{
+    const int32* Found = FactionNameLookup.Find(FactionName);
+    return Found ? *Found : INDEX_NONE;
+}
+
+int32 UFactionRegistry::FindFactionIDByTag(FGameplayTag FactionTag) const
+{
+    const int32* Found = FactionTagLookup.Find(FactionTag);
+    return Found ? *Found : INDEX_NONE;
+}
+
+FName UFactionRegistry::GetFactionName(int32 FactionID) const
+{
+    return IsValidFaction(FactionID) ? Factions[FactionID].FactionID : NAME_None;
+}
+
+const FFactionData* UFactionRegistry::GetFactionData(int32 FactionID)
+{
+    if (!IsValidFaction(FactionID))
+    {
+        return nullptr;
+    }
+
+    if (RelationshipsDirty[FactionID])
+    {
+        SyncRelationshipsToData(FactionID);
+    }
+
+    return &Factions[FactionID];
+}
+
+// === MEMBERSHIP ===
+
+bool UFactionRegistry::AddMember(int32 FactionID, const FFactionMember& Member)
+{
+    if (!IsValidFaction(FactionID) || Member.MemberID.IsNone())
+    {
+        return false;
+    }
+
+    if (const FFactionSlot* Existing = MemberIndex.Find(Member.MemberID))
+    {
+        if (Existing->FactionID == FactionID)
+        {
+            Factions[FactionID].Members[Existing->Index] = Member;
+            return true;
+        }
+        RemoveMember(Member.MemberID);
+    }
+
+    const int32 Index = Factions[FactionID].Members.Add(Member);
+    MemberIndex.Add(Member.MemberID, FFactionSlot(FactionID, Index));
+
+    FFactionEventPayload Payload(EFactionEventKind::MemberJoined, FactionID, INDEX_NONE);
+    Payload.NewValue = Factions[FactionID].Members.Num();
+    BroadcastFactionEvent(Payload);
+    return true;
+}
+
+bool UFactionRegistry::RemoveMember(FName MemberID)
+{
+    FFactionSlot Slot;
+    if (!MemberIndex.RemoveAndCopyValue(MemberID, Slot))
+    {
+        return false;
+    }
+
+    TArray<FFactionMember>& Members = Factions[Slot.FactionID].Members;
+    Members.RemoveAtSwap(Slot.Index);
+
+    // Fix up the member that was swapped into the freed slot
+    if (Members.IsValidIndex(Slot.Index))
+    {
+        MemberIndex.FindChecked(Members[Slot.Index].MemberID).Index = Slot.Index;
+    }
+
+    FFactionEventPayload Payload(EFactionEventKind::MemberLeft, Slot.FactionID, INDEX_NONE);
+    Payload.NewValue = Members.Num();
+    BroadcastFactionEvent(Payload);
+    return true;
+}
+
+int32 UFactionRegistry::GetMemberFaction(FName MemberID) const
+{
+    const FFactionSlot* Slot = MemberIndex.Find(MemberID);
+    return Slot ? Slot->FactionID : INDEX_NONE;
+}
+
+bool UFactionRegistry::IsMemberOf(FName MemberID, int32 FactionID) const
+{
+    return FactionID != INDEX_NONE && GetMemberFaction(MemberID) == FactionID;
+}
+
+int32 UFactionRegistry::GetMemberCount(int32 FactionID) const
+{
+    return IsValidFaction(FactionID) ? Factions[FactionID].Members.Num() : 0;
+}
+
+const FFactionMember* UFactionRegistry::FindMember(FName MemberID) const
+{
+    const FFactionSlot* Slot = MemberIndex.Find(MemberID);
+    return Slot ? &Factions[Slot->FactionID].Members[Slot->Index] : nullptr;
+}
+
+FFactionMember* UFactionRegistry::FindMember(FName MemberID)
+{
+    const FFactionSlot* Slot = MemberIndex.Find(MemberID);
+    return Slot ? &Factions[Slot->FactionID].Members[Slot->Index] : nullptr;
+}
+
+// === RELATIONSHIPS ===
+
+const FFactionRelationCell* UFactionRegistry::GetCell(int32 FactionA, int32 FactionB) const
+{
+    if (!IsValidFaction(FactionA) || !IsValidFaction(FactionB))
+    {
+        return nullptr;
+    }
+    return &RelationMatrix[CellIndex(FactionA, FactionB)];
+}
+
+FFactionRelationCell* UFactionRegistry::GetCell(int32 FactionA, int32 FactionB)
+{
+    if (!IsValidFaction(FactionA) || !IsValidFaction(FactionB))
+    {
+        return nullptr;
+    }
+    return &RelationMatrix[CellIndex(FactionA, FactionB)];
+}
+
+float UFactionRegistry::GetRelationshipValue(int32 FactionA, int32 FactionB) const
+{
+    if (FactionA == FactionB && IsValidFaction(FactionA))
+    {
+        return 100.0f;
+    }
+
+    const FFactionRelationCell* Cell = GetCell(FactionA, FactionB);
+    return Cell ? Cell->Value : 0.0f;
+}
+
+ERelationshipStanding UFactionRegistry::GetRelationshipStanding(int32 FactionA, int32 FactionB) const
+{
+    return StandingFromValue(GetRelationshipValue(FactionA, FactionB));
+}
+
+bool UFactionRegistry::AreAtWar(int32 FactionA, int32 FactionB) const
+{
+    const FFactionRelationCell* Cell = GetCell(FactionA, FactionB);
+    return Cell && Cell->bAtWar;
+}
+
+bool UFactionRegistry::AreAllied(int32 FactionA, int32 FactionB) const
+{
+    if (FactionA == FactionB)
+    {
+        return IsValidFaction(FactionA);
+    }
+
+    const FFactionRelationCell* Cell = GetCell(FactionA, FactionB);
+    return Cell && Cell->bHasAlliance;
+}
+
+bool UFactionRegistry::HaveTradingRights(int32 FactionA, int32 FactionB) const
+{
+    const FFactionRelationCell* Cell = GetCell(FactionA, FactionB);
+    return Cell && Cell->bHasTradingRights;
+}
+
+TArray<int32> UFactionRegistry::GetSharedEnemies(int32 FactionA, int32 FactionB) const
+{
+    TArray<int32> Result;
+    if (!IsValidFaction(FactionA) || !IsValidFaction(FactionB))
+    {
+        return Result;
+    }
+
+    const FFactionRelationCell* RowA = &RelationMatrix[CellIndex(FactionA, 0)];
+    const FFactionRelationCell* RowB = &RelationMatrix[CellIndex(FactionB, 0)];
+    for (int32 Other = 0; Other < Factions.Num(); ++Other)
+    {
+        if (RowA[Other].bAtWar && RowB[Other].bAtWar)
+        {
+            Result.Add(Other);
+        }
+    }
+    return Result;
+}
+
+void UFactionRegistry::SetRelationshipValue(int32 FactionA, int32 FactionB, float NewValue)
+{
+    FFactionRelationCell* Cell = GetCell(FactionA, FactionB);
+    if (!Cell || FactionA == FactionB)
+    {
+        return;
+    }
+
+    NewValue = FMath::Clamp(NewValue, -100.0f, 100.0f);
+    if (Cell->Value == NewValue)
+    {
+        return;
+    }
+
+    FFactionEventPayload Payload(EFactionEventKind::RelationshipChanged, FactionA, FactionB);
+    Payload.Delta = NewValue - Cell->Value;
+    Payload.NewValue = NewValue;
+
+    Cell->Value = NewValue;
+    MarkRelationshipsDirty(FactionA, FactionB);
+    BroadcastFactionEvent(Payload);
+}
+
+void UFactionRegistry::ModifyRelationshipValue(int32 FactionA, int32 FactionB, float Delta)
+{
+    SetRelationshipValue(FactionA, FactionB, GetRelationshipValue(FactionA, FactionB) + Delta);
+}
+
+void UFactionRegistry::SetAtWar(int32 FactionA, int32 FactionB, bool bAtWar)
+{
+    FFactionRelationCell* CellAB = GetCell(FactionA, FactionB);
+    FFactionRelationCell* CellBA = GetCell(FactionB, FactionA);
+    if (!CellAB || !CellBA || FactionA == FactionB || CellAB->bAtWar == bAtWar)
+    {
+        return;
+    }
+
+    CellAB->bAtWar = bAtWar;
+    CellBA->bAtWar = bAtWar;
+
+    if (bAtWar)
+    {
+        // War breaks alliances
+        CellAB->bHasAlliance = false;
+        CellBA->bHasAlliance = false;
+
+        const UWorld* World = GetWorld();
+        const float Now = World ? World->GetTimeSeconds() : 0.0f;
+        CellAB->LastConflictTime = Now;
+        CellBA->LastConflictTime = Now;
+    }
+
+    MarkRelationshipsDirty(FactionA, FactionB);
+    MarkEnemiesDirty(FactionA);
+    MarkEnemiesDirty(FactionB);
+    BroadcastFactionEvent(FFactionEventPayload(bAtWar ? EFactionEventKind::WarDeclared : EFactionEventKind::PeaceMade, FactionA, FactionB));
+}
+
+void UFactionRegistry::SetAlliance(int32 FactionA, int32 FactionB, bool bAllied)
+{
+    FFactionRelationCell* CellAB = GetCell(FactionA, FactionB);
+    FFactionRelationCell* CellBA = GetCell(FactionB, FactionA);
+    if (!CellAB || !CellBA || FactionA == FactionB || CellAB->bHasAlliance == bAllied)
+    {
+        return;
+    }
+
+    if (bAllied && CellAB->bAtWar)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionRegistry: Cannot ally %s and %s while at war"),
+               *GetFactionName(FactionA).ToString(), *GetFactionName(FactionB).ToString());
+        return;
+    }
+
+    CellAB->bHasAlliance = bAllied;
+    CellBA->bHasAlliance = bAllied;
+
+    MarkRelationshipsDirty(FactionA, FactionB);
+    BroadcastFactionEvent(FFactionEventPayload(bAllied ? EFactionEventKind::AllianceFormed : EFactionEventKind::AllianceBroken, FactionA, FactionB));
+}
+
+void UFactionRegistry::SetTradingRights(int32 FactionA, int32 FactionB, bool bCanTrade)
+{
+    FFactionRelationCell* CellAB = GetCell(FactionA, FactionB);
+    FFactionRelationCell* CellBA = GetCell(FactionB, FactionA);
+    if (!CellAB || !CellBA || FactionA == FactionB || CellAB->bHasTradingRights == bCanTrade)
+    {
+        return;
+    }
+
+    CellAB->bHasTradingRights = bCanTrade;
+    CellBA->bHasTradingRights = bCanTrade;
+
+    MarkRelationshipsDirty(FactionA, FactionB);
+    BroadcastFactionEvent(FFactionEventPayload(bCanTrade ? EFactionEventKind::TradeOpened : EFactionEventKind::TradeClosed, FactionA, FactionB));
+}
+
+void UFactionRegistry::MarkRelationshipsDirty(int32 FactionA, int32 FactionB)
+{
+    RelationshipsDirty[FactionA] = true;
+    RelationshipsDirty[FactionB] = true;
+}
+
+void UFactionRegistry::MarkEnemiesDirty(int32 FactionID)
+{
+    for (int32 OtherID = 0; OtherID < Factions.Num(); ++OtherID)
+    {
+        if (RelationMatrix[CellIndex(OtherID, FactionID)].bAtWar)
+        {
+            RelationshipsDirty[OtherID] = true;
+        }
+    }
+}
+
+void UFactionRegistry::SyncRelationshipsToData(int32 FactionID)
+{
+    FFactionData& Data = Factions[FactionID];
+
+    // Preserve designer-authored trade goods for relationships that still exist
+    TMap<FName, TArray<FName>> TradeGoods;
+    for (FFactionRelationship& Relationship : Data.Relationships)
+    {
+        if (Relationship.TradeGoods.Num() > 0)
+        {
+            TradeGoods.Add(Relationship.FactionID, MoveTemp(Relationship.TradeGoods));
+        }
+    }
+
+    Data.Relationships.Reset();
+
+    for (int32 OtherID = 0; OtherID < Factions.Num(); ++OtherID)
+    {
+        const FFactionRelationCell& Cell = RelationMatrix[CellIndex(FactionID, OtherID)];
+        if (OtherID == FactionID || Cell.IsDefault())
+        {
+            continue;
+        }
+
+        FFactionRelationship& Relationship = Data.Relationships.AddDefaulted_GetRef();
+        Relationship.FactionID = Factions[OtherID].FactionID;
+        Relationship.RelationshipValue = Cell.Value;
+        Relationship.Standing = StandingFromValue(Cell.Value);
+        Relationship.bIsAtWar = Cell.bAtWar;
+        Relationship.bHasTradingRights = Cell.bHasTradingRights;
+        Relationship.bHasAlliance = Cell.bHasAlliance;
+        Relationship.LastConflictTime = Cell.LastConflictTime;
+
+        for (int32 EnemyID : GetSharedEnemies(FactionID, OtherID))
+        {
+            Relationship.SharedEnemies.Add(Factions[EnemyID].FactionID);
+        }
+
+        if (TArray<FName>* Goods = TradeGoods.Find(Relationship.FactionID))
+        {
+            Relationship.TradeGoods = MoveTemp(*Goods);
+        }
+    }
+
+    RelationshipsDirty[FactionID] = false;
+}
+
+ERelationshipStanding UFactionRegistry::StandingFromValue(float Value)
+{
+    if (Value < -60.0f)
+        return ERelationshipStanding::Hostile;
+    if (Value < -20.0f)
+        return ERelationshipStanding::Unfriendly;
+    if (Value < 20.0f)
+        return ERelationshipStanding::Neutral;
+    if (Value < 60.0f)
+        return ERelationshipStanding::Friendly;
+    return ERelationshipStanding::Allied;
+}
+
+FGameplayTag UFactionRegistry::GetEventTag(EFactionEventKind Kind)
+{
+    switch (Kind)
+    {
+    case EFactionEventKind::WarDeclared:         return TAG_FactionEvent_WarDeclared;
+    case EFactionEventKind::PeaceMade:           return TAG_FactionEvent_PeaceMade;
+    case EFactionEventKind::AllianceFormed:      return TAG_FactionEvent_AllianceFormed;
+    case EFactionEventKind::AllianceBroken:      return TAG_FactionEvent_AllianceBroken;
+    case EFactionEventKind::TradeOpened:         return TAG_FactionEvent_TradeOpened;
+    case EFactionEventKind::TradeClosed:         return TAG_FactionEvent_TradeClosed;
+    case EFactionEventKind::RelationshipChanged: return TAG_FactionEvent_RelationshipChanged;
+    case EFactionEventKind::TerritoryChanged:    return TAG_FactionEvent_TerritoryChanged;
+    case EFactionEventKind::MemberJoined:        return TAG_FactionEvent_MemberJoined;
+    case EFactionEventKind::MemberLeft:          return TAG_FactionEvent_MemberLeft;
+    default:                                     return FGameplayTag();
+    }
+}
+
+void UFactionRegistry::BroadcastFactionEvent(const FFactionEventPayload& Payload)
+{
+    if (!OnFactionEvent.IsBound())
+    {
+        return;
+    }
+
+    FFactionEvent Event;
+    Event.Payload = Payload;
+    Event.Payload.SourceFaction = GetFactionName(Payload.SourceFactionID);
+    Event.Payload.TargetFaction = GetFactionName(Payload.TargetFactionID);
+
+    Event.FactionID = !Event.Payload.SourceFaction.IsNone() ? Event.Payload.SourceFaction : Event.Payload.TargetFaction;
+    Event.EventType = GetEventTag(Payload.Kind);
+    Event.Timestamp = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+    if (!Event.Payload.SourceFaction.IsNone())
+    {
+        Event.InvolvedFactions.Add(Event.Payload.SourceFaction);
+    }
+    if (!Event.Payload.TargetFaction.IsNone())
+    {
+        Event.InvolvedFactions.Add(Event.Payload.TargetFaction);
+    }
+
+    OnFactionEvent.Broadcast(Event);
+}
+
+// === TERRITORY ===
+
+int32 UFactionRegistry::GetTerritoryOwner(FName ZoneID) const
+{
+    const FFactionSlot* Slot = TerritoryIndex.Find(ZoneID);
+    return Slot ? Slot->FactionID : INDEX_NONE;
+}
+
+bool UFactionRegistry::SetTerritoryOwner(FName ZoneID, int32 NewFactionID)
+{
+    if (ZoneID.IsNone() || (NewFactionID != INDEX_NONE && !IsValidFaction(NewFactionID)))
+    {
+        return false;
+    }
+
+    const int32 OldFactionID = GetTerritoryOwner(ZoneID);
+    if (OldFactionID == NewFactionID)
+    {
+        return false;
+    }
+
+    FTerritoryData Territory;
+    Territory.ZoneID = ZoneID;
+
+    // Detach from the previous owner, carrying the territory data across
+    FFactionSlot OldSlot;
+    if (TerritoryIndex.RemoveAndCopyValue(ZoneID, OldSlot))
+    {
+        TArray<FTerritoryData>& OldTerritories = Factions[OldSlot.FactionID].ControlledTerritories;
+        Territory = MoveTemp(OldTerritories[OldSlot.Index]);
+        OldTerritories.RemoveAtSwap(OldSlot.Index);
+
+        if (OldTerritories.IsValidIndex(OldSlot.Index))
+        {
+            TerritoryIndex.FindChecked(OldTerritories[OldSlot.Index].ZoneID).Index = OldSlot.Index;
+        }
+    }
+
+    if (NewFactionID != INDEX_NONE)
+    {
+        Territory.ControllingFaction = Factions[NewFactionID].FactionID;
+        Territory.ContestingFactions.Remove(Territory.ControllingFaction);
+
+        const int32 Index = Factions[NewFactionID].ControlledTerritories.Add(MoveTemp(Territory));
+        TerritoryIndex.Add(ZoneID, FFactionSlot(NewFactionID, Index));
+    }
+
+    OnTerritoryOwnerChanged.Broadcast(ZoneID, OldFactionID, NewFactionID);
+
+    FFactionEventPayload Payload(EFactionEventKind::TerritoryChanged, NewFactionID, OldFactionID);
+    Payload.TerritoryID = ZoneID;
+    BroadcastFactionEvent(Payload);
+    return true;
+}
+
+int32 UFactionRegistry::GetTerritoryCount(int32 FactionID) const
+{
+    return IsValidFaction(FactionID) ? Factions[FactionID].ControlledTerritories.Num() : 0;
+}
+
+FTerritoryData* UFactionRegistry::FindTerritory(FName ZoneID)
+{
+    const FFactionSlot* Slot = TerritoryIndex.Find(ZoneID);
+    return Slot ? &Factions[Slot->FactionID].ControlledTerritories[Slot->Index] : nullptr;
+}
+
+const FTerritoryData* UFactionRegistry::FindTerritory(FName ZoneID) const
+{
+    const FFactionSlot* Slot = TerritoryIndex.Find(ZoneID);
+    return Slot ? &Factions[Slot->FactionID].ControlledTerritories[Slot->Index] : nullptr;
+}
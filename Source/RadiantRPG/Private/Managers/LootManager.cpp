@@ -0,0 +1,316 @@
+// Private/Managers/LootManager.cpp
+
+#include "Managers/LootManager.h"
+
+// === ALIAS SAMPLER ===
+
+void FLootAliasSampler::Build(const TArray<int32>& InOutcomes, const TArray<float>& Weights)
+{
+    check(InOutcomes.Num() == Weights.Num());
+
+    const int32 Count = Weights.Num();
+    Outcomes = InOutcomes;
+    Probability.SetNumUninitialized(Count);
+    Alias.SetNumUninitialized(Count);
+
+    float TotalWeight = 0.0f;
+    for (float Weight : Weights)
+    {
+        TotalWeight += Weight;
+    }
+
+    if (Count == 0 || TotalWeight <= 0.0f)
+    {
+        Outcomes.Reset();
+        Probability.Reset();
+        Alias.Reset();
+        return;
+    }
+
+    // Scale so the average column holds exactly 1
+    TArray<float> Scaled;
+    Scaled.SetNumUninitialized(Count);
+
+    TArray<int32, TInlineAllocator<32>> Small;
+    TArray<int32, TInlineAllocator<32>> Large;
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        Scaled[i] = Weights[i] * Count / TotalWeight;
+        Alias[i] = i;
+        (Scaled[i] < 1.0f ? Small : Large).Add(i);
+    }
+
+    while (Small.Num() > 0 && Large.Num() > 0)
+    {
+        const int32 Less = Small.Pop(EAllowShrinking::No);
+        const int32 More = Large.Pop(EAllowShrinking::No);
+
+        Probability[Less] = Scaled[Less];
+        Alias[Less] = More;
+
+        Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0f;
+        (Scaled[More] < 1.0f ? Small : Large).Add(More);
+    }
+
+    // Leftovers are full columns (floating point residue)
+    for (int32 Index : Large)
+    {
+        Probability[Index] = 1.0f;
+    }
+    for (int32 Index : Small)
+    {
+        Probability[Index] = 1.0f;
+    }
+}
+
+int32 FLootAliasSampler::Sample(FRandomStream& Stream) const
+{
+    const int32 Count = Outcomes.Num();
+    if (Count == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Column = Stream.RandHelper(Count);
+    return Stream.GetFraction() < Probability[Column] ? Outcomes[Column] : Outcomes[Alias[Column]];
+}
+
+// === COMPILED TABLE ===
+
+void FCompiledLootTable::Compile(const TArray<FLootEntry>& InEntries)
+{
+    Entries = InEntries;
+    RequirementSets.Reset();
+    EntryRequirement.Reset();
+    FilteredSamplers.Reset();
+
+    EntryRequirement.Reserve(Entries.Num());
+    for (const FLootEntry& Entry : Entries)
+    {
+        if (Entry.RequiredTags.IsEmpty())
+        {
+            EntryRequirement.Add(INDEX_NONE);
+            continue;
+        }
+
+        int32 SetIndex = RequirementSets.IndexOfByPredicate([&Entry](const FGameplayTagContainer& Set)
+        {
+            return Set == Entry.RequiredTags;
+        });
+
+        if (SetIndex == INDEX_NONE)
+        {
+            SetIndex = RequirementSets.Add(Entry.RequiredTags);
+        }
+
+        EntryRequirement.Add(SetIndex);
+    }
+
+    // The unfiltered sampler is always needed - build it up front
+    GetSampler(FLootRequirementMask());
+}
+
+FLootRequirementMask FCompiledLootTable::GetSatisfiedMask(const FGameplayTagContainer& ContextTags) const
+{
+    FLootRequirementMask Mask;
+    for (int32 SetIndex = 0; SetIndex < RequirementSets.Num(); ++SetIndex)
+    {
+        if (ContextTags.HasAll(RequirementSets[SetIndex]))
+        {
+            Mask.Set(SetIndex);
+        }
+    }
+    return Mask;
+}
+
+const FLootAliasSampler& FCompiledLootTable::GetSampler(const FLootRequirementMask& SatisfiedMask)
+{
+    if (const FLootAliasSampler* Cached = FilteredSamplers.Find(SatisfiedMask))
+    {
+        return *Cached;
+    }
+
+    TArray<int32> Outcomes;
+    TArray<float> Weights;
+    Outcomes.Reserve(Entries.Num() + 1);
+    Weights.Reserve(Entries.Num() + 1);
+
+    float TotalChance = 0.0f;
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+    {
+        const int32 Requirement = EntryRequirement[EntryIndex];
+        const bool bEligible = Requirement == INDEX_NONE || SatisfiedMask.IsSet(Requirement);
+
+        const float Chance = FMath::Max(0.0f, Entries[EntryIndex].DropChance);
+        if (!bEligible || Chance <= 0.0f)
+        {
+            continue;
+        }
+
+        Outcomes.Add(EntryIndex);
+        Weights.Add(Chance);
+        TotalChance += Chance;
+    }
+
+    // Chances summing below 1 leave room for "no drop"
+    if (TotalChance > 0.0f && TotalChance < 1.0f)
+    {
+        Outcomes.Add(INDEX_NONE);
+        Weights.Add(1.0f - TotalChance);
+    }
+
+    FLootAliasSampler& Sampler = FilteredSamplers.Add(SatisfiedMask);
+    Sampler.Build(Outcomes, Weights);
+    return Sampler;
+}
+
+bool FCompiledLootTable::MakeDrop(int32 EntryIndex, FRandomStream& Stream, FLootDrop& OutDrop) const
+{
+    if (!Entries.IsValidIndex(EntryIndex))
+    {
+        return false;
+    }
+
+    const FLootEntry& Entry = Entries[EntryIndex];
+
+    const float MinQuantity = FMath::Min(Entry.QuantityRange.Min, Entry.QuantityRange.Max);
+    const float MaxQuantity = FMath::Max(Entry.QuantityRange.Min, Entry.QuantityRange.Max);
+    const int32 MinRarity = FMath::Min((int32)Entry.MinRarity, (int32)Entry.MaxRarity);
+    const int32 MaxRarity = FMath::Max((int32)Entry.MinRarity, (int32)Entry.MaxRarity);
+
+    OutDrop.ItemID = Entry.ItemID;
+    OutDrop.Quantity = FMath::Max(1, FMath::RoundToInt(Stream.FRandRange(MinQuantity, MaxQuantity)));
+    OutDrop.Rarity = (ERarityTier)Stream.RandRange(MinRarity, MaxRarity);
+    return true;
+}
+
+// === SUBSYSTEM LIFECYCLE ===
+
+void ULootManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    LootStream.GenerateNewSeed();
+
+    UE_LOG(LogTemp, Log, TEXT("LootManager: Initializing loot subsystem"));
+}
+
+void ULootManager::Deinitialize()
+{
+    CompiledTables.Empty();
+
+    UE_LOG(LogTemp, Log, TEXT("LootManager: Deinitializing loot subsystem"));
+
+    Super::Deinitialize();
+}
+
+// === CONFIGURATION ===
+
+void ULootManager::InitializeLoot(UDataTable* LootDataTable)
+{
+    if (!LootDataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("LootManager: Invalid loot data table provided"));
+        return;
+    }
+
+    CompiledTables.Empty();
+
+    // Tables without an explicit ID fall back to their row name
+    LootDataTable->ForeachRow<FLootTable>(TEXT("LoadingLootTables"), [this](const FName& RowName, const FLootTable& Row)
+    {
+        RegisterLootTable(Row.LootTableID.IsNone() ? RowName : Row.LootTableID, Row.Entries);
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("LootManager: Compiled %d loot tables"), CompiledTables.Num());
+}
+
+void ULootManager::RegisterLootTable(FName LootTableID, const TArray<FLootEntry>& Entries)
+{
+    if (LootTableID.IsNone())
+    {
+        return;
+    }
+
+    CompiledTables.FindOrAdd(LootTableID).Compile(Entries);
+}
+
+void ULootManager::SetLootSeed(int32 Seed)
+{
+    LootStream.Initialize(Seed);
+}
+
+// === ROLLING ===
+
+bool ULootManager::RollLoot(FName LootTableID, const FGameplayTagContainer& ContextTags, FLootDrop& OutDrop)
+{
+    return RollLootWithStream(LootTableID, ContextTags, LootStream, OutDrop);
+}
+
+int32 ULootManager::RollLootBatch(FName LootTableID, int32 NumRolls, const FGameplayTagContainer& ContextTags, TArray<FLootDrop>& OutDrops, bool bMergeStacks)
+{
+    return RollLootBatchWithStream(LootTableID, NumRolls, ContextTags, LootStream, OutDrops, bMergeStacks);
+}
+
+bool ULootManager::RollLootWithStream(FName LootTableID, const FGameplayTagContainer& ContextTags, FRandomStream& Stream, FLootDrop& OutDrop)
+{
+    FCompiledLootTable* Table = CompiledTables.Find(LootTableID);
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("LootManager: Unknown loot table %s"), *LootTableID.ToString());
+        return false;
+    }
+
+    const FLootAliasSampler& Sampler = Table->GetSampler(Table->GetSatisfiedMask(ContextTags));
+    return Table->MakeDrop(Sampler.Sample(Stream), Stream, OutDrop);
+}
+
+int32 ULootManager::RollLootBatchWithStream(FName LootTableID, int32 NumRolls, const FGameplayTagContainer& ContextTags, FRandomStream& Stream, TArray<FLootDrop>& OutDrops, bool bMergeStacks)
+{
+    FCompiledLootTable* Table = CompiledTables.Find(LootTableID);
+    if (!Table || NumRolls <= 0)
+    {
+        return 0;
+    }
+
+    // Resolve the filtered sampler once for the whole batch
+    const FLootAliasSampler& Sampler = Table->GetSampler(Table->GetSatisfiedMask(ContextTags));
+    if (Sampler.IsEmpty())
+    {
+        return 0;
+    }
+
+    const int32 StartNum = OutDrops.Num();
+
+    // Merge key: entry index and rarity -> index into OutDrops
+    TMap<int32, int32> MergedIndices;
+
+    FLootDrop Drop;
+    for (int32 Roll = 0; Roll < NumRolls; ++Roll)
+    {
+        const int32 EntryIndex = Sampler.Sample(Stream);
+        if (!Table->MakeDrop(EntryIndex, Stream, Drop))
+        {
+            continue;
+        }
+
+        if (!bMergeStacks)
+        {
+            OutDrops.Add(Drop);
+            continue;
+        }
+
+        const int32 MergeKey = EntryIndex * (int32)ERarityTier::MAX + (int32)Drop.Rarity;
+        if (const int32* Existing = MergedIndices.Find(MergeKey))
+        {
+            OutDrops[*Existing].Quantity += Drop.Quantity;
+        }
+        else
+        {
+            MergedIndices.Add(MergeKey, OutDrops.Add(Drop));
+        }
+    }
+
+    return OutDrops.Num() - StartNum;
+}
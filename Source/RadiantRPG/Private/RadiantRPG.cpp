@@ -3,10 +3,20 @@
 #include "RadiantRPG.h"
 #include "Modules/ModuleManager.h"
 #include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/ReplicationDriver.h"
+#include "Core/RadiantReplicationGraph.h"
 
 DEFINE_LOG_CATEGORY(LogRadiantRPG);
 DEFINE_LOG_CATEGORY(LogARPG);
 
+// Console variable for the replication graph
+static TAutoConsoleVariable<int32> CVarUseReplicationGraph(
+	TEXT("radiant.net.repgraph"),
+	1,
+	TEXT("Use the RadiantRPG replication graph for new game net drivers (0=engine relevancy, 1=graph)"),
+	ECVF_Default);
+
 void FRadiantRPGModule::StartupModule()
 {
 	UE_LOG(LogRadiantRPG, Warning, TEXT("RadiantRPG module starting up..."));
@@ -29,14 +39,23 @@ void FRadiantRPGModule::InitializeGameplaySystems()
 {
 	UE_LOG(LogRadiantRPG, Log, TEXT("Initializing gameplay systems..."));
 	
-	// TODO: Initialize custom systems when they're implemented
+	// Game net drivers spatialize relevancy through the replication graph
+	UReplicationDriver::CreateReplicationDriverDelegate().BindLambda([](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+	{
+		if (CVarUseReplicationGraph.GetValueOnAnyThread() == 0 || !ForNetDriver || ForNetDriver->NetDriverName != NAME_GameNetDriver)
+		{
+			return nullptr;
+		}
+
+		return NewObject<URadiantReplicationGraph>(GetTransientPackage());
+	});
 }
 
 void FRadiantRPGModule::ShutdownGameplaySystems()
 {
 	UE_LOG(LogRadiantRPG, Log, TEXT("Shutting down gameplay systems..."));
 	
-	// TODO: Cleanup custom systems when they're implemented
+	UReplicationDriver::CreateReplicationDriverDelegate().Unbind();
 }
 
 bool FRadiantRPGModule::IsGameModule() const
@@ -0,0 +1,175 @@
+// Private/Tests/InventoryComponentTests.cpp
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/InventoryComponent.h"
+#include "Tests/RadiantTestHelpers.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace RadiantInventoryTests
+{
+    constexpr int32 NumSlots = 1000;
+    constexpr int32 NumItemTypes = 64;
+    constexpr int32 MaxStack = 20;
+
+    FName MakeItemID(int32 Index)
+    {
+        return FName(*FString::Printf(TEXT("BenchItem_%d"), Index));
+    }
+
+    UDataTable* MakeItemTable()
+    {
+        UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+        Table->RowStruct = FItemData::StaticStruct();
+
+        for (int32 Index = 0; Index < NumItemTypes; ++Index)
+        {
+            FItemData Row;
+            Row.ItemID = MakeItemID(Index);
+            Row.MaxStackSize = MaxStack;
+            Row.Weight = 0.1f;
+            Table->AddRow(Row.ItemID, Row);
+        }
+
+        return Table;
+    }
+
+    /** Cached totals must match a full recount, and every slot id must resolve to its own entry */
+    bool VerifyInventory(FAutomationTestBase& Test, const UInventoryComponent* Inventory)
+    {
+        TMap<FName, int32> Counts;
+        for (const FInventoryEntry& Entry : Inventory->GetEntries())
+        {
+            Counts.FindOrAdd(Entry.Item.ItemID) += Entry.Item.Quantity;
+
+            FItemInstance SlotItem;
+            if (!Inventory->GetSlot(Entry.SlotId, SlotItem) || SlotItem.ItemID != Entry.Item.ItemID || SlotItem.Quantity != Entry.Item.Quantity)
+            {
+                Test.AddError(FString::Printf(TEXT("Slot %d does not resolve to its entry"), Entry.SlotId));
+                return false;
+            }
+        }
+
+        if (!Test.TestEqual(TEXT("Cached item kinds"), Inventory->GetItemCounts().Num(), Counts.Num()))
+        {
+            return false;
+        }
+
+        for (const TPair<FName, int32>& Pair : Counts)
+        {
+            if (!Test.TestEqual(*FString::Printf(TEXT("Cached count of %s"), *Pair.Key.ToString()), Inventory->GetItemCount(Pair.Key), Pair.Value))
+            {
+                return false;
+            }
+        }
+
+        return Test.TestTrue(TEXT("Slot limit respected"), Inventory->GetUsedSlots() <= Inventory->GetMaxSlots());
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventoryRapidLootBenchmark, "RadiantRPG.Inventory.RapidLootBenchmark",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInventoryRapidLootBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace RadiantInventoryTests;
+    using namespace RadiantTestHelpers;
+
+    UWorld* World = CreateTestWorld();
+
+    AActor* Owner = World->SpawnActor<AActor>();
+    UInventoryComponent* Inventory = NewObject<UInventoryComponent>(Owner);
+    Inventory->ConfigureInventory(MakeItemTable(), NumSlots, 0.0f);
+    Inventory->RegisterComponent();
+
+    FRandomStream Stream(1337);
+
+    // Rapid looting - bursts of drops until all 1,000 slots are open
+    TArray<FItemStack> Burst;
+    TArray<FItemStack> Leftovers;
+    int32 NumBursts = 0;
+
+    const double LootStart = FPlatformTime::Seconds();
+    while (Inventory->GetUsedSlots() < NumSlots && NumBursts < 10000)
+    {
+        Burst.Reset();
+        for (int32 Drop = 0; Drop < 25; ++Drop)
+        {
+            Burst.Emplace(MakeItemID(Stream.RandRange(0, NumItemTypes - 1)), Stream.RandRange(1, MaxStack));
+        }
+
+        Leftovers.Reset();
+        Inventory->AddItemStacks(Burst, Leftovers);
+        ++NumBursts;
+    }
+    const double LootSeconds = FPlatformTime::Seconds() - LootStart;
+
+    TestEqual(TEXT("Inventory filled"), Inventory->GetUsedSlots(), NumSlots);
+    VerifyInventory(*this, Inventory);
+
+    // Churn at capacity - remove, split and merge by slot id
+    constexpr int32 NumChurnOps = 5000;
+    int32 NumMismatches = 0;
+
+    const double ChurnStart = FPlatformTime::Seconds();
+    for (int32 Op = 0; Op < NumChurnOps; ++Op)
+    {
+        const TArray<FInventoryEntry>& Entries = Inventory->GetEntries();
+        const FInventoryEntry& Picked = Entries[Stream.RandRange(0, Entries.Num() - 1)];
+        const int32 SlotId = Picked.SlotId;
+
+        switch (Op % 4)
+        {
+        case 0:
+            Inventory->RemoveFromSlot(SlotId, MaxStack);
+            break;
+        case 1:
+            Inventory->SplitStack(SlotId, 1);
+            break;
+        case 2:
+            Inventory->MergeStacks(SlotId, Entries[Stream.RandRange(0, Entries.Num() - 1)].SlotId);
+            break;
+        default:
+            Inventory->AddItemStack(FItemStack(MakeItemID(Stream.RandRange(0, NumItemTypes - 1)), Stream.RandRange(1, MaxStack)));
+            break;
+        }
+    }
+    const double ChurnSeconds = FPlatformTime::Seconds() - ChurnStart;
+
+    VerifyInventory(*this, Inventory);
+
+    // Removing a slot must leave every other slot id pointing at the same item
+    TMap<int32, FName> Before;
+    for (const FInventoryEntry& Entry : Inventory->GetEntries())
+    {
+        Before.Add(Entry.SlotId, Entry.Item.ItemID);
+    }
+
+    const int32 RemovedSlotId = Inventory->GetSlotIds()[0];
+    Inventory->RemoveFromSlot(RemovedSlotId, MAX_int32);
+    Before.Remove(RemovedSlotId);
+
+    for (const TPair<int32, FName>& Pair : Before)
+    {
+        FItemInstance SlotItem;
+        if (!Inventory->GetSlot(Pair.Key, SlotItem) || SlotItem.ItemID != Pair.Value)
+        {
+            ++NumMismatches;
+        }
+    }
+    TestEqual(TEXT("Slots moved by a removal"), NumMismatches, 0);
+
+    AddInfo(FString::Printf(TEXT("Looted %d bursts into %d slots in %.2f ms, %d churn ops in %.2f ms (%.2f us/op)"),
+        NumBursts, NumSlots, LootSeconds * 1000.0, NumChurnOps, ChurnSeconds * 1000.0, ChurnSeconds * 1000000.0 / NumChurnOps));
+
+    DestroyTestWorld(World);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
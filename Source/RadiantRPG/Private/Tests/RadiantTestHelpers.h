@@ -0,0 +1,54 @@
+// Private/Tests/RadiantTestHelpers.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+
+/**
+ * Shared setup for headless automation tests - a game world with no map, no
+ * game mode and no net driver
+ */
+namespace RadiantTestHelpers
+{
+    /** Game world registered with the engine. With bBeginPlay, BeginPlay is dispatched by hand - there is no game mode to do it */
+    inline UWorld* CreateTestWorld(bool bBeginPlay = false)
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        if (bBeginPlay)
+        {
+            World->InitializeActorsForPlay(FURL());
+            World->BeginPlay();
+            World->GetWorldSettings()->NotifyBeginPlay();
+        }
+
+        return World;
+    }
+
+    inline void DestroyTestWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    /** One stand-in player - a controller possessing a pawn at Location */
+    inline APlayerController* SpawnTestPlayer(UWorld* World, const FVector& Location)
+    {
+        APlayerController* Controller = World->SpawnActor<APlayerController>();
+        ADefaultPawn* Pawn = World->SpawnActor<ADefaultPawn>(Location, FRotator::ZeroRotator);
+        Controller->Possess(Pawn);
+        return Controller;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,248 @@
+// Private/Tests/ReplicationGraphTests.cpp
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/RadiantReplicationGraph.h"
+#include "Characters/ARPG_BaseNPCCharacter.h"
+#include "Interaction/SimpleInteractable.h"
+#include "World/RadiantZoneManager.h"
+#include "Tests/RadiantTestHelpers.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace RadiantReplicationGraphTests
+{
+    /** Inside a grid cell - the default cell size is 10000 and the bias keeps cell edges on multiples of it */
+    constexpr float CellCenter = 5000.0f;
+
+    /** Net cull distance of the test actors is 15000 - this keeps them out of every client's cells */
+    constexpr float FarDistance = 150000.0f;
+
+    /** One headless client - controller and pawn as its viewer, plus its connection-side graph state */
+    struct FTestClient
+    {
+        APlayerController* Controller = nullptr;
+        APawn* Pawn = nullptr;
+        UNetReplicationGraphConnection* ConnectionManager = nullptr;
+        URadiantReplicationGraphNode_ZoneForConnection* ZoneNode = nullptr;
+    };
+
+    /** Graph set up the way InitForNetDriver does it, without a net driver */
+    URadiantReplicationGraph* CreateTestGraph(UWorld* World)
+    {
+        URadiantReplicationGraph* Graph = NewObject<URadiantReplicationGraph>(GetTransientPackage());
+        Graph->InitGlobalActorClassSettings();
+        Graph->InitGlobalGraphNodes();
+        Graph->SetRepDriverWorld(World);
+        return Graph;
+    }
+
+    void AddNetworkActor(URadiantReplicationGraph* Graph, AActor* Actor)
+    {
+        Graph->RouteAddNetworkActorToNodes(FNewReplicatedActorInfo(Actor), Graph->GlobalActorReplicationInfoMap.Get(Actor));
+    }
+
+    FTestClient AddClient(URadiantReplicationGraph* Graph, UWorld* World, const FVector& Location)
+    {
+        FTestClient Client;
+        Client.Controller = RadiantTestHelpers::SpawnTestPlayer(World, Location);
+        Client.Pawn = Client.Controller->GetPawn();
+
+        // Stands in for a net connection - the nodes only read its per-actor map
+        Client.ConnectionManager = NewObject<UNetReplicationGraphConnection>(Graph);
+        Client.ConnectionManager->ActorInfoMap.Initialize(&Graph->GlobalActorReplicationInfoMap);
+        Client.ZoneNode = Graph->CreateNewNode<URadiantReplicationGraphNode_ZoneForConnection>();
+        return Client;
+    }
+
+    /** Run one node's gather for a client, adding every gathered actor to OutActors. Returns the gathered count */
+    int32 Gather(UReplicationGraphNode* Node, const FTestClient& Client, uint32 FrameNum, TArray<AActor*>* OutActors = nullptr)
+    {
+        FNetViewerArray Viewers;
+        FNetViewer& Viewer = Viewers.AddDefaulted_GetRef();
+        Viewer.InViewer = Client.Controller;
+        Viewer.ViewTarget = Client.Pawn;
+        Viewer.ViewLocation = Client.Pawn->GetActorLocation();
+
+        TSet<FName> VisibleLevels;
+        FGatheredReplicationActorLists Gathered;
+        FConnectionGatherActorListParameters Params(Viewers, *Client.ConnectionManager, VisibleLevels, FrameNum, Gathered, true);
+        Node->GatherActorListsForConnection(Params);
+
+        int32 NumGathered = 0;
+        for (const FActorRepListRawView& List : Gathered.GetLists(EActorRepListTypeFlags::Default))
+        {
+            NumGathered += List.Num();
+            if (OutActors)
+            {
+                for (int32 Index = 0; Index < List.Num(); ++Index)
+                {
+                    OutActors->Add(List[Index]);
+                }
+            }
+        }
+
+        return NumGathered;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FReplicationGraphRouting, "RadiantRPG.Net.ReplicationGraphRouting",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FReplicationGraphRouting::RunTest(const FString& Parameters)
+{
+    using namespace RadiantReplicationGraphTests;
+    using namespace RadiantTestHelpers;
+
+    UWorld* World = CreateTestWorld();
+    URadiantReplicationGraph* Graph = CreateTestGraph(World);
+
+    // Class routes
+    TestTrue(TEXT("NPCs route to the dormancy grid"),
+        Graph->GetMappingPolicy(AARPG_BaseNPCCharacter::StaticClass()) == ERadiantClassRepNodeMapping::Spatialize_Dormancy);
+    TestTrue(TEXT("Interactables route to the dormancy grid"),
+        Graph->GetMappingPolicy(ASimpleInteractable::StaticClass()) == ERadiantClassRepNodeMapping::Spatialize_Dormancy);
+    TestTrue(TEXT("Zones route to the zone connection node"),
+        Graph->GetMappingPolicy(ARadiantZoneManager::StaticClass()) == ERadiantClassRepNodeMapping::ZoneForConnection);
+
+    // Zone A around the origin, zone B further east - clients in A, in A, in B and outside both
+    ARadiantZoneManager* ZoneA = World->SpawnActor<ARadiantZoneManager>(FVector::ZeroVector, FRotator::ZeroRotator);
+    ARadiantZoneManager* ZoneB = World->SpawnActor<ARadiantZoneManager>(FVector(30000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+    AddNetworkActor(Graph, ZoneA);
+    AddNetworkActor(Graph, ZoneB);
+
+    const FVector ClientLocations[] = {
+        FVector(0.0f, 0.0f, 100.0f),
+        FVector(3000.0f, -3000.0f, 100.0f),
+        FVector(30000.0f, 0.0f, 100.0f),
+        FVector(60000.0f, 0.0f, 100.0f)
+    };
+    constexpr int32 NumClients = UE_ARRAY_COUNT(ClientLocations);
+
+    TArray<FTestClient> Clients;
+    for (const FVector& Location : ClientLocations)
+    {
+        Clients.Add(AddClient(Graph, World, Location));
+    }
+
+    // An NPC and an interactable next to zone A's clients
+    AARPG_BaseNPCCharacter* NPC = World->SpawnActor<AARPG_BaseNPCCharacter>(FVector(500.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+    ASimpleInteractable* Interactable = World->SpawnActor<ASimpleInteractable>(FVector(-500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+    AddNetworkActor(Graph, NPC);
+    AddNetworkActor(Graph, Interactable);
+
+    UReplicationGraphNode_GridSpatialization2D* GridNode = Graph->GetGridNode();
+    GridNode->PrepareForReplication();
+
+    const bool bInZoneA[NumClients] = { true, true, false, false };
+    const bool bInZoneB[NumClients] = { false, false, true, false };
+
+    uint32 FrameNum = 1;
+    for (int32 Index = 0; Index < NumClients; ++Index)
+    {
+        const FTestClient& Client = Clients[Index];
+
+        TArray<AActor*> ZoneGathered;
+        Gather(Client.ZoneNode, Client, FrameNum++, &ZoneGathered);
+
+        TestTrue(*FString::Printf(TEXT("Client %d gathers its controller"), Index), ZoneGathered.Contains(Client.Controller));
+        TestTrue(*FString::Printf(TEXT("Client %d gathers its pawn"), Index), ZoneGathered.Contains(Client.Pawn));
+        TestEqual(*FString::Printf(TEXT("Client %d gathers zone A only from inside it"), Index), ZoneGathered.Contains(ZoneA), bInZoneA[Index]);
+        TestEqual(*FString::Printf(TEXT("Client %d gathers zone B only from inside it"), Index), ZoneGathered.Contains(ZoneB), bInZoneB[Index]);
+
+        // The grid never carries zones, and only the clients near the origin see its actors
+        TArray<AActor*> GridGathered;
+        Gather(GridNode, Client, FrameNum++, &GridGathered);
+
+        TestFalse(*FString::Printf(TEXT("Client %d gets no zone from the grid"), Index), GridGathered.Contains(ZoneA) || GridGathered.Contains(ZoneB));
+        TestEqual(*FString::Printf(TEXT("Client %d grid NPC"), Index), GridGathered.Contains(NPC), bInZoneA[Index]);
+        TestEqual(*FString::Printf(TEXT("Client %d grid interactable"), Index), GridGathered.Contains(Interactable), bInZoneA[Index]);
+    }
+
+    // A removed zone reaches nobody
+    Graph->RouteRemoveNetworkActorToNodes(FNewReplicatedActorInfo(ZoneA));
+    TArray<AActor*> AfterRemove;
+    Gather(Clients[0].ZoneNode, Clients[0], FrameNum++, &AfterRemove);
+    TestFalse(TEXT("Removed zone is no longer gathered"), AfterRemove.Contains(ZoneA));
+    TestEqual(TEXT("Zone list after removal"), Graph->GetZoneActors().Num(), 1);
+
+    DestroyTestWorld(World);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FReplicationGraphGatherScaling, "RadiantRPG.Net.ReplicationGraphGatherScaling",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FReplicationGraphGatherScaling::RunTest(const FString& Parameters)
+{
+    using namespace RadiantReplicationGraphTests;
+    using namespace RadiantTestHelpers;
+
+    UWorld* World = CreateTestWorld();
+    URadiantReplicationGraph* Graph = CreateTestGraph(World);
+    UReplicationGraphNode_GridSpatialization2D* GridNode = Graph->GetGridNode();
+
+    // Clients four cells apart, each with a different crowd around it
+    const int32 NearbyActors[] = { 0, 25, 100, 400 };
+    constexpr int32 NumClients = UE_ARRAY_COUNT(NearbyActors);
+    constexpr int32 FarActorsPerStep = 2000;
+    constexpr int32 GathersPerSample = 200;
+
+    FRandomStream Stream(4242);
+
+    TArray<FTestClient> Clients;
+    for (int32 Index = 0; Index < NumClients; ++Index)
+    {
+        const FVector Location(CellCenter + Index * 40000.0f, CellCenter, 100.0f);
+        Clients.Add(AddClient(Graph, World, Location));
+
+        for (int32 Actor = 0; Actor < NearbyActors[Index]; ++Actor)
+        {
+            const FVector Offset(Stream.FRandRange(-2000.0f, 2000.0f), Stream.FRandRange(-2000.0f, 2000.0f), 0.0f);
+            AddNetworkActor(Graph, World->SpawnActor<ASimpleInteractable>(Location + Offset, FRotator::ZeroRotator));
+        }
+    }
+
+    uint32 FrameNum = 1;
+    int32 NumFarActors = 0;
+
+    // Same clients, same neighbours - the rest of the world grows each step
+    for (int32 Step = 0; Step < 3; ++Step)
+    {
+        GridNode->PrepareForReplication();
+
+        for (int32 Index = 0; Index < NumClients; ++Index)
+        {
+            const FTestClient& Client = Clients[Index];
+
+            TestEqual(*FString::Printf(TEXT("Client %d gathers only its neighbours with %d far actors"), Index, NumFarActors),
+                Gather(GridNode, Client, FrameNum++), NearbyActors[Index]);
+
+            const double Start = FPlatformTime::Seconds();
+            for (int32 Sample = 0; Sample < GathersPerSample; ++Sample)
+            {
+                Gather(GridNode, Client, FrameNum++);
+            }
+            const double Seconds = FPlatformTime::Seconds() - Start;
+
+            AddInfo(FString::Printf(TEXT("%d far actors: client with %d nearby actors gathers in %.2f us"),
+                NumFarActors, NearbyActors[Index], Seconds * 1000000.0 / GathersPerSample));
+        }
+
+        for (int32 Actor = 0; Actor < FarActorsPerStep; ++Actor)
+        {
+            const FVector Location(Stream.FRandRange(-FarDistance, FarDistance), FarDistance + Stream.FRandRange(0.0f, FarDistance), 0.0f);
+            AddNetworkActor(Graph, World->SpawnActor<ASimpleInteractable>(Location, FRotator::ZeroRotator));
+        }
+        NumFarActors += FarActorsPerStep;
+    }
+
+    DestroyTestWorld(World);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
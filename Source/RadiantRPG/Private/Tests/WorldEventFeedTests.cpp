@@ -0,0 +1,152 @@
+// Private/Tests/WorldEventFeedTests.cpp
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "World/WorldEventFeedComponent.h"
+#include "World/WorldEventManager.h"
+#include "World/WorldEventRelevancyManager.h"
+#include "Core/RadiantTimerManager.h"
+#include "Core/RadiantGameplayTags.h"
+#include "Tests/RadiantTestHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+namespace RadiantWorldEventFeedTests
+{
+    constexpr int32 NumWaves = 20;
+    constexpr int32 LocalEventsPerWave = 8;
+    constexpr float FlushInterval = 0.25f;
+
+    /** Distance of each client from the event source - near, edge of reach, out of reach, far away */
+    const float ClientDistances[] = { 0.0f, 3000.0f, 12000.0f, 60000.0f };
+    constexpr int32 NumClients = UE_ARRAY_COUNT(ClientDistances);
+
+    /** One player connection - controller, pawn at Location and its event feed */
+    UWorldEventFeedComponent* AddClient(UWorld* World, const FVector& Location)
+    {
+        APlayerController* Controller = RadiantTestHelpers::SpawnTestPlayer(World, Location);
+
+        // Registers with the relevancy manager from BeginPlay
+        UWorldEventFeedComponent* Feed = NewObject<UWorldEventFeedComponent>(Controller);
+        Feed->RegisterComponent();
+        return Feed;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorldEventFeedBitsPerClient, "RadiantRPG.Net.WorldEventFeedBitsPerClient",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWorldEventFeedBitsPerClient::RunTest(const FString& Parameters)
+{
+    using namespace RadiantWorldEventFeedTests;
+    using namespace RadiantTestHelpers;
+
+    // Bit measurement is off by default - turn it on for this test only
+    IConsoleVariable* MeasureBitsVar = IConsoleManager::Get().FindConsoleVariable(TEXT("radiant.net.measurefeedbits"));
+    if (!TestNotNull(TEXT("Feed bit measurement cvar"), MeasureBitsVar))
+    {
+        return false;
+    }
+    const int32 PreviousMeasureBits = MeasureBitsVar->GetInt();
+    MeasureBitsVar->Set(1, ECVF_SetByCode);
+
+    UWorld* World = CreateTestWorld(true);
+
+    UWorldEventManager* EventManager = World->GetSubsystem<UWorldEventManager>();
+    UWorldEventRelevancyManager* RelevancyManager = World->GetSubsystem<UWorldEventRelevancyManager>();
+    URadiantTimerManager* Timers = World->GetSubsystem<URadiantTimerManager>();
+    if (!TestNotNull(TEXT("Event manager"), EventManager) || !TestNotNull(TEXT("Relevancy manager"), RelevancyManager) || !TestNotNull(TEXT("Timer manager"), Timers))
+    {
+        DestroyTestWorld(World);
+        MeasureBitsVar->Set(PreviousMeasureBits, ECVF_SetByCode);
+        return false;
+    }
+
+    FWorldEventRelevancyConfig Config;
+    Config.FlushInterval = FlushInterval;
+    Config.MaxEventsPerBatch = 16;
+    Config.RelevancyPadding = 2000.0f;
+    Config.ZoneScopeDistance = 5000.0f;
+    RelevancyManager->ConfigureRelevancy(Config);
+
+    TArray<UWorldEventFeedComponent*> Feeds;
+    for (int32 Client = 0; Client < NumClients; ++Client)
+    {
+        Feeds.Add(AddClient(World, FVector(ClientDistances[Client], 0.0f, 0.0f)));
+    }
+
+    // Local chatter at the origin in every priority, plus one global event per wave
+    int32 NumBroadcasts = 0;
+    for (int32 Wave = 0; Wave < NumWaves; ++Wave)
+    {
+        for (int32 Index = 0; Index < LocalEventsPerWave; ++Index)
+        {
+            FWorldEvent Event;
+            Event.EventTag = TAG_FactionEvent;
+            Event.Scope = EEventScope::Local;
+            Event.Priority = (EEventPriority)(Index % 3);
+            Event.Location = FVector(0.0f, (float)Index * 10.0f, 0.0f);
+            Event.Radius = 500.0f;
+            EventManager->BroadcastEvent(Event);
+            ++NumBroadcasts;
+        }
+
+        FWorldEvent GlobalEvent;
+        GlobalEvent.EventTag = TAG_FactionEvent;
+        GlobalEvent.Scope = EEventScope::Global;
+        EventManager->BroadcastEvent(GlobalEvent);
+        ++NumBroadcasts;
+
+        Timers->Tick(FlushInterval);
+    }
+
+    // Drain whatever is still queued
+    for (int32 Flush = 0; Flush < 4; ++Flush)
+    {
+        Timers->Tick(FlushInterval);
+    }
+
+    TArray<FWorldEventFeedStats> Stats;
+    for (const UWorldEventFeedComponent* Feed : Feeds)
+    {
+        Stats.Add(Feed->GetFeedStats());
+    }
+
+    for (int32 Client = 0; Client < NumClients; ++Client)
+    {
+        const FWorldEventFeedStats& ClientStats = Stats[Client];
+        TestEqual(*FString::Printf(TEXT("Client %d accounts for every broadcast"), Client),
+            ClientStats.EventsSent + ClientStats.EventsFiltered, NumBroadcasts);
+        TestEqual(*FString::Printf(TEXT("Client %d dropped nothing"), Client), ClientStats.EventsDropped, 0);
+        TestTrue(*FString::Printf(TEXT("Client %d received the global events"), Client), ClientStats.EventsSent >= NumWaves);
+        TestTrue(*FString::Printf(TEXT("Client %d measured bits"), Client), ClientStats.BitsSent > 0);
+    }
+
+    // Bits follow relevance - nearer clients pay for more of the local chatter
+    TestEqual(TEXT("Nearest client receives everything"), Stats[0].EventsSent, NumBroadcasts);
+    TestTrue(TEXT("Edge client costs less than the nearest"), Stats[1].BitsSent < Stats[0].BitsSent);
+    TestTrue(TEXT("Out-of-reach client costs less than the edge"), Stats[2].BitsSent < Stats[1].BitsSent);
+    TestEqual(TEXT("Clients beyond reach cost the same"), Stats[3].BitsSent, Stats[2].BitsSent);
+
+    // Without filtering every client would pay what the nearest one does
+    int64 TotalBits = 0;
+    for (const FWorldEventFeedStats& ClientStats : Stats)
+    {
+        TotalBits += ClientStats.BitsSent;
+        AddInfo(FString::Printf(TEXT("Client: %d events in %d batches, %lld bits (%.1f bits/event), %d filtered"),
+            ClientStats.EventsSent, ClientStats.BatchesSent, ClientStats.BitsSent,
+            ClientStats.EventsSent > 0 ? (double)ClientStats.BitsSent / ClientStats.EventsSent : 0.0, ClientStats.EventsFiltered));
+    }
+
+    const int64 UnfilteredBits = Stats[0].BitsSent * NumClients;
+    AddInfo(FString::Printf(TEXT("%d clients: %lld bits sent, %lld unfiltered (%.1f%% saved)"),
+        NumClients, TotalBits, UnfilteredBits, UnfilteredBits > 0 ? 100.0 * (1.0 - (double)TotalBits / UnfilteredBits) : 0.0));
+
+    DestroyTestWorld(World);
+    MeasureBitsVar->Set(PreviousMeasureBits, ECVF_SetByCode);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
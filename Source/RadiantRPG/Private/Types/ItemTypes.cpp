@@ -2,3 +2,216 @@
 
 
 #include "Types/ItemTypes.h"
+#include "Serialization/CustomVersion.h"
+
+/** FItemInstance package layout versions */
+struct FRadiantItemCustomVersion
+{
+    enum Type
+    {
+        /** Tagged properties only - unique data in a one-element array or legacy fields */
+        BeforeCustomVersionWasAdded = 0,
+
+        /** Unique data serialized as an optional block after the tagged properties */
+        SharedUniqueData,
+
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    static const FGuid GUID;
+};
+
+const FGuid FRadiantItemCustomVersion::GUID(0x7A3C41E2, 0x5B9D4F08, 0x9E61C2D7, 0x34A8F015);
+
+static FCustomVersionRegistration GRegisterRadiantItemCustomVersion(FRadiantItemCustomVersion::GUID, FRadiantItemCustomVersion::LatestVersion, TEXT("RadiantItemVer"));
+
+const FGuid& FItemInstance::EnsureUniqueID()
+{
+    if (!UniqueID.IsValid())
+    {
+        UniqueID = FGuid::NewGuid();
+    }
+    return UniqueID;
+}
+
+FItemUniqueData& FItemInstance::GetOrCreateUniqueData()
+{
+    if (!UniqueData.IsValid())
+    {
+        UniqueData = MakeShared<FItemUniqueData>();
+    }
+    else if (!UniqueData.IsUnique())
+    {
+        // Copy on write - other copies of this instance keep the old block
+        UniqueData = MakeShared<FItemUniqueData>(*UniqueData);
+    }
+    return *UniqueData;
+}
+
+void FItemInstance::CompactUniqueData()
+{
+    if (UniqueData.IsValid() && UniqueData->IsEmpty())
+    {
+        UniqueData.Reset();
+    }
+}
+
+bool FItemInstance::IsStackable() const
+{
+    // Anything with its own identity or wear can't merge into a stack
+    return !HasUniqueData() && Durability >= MaxDurability;
+}
+
+bool FItemInstance::CanStackWith(const FItemInstance& Other) const
+{
+    return ItemID == Other.ItemID
+        && Quality == Other.Quality
+        && IsStackable()
+        && Other.IsStackable();
+}
+
+bool FItemInstance::Serialize(FArchive& Ar)
+{
+    Ar.UsingCustomVersion(FRadiantItemCustomVersion::GUID);
+
+    UScriptStruct* Struct = StaticStruct();
+    if (Ar.IsLoading() && Ar.CustomVer(FRadiantItemCustomVersion::GUID) < FRadiantItemCustomVersion::SharedUniqueData)
+    {
+        // Written by the default tagged serializer with the old fields on the struct
+        FItemInstanceLegacy Legacy;
+        UScriptStruct* LegacyStruct = FItemInstanceLegacy::StaticStruct();
+        LegacyStruct->SerializeTaggedProperties(Ar, (uint8*)&Legacy, LegacyStruct, nullptr);
+        Legacy.UpgradeTo(*this);
+        return true;
+    }
+
+    Struct->SerializeTaggedProperties(Ar, (uint8*)this, Struct, nullptr);
+
+    bool bHasUniqueData = UniqueData.IsValid();
+    Ar << bHasUniqueData;
+    if (Ar.IsLoading())
+    {
+        UniqueData.Reset();
+        if (bHasUniqueData)
+        {
+            UniqueData = MakeShared<FItemUniqueData>();
+        }
+    }
+    if (bHasUniqueData)
+    {
+        FItemUniqueData::StaticStruct()->SerializeItem(Ar, UniqueData.Get(), nullptr);
+    }
+
+    return true;
+}
+
+bool FItemInstance::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << ItemID;
+    Ar << UniqueID;
+    Ar << Quantity;
+    Ar << Durability;
+    Ar << MaxDurability;
+    Ar << Quality;
+
+    // One bit for fungible items
+    uint8 bHasUniqueData = UniqueData.IsValid() ? 1 : 0;
+    Ar.SerializeBits(&bHasUniqueData, 1);
+    if (Ar.IsLoading())
+    {
+        UniqueData.Reset();
+        if (bHasUniqueData)
+        {
+            UniqueData = MakeShared<FItemUniqueData>();
+        }
+    }
+    if (bHasUniqueData)
+    {
+        FItemUniqueData::StaticStruct()->SerializeBin(Ar, UniqueData.Get());
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FItemInstance::Identical(const FItemInstance* Other, uint32 PortFlags) const
+{
+    if (ItemID != Other->ItemID || UniqueID != Other->UniqueID || Quantity != Other->Quantity
+        || Durability != Other->Durability || MaxDurability != Other->MaxDurability || Quality != Other->Quality)
+    {
+        return false;
+    }
+
+    if (UniqueData == Other->UniqueData)
+    {
+        return true;
+    }
+
+    return UniqueData.IsValid() && Other->UniqueData.IsValid()
+        && FItemUniqueData::StaticStruct()->CompareScriptStruct(UniqueData.Get(), Other->UniqueData.Get(), PortFlags);
+}
+
+void FItemInstanceLegacy::UpgradeTo(FItemInstance& Item)
+{
+    Item.ItemID = ItemID;
+    Item.UniqueID = UniqueID;
+    Item.Quantity = Quantity;
+    Item.Durability = Durability;
+    Item.MaxDurability = MaxDurability;
+    Item.Quality = Quality;
+    Item.UniqueData.Reset();
+
+    if (UniqueData.Num() > 0)
+    {
+        Item.GetOrCreateUniqueData() = MoveTemp(UniqueData[0]);
+    }
+
+    if (Affixes.Num() > 0 || BonusStats.Num() > 0 || !CustomTags.IsEmpty() || CustomData.Num() > 0)
+    {
+        FItemUniqueData& Data = Item.GetOrCreateUniqueData();
+        Data.Affixes.Append(MoveTemp(Affixes));
+        Data.BonusStats.Append(MoveTemp(BonusStats));
+        Data.CustomTags.AppendTags(CustomTags);
+        Data.CustomData.Append(MoveTemp(CustomData));
+    }
+
+    Item.CompactUniqueData();
+}
+
+bool FCraftingRecipe::UpgradeLegacyData()
+{
+    if (RequiredItems.Num() == 0 && OutputItems.Num() == 0)
+    {
+        return false;
+    }
+
+    // Recipe items are fungible - only the stack part carries over
+    for (const FItemInstance& Item : RequiredItems)
+    {
+        RequiredStacks.Add(Item.ToStack());
+    }
+    for (const FItemInstance& Item : OutputItems)
+    {
+        OutputStacks.Add(Item.ToStack());
+    }
+
+    RequiredItems.Empty();
+    OutputItems.Empty();
+    return true;
+}
+
+void FCraftingRecipe::PostSerialize(const FArchive& Ar)
+{
+    if (Ar.IsLoading())
+    {
+        UpgradeLegacyData();
+    }
+}
+
+void FCraftingRecipe::OnPostDataImport(const UDataTable* InDataTable, const FName InRowName, TArray<FString>& OutCollectedImportProblems)
+{
+    Super::OnPostDataImport(InDataTable, InRowName, OutCollectedImportProblems);
+
+    UpgradeLegacyData();
+}
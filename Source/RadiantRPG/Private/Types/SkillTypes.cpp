@@ -2,3 +2,65 @@
 
 
 #include "Types/SkillTypes.h"
+
+void FSkillSynergyGraph::Compile(const TArray<FSkillSynergy>& Synergies)
+{
+    Edges.Reset();
+    EdgesBySecondary.Reset();
+    EdgesBySecondary.SetNum((int32)ESkillType::MAX);
+
+    for (const FSkillSynergy& Synergy : Synergies)
+    {
+        const ESkillType Primary = ResolveSkillName(Synergy.PrimarySkill);
+        const ESkillType Secondary = ResolveSkillName(Synergy.SecondarySkill);
+
+        if (Primary == ESkillType::MAX || Secondary == ESkillType::MAX)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SkillSynergyGraph: Skipping synergy %s -> %s, unknown skill"),
+                   *Synergy.SecondarySkill.ToString(), *Synergy.PrimarySkill.ToString());
+            continue;
+        }
+
+        const int32 EdgeIndex = Edges.Add({ Primary, Secondary, Synergy.SynergyBonus, Synergy.RequiredSecondaryLevel });
+        EdgesBySecondary[(int32)Secondary].Add(EdgeIndex);
+    }
+}
+
+const TArray<int32>& FSkillSynergyGraph::GetEdgesFromSecondary(ESkillType SecondarySkill) const
+{
+    static const TArray<int32> NoEdges;
+    const int32 SkillIndex = (int32)SecondarySkill;
+    return EdgesBySecondary.IsValidIndex(SkillIndex) ? EdgesBySecondary[SkillIndex] : NoEdges;
+}
+
+ESkillType FSkillSynergyGraph::ResolveSkillName(FName SkillName)
+{
+    const UEnum* SkillEnum = StaticEnum<ESkillType>();
+    if (!SkillEnum || SkillName.IsNone())
+    {
+        return ESkillType::MAX;
+    }
+
+    // Accept "OneHanded", "ESkillType::OneHanded" or a tag such as "Skill.Combat.OneHanded"
+    FString NameString = SkillName.ToString();
+    int32 DotIndex = INDEX_NONE;
+    if (NameString.FindLastChar(TEXT('.'), DotIndex))
+    {
+        NameString.RightChopInline(DotIndex + 1);
+    }
+
+    int64 Value = SkillEnum->GetValueByNameString(NameString);
+    if (Value == INDEX_NONE)
+    {
+        for (int32 EnumIndex = 0; EnumIndex < SkillEnum->NumEnums() - 1; ++EnumIndex)
+        {
+            if (SkillEnum->GetDisplayNameTextByIndex(EnumIndex).ToString().Equals(NameString, ESearchCase::IgnoreCase))
+            {
+                Value = SkillEnum->GetValueByIndex(EnumIndex);
+                break;
+            }
+        }
+    }
+
+    return (Value == INDEX_NONE || Value >= (int64)ESkillType::MAX) ? ESkillType::MAX : (ESkillType)Value;
+}
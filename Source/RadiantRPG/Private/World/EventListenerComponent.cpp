@@ -3,7 +3,6 @@
 #include "World/EventListenerComponent.h"
 #include "World/WorldEventManager.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 UEventListenerComponent::UEventListenerComponent()
 {
@@ -59,13 +58,10 @@ void UEventListenerComponent::BeginPlay()
         }
 
         // Start memory update timer
-        World->GetTimerManager().SetTimer(
-            MemoryUpdateTimer,
-            this,
-            &UEventListenerComponent::UpdateMemory,
-            5.0f,
-            true
-        );
+        if (URadiantTimerManager* RadiantTimers = World->GetSubsystem<URadiantTimerManager>())
+        {
+            MemoryUpdateTimer = RadiantTimers->SetTimer(this, &UEventListenerComponent::UpdateMemory, 5.0f, true);
+        }
     }
 }
 
@@ -78,9 +74,9 @@ void UEventListenerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     }
 
     // Clear timer
-    if (GetWorld())
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
     {
-        GetWorld()->GetTimerManager().ClearTimer(MemoryUpdateTimer);
+        RadiantTimers->ClearTimer(MemoryUpdateTimer);
     }
 
     Super::EndPlay(EndPlayReason);
@@ -0,0 +1,238 @@
+// Source/RadiantRPG/Private/World/FactionControlManager.cpp
+
+#include "World/FactionControlManager.h"
+#include "World/RadiantZoneManager.h"
+#include "Managers/FactionRegistry.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+void UFactionControlManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    UE_LOG(LogTemp, Log, TEXT("FactionControlManager initialized"));
+}
+
+void UFactionControlManager::Deinitialize()
+{
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
+    {
+        RadiantTimers->ClearTimer(UpdateTimerHandle);
+    }
+
+    Zones.Empty();
+    ControllingFactions.Empty();
+    ContestingFactions.Empty();
+    ControlStrengths.Empty();
+    DecayRates.Empty();
+    ActiveFlags.Empty();
+    ZoneIndices.Empty();
+    ZoneKeys.Empty();
+    NumContested = 0;
+
+    Super::Deinitialize();
+}
+
+void UFactionControlManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    RestartUpdateTimer();
+}
+
+bool UFactionControlManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UFactionControlManager::ConfigureSimulation(const FFactionControlConfig& Config)
+{
+    SimulationConfig = Config;
+    RestartUpdateTimer();
+}
+
+void UFactionControlManager::RestartUpdateTimer()
+{
+    UWorld* World = GetWorld();
+    URadiantTimerManager* RadiantTimers = World ? World->GetSubsystem<URadiantTimerManager>() : nullptr;
+    if (!RadiantTimers)
+    {
+        return;
+    }
+
+    RadiantTimers->ClearTimer(UpdateTimerHandle);
+
+    if (SimulationConfig.bEnableSimulation && World->HasBegunPlay())
+    {
+        UpdateTimerHandle = RadiantTimers->SetTimer(this, &UFactionControlManager::UpdateControl, SimulationConfig.UpdateInterval, true);
+    }
+}
+
+// Zone Registration
+void UFactionControlManager::RegisterZone(ARadiantZoneManager* Zone, FGameplayTag ControllingFaction, float ControlStrength, float DecayPerSecond)
+{
+    if (!Zone || ZoneIndices.Contains(Zone))
+    {
+        return;
+    }
+
+    const int32 Index = Zones.Add(Zone);
+    ZoneKeys.Add(Zone);
+    ControllingFactions.Add(ControllingFaction);
+    ContestingFactions.Add(FGameplayTag());
+    ControlStrengths.Add(ControlStrength);
+    DecayRates.Add(FMath::Max(0.0f, DecayPerSecond));
+    ActiveFlags.Add(Zone->IsZoneActive());
+    ZoneIndices.Add(Zone, Index);
+}
+
+void UFactionControlManager::UnregisterZone(ARadiantZoneManager* Zone)
+{
+    int32 Index = INDEX_NONE;
+    if (!ZoneIndices.RemoveAndCopyValue(Zone, Index))
+    {
+        return;
+    }
+
+    if (ContestingFactions[Index].IsValid())
+    {
+        --NumContested;
+    }
+
+    Zones.RemoveAtSwap(Index);
+    ZoneKeys.RemoveAtSwap(Index);
+    ControllingFactions.RemoveAtSwap(Index);
+    ContestingFactions.RemoveAtSwap(Index);
+    ControlStrengths.RemoveAtSwap(Index);
+    DecayRates.RemoveAtSwap(Index);
+    ActiveFlags.RemoveAtSwap(Index);
+
+    // Fix up the zone that was swapped into the freed slot
+    if (Zones.IsValidIndex(Index))
+    {
+        ZoneIndices.Add(ZoneKeys[Index], Index);
+    }
+}
+
+void UFactionControlManager::SetZoneActive(ARadiantZoneManager* Zone, bool bActive)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index != INDEX_NONE)
+    {
+        ActiveFlags[Index] = bActive;
+    }
+}
+
+// Control State
+void UFactionControlManager::SetZoneController(ARadiantZoneManager* Zone, FGameplayTag FactionTag)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (ContestingFactions[Index].IsValid())
+    {
+        ContestingFactions[Index] = FGameplayTag();
+        --NumContested;
+    }
+
+    const bool bChanged = ControllingFactions[Index] != FactionTag;
+    ControllingFactions[Index] = FactionTag;
+    ControlStrengths[Index] = 1.0f;
+
+    if (bChanged)
+    {
+        if (UFactionRegistry* Registry = GetWorld()->GetGameInstance() ? GetWorld()->GetGameInstance()->GetSubsystem<UFactionRegistry>() : nullptr)
+        {
+            Registry->SetTerritoryOwner(Zone->GetZoneTag().GetTagName(), Registry->FindFactionIDByTag(FactionTag));
+        }
+    }
+}
+
+void UFactionControlManager::StartConflict(ARadiantZoneManager* Zone, FGameplayTag AttackingFaction)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index == INDEX_NONE || !AttackingFaction.IsValid() || AttackingFaction == ControllingFactions[Index])
+    {
+        return;
+    }
+
+    if (!ContestingFactions[Index].IsValid())
+    {
+        ++NumContested;
+    }
+    ContestingFactions[Index] = AttackingFaction;
+}
+
+float UFactionControlManager::GetControlStrength(const ARadiantZoneManager* Zone) const
+{
+    const int32 Index = FindZoneIndex(Zone);
+    return Index != INDEX_NONE ? ControlStrengths[Index] : 0.0f;
+}
+
+bool UFactionControlManager::IsZoneContested(const ARadiantZoneManager* Zone) const
+{
+    const int32 Index = FindZoneIndex(Zone);
+    return Index != INDEX_NONE && ContestingFactions[Index].IsValid();
+}
+
+// Simulation
+void UFactionControlManager::UpdateControl()
+{
+    if (NumContested == 0)
+    {
+        return;
+    }
+
+    const float DeltaTime = SimulationConfig.UpdateInterval;
+    TArray<int32, TInlineAllocator<8>> Captured;
+
+    for (int32 Index = 0; Index < ControlStrengths.Num(); ++Index)
+    {
+        if (!ActiveFlags[Index] || !ContestingFactions[Index].IsValid())
+        {
+            continue;
+        }
+
+        ControlStrengths[Index] -= DecayRates[Index] * DeltaTime;
+
+        if (ControlStrengths[Index] <= 0.0f)
+        {
+            Captured.Add(Index);
+        }
+    }
+
+    // Notify after the pass - zone callbacks may re-enter the manager
+    for (int32 Index : Captured)
+    {
+        NotifyControlChanged(Index);
+    }
+}
+
+void UFactionControlManager::NotifyControlChanged(int32 ZoneIndex)
+{
+    const FGameplayTag NewController = ContestingFactions[ZoneIndex];
+
+    if (ARadiantZoneManager* Zone = Zones[ZoneIndex].Get())
+    {
+        // The zone routes back through SetZoneController, which resets strength and conflict state
+        Zone->SetControllingFaction(NewController);
+    }
+    else
+    {
+        ControllingFactions[ZoneIndex] = NewController;
+        ContestingFactions[ZoneIndex] = FGameplayTag();
+        ControlStrengths[ZoneIndex] = 1.0f;
+        --NumContested;
+    }
+}
+
+int32 UFactionControlManager::FindZoneIndex(const ARadiantZoneManager* Zone) const
+{
+    const int32* Index = ZoneIndices.Find(Zone);
+    return Index ? *Index : INDEX_NONE;
+}
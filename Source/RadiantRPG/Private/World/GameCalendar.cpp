@@ -0,0 +1,142 @@
+// Private/World/GameCalendar.cpp
+
+#include "World/GameCalendar.h"
+
+int32 FGameCalendar::GetPeriodMinutes(ECalendarRecurrence Recurrence)
+{
+    switch (Recurrence)
+    {
+        case ECalendarRecurrence::Hourly:
+            return MinutesPerHour;
+        case ECalendarRecurrence::Daily:
+            return MinutesPerDay;
+        case ECalendarRecurrence::Seasonal:
+            return MinutesPerSeason;
+        default:
+            return MinutesPerDay;
+    }
+}
+
+void FGameCalendar::Reset(int32 NowMinutes)
+{
+    Events.Empty();
+    Heap.Empty();
+    CurrentMinutes = NowMinutes;
+}
+
+FCalendarEventHandle FGameCalendar::ScheduleAt(int32 DueMinutes, FCalendarCallback Callback)
+{
+    FEvent Event;
+    Event.Callback = MoveTemp(Callback);
+    Event.DueMinutes = DueMinutes;
+    return AddEvent(MoveTemp(Event));
+}
+
+FCalendarEventHandle FGameCalendar::ScheduleAfter(int32 DelayMinutes, FCalendarCallback Callback)
+{
+    return ScheduleAt(CurrentMinutes + FMath::Max(DelayMinutes, 0), MoveTemp(Callback));
+}
+
+FCalendarEventHandle FGameCalendar::ScheduleEvery(int32 PeriodMinutes, int32 OffsetMinutes, FCalendarCallback Callback)
+{
+    if (PeriodMinutes <= 0)
+    {
+        return FCalendarEventHandle();
+    }
+
+    FEvent Event;
+    Event.Callback = MoveTemp(Callback);
+    Event.PeriodMinutes = PeriodMinutes;
+    Event.OffsetMinutes = OffsetMinutes % PeriodMinutes;
+    Event.DueMinutes = NextOccurrence(CurrentMinutes, PeriodMinutes, Event.OffsetMinutes);
+    return AddEvent(MoveTemp(Event));
+}
+
+FCalendarEventHandle FGameCalendar::AddEvent(FEvent&& Event)
+{
+    if (!Event.Callback.IsBound())
+    {
+        return FCalendarEventHandle();
+    }
+
+    FCalendarEventHandle Handle;
+    Handle.ID = NextEventID++;
+
+    Heap.HeapPush(FHeapNode{ Event.DueMinutes, Handle.ID });
+    Events.Add(Handle.ID, MoveTemp(Event));
+    return Handle;
+}
+
+void FGameCalendar::Cancel(FCalendarEventHandle& Handle)
+{
+    // The heap node is left behind and skipped when it surfaces
+    Events.Remove(Handle.ID);
+    Handle.Invalidate();
+}
+
+void FGameCalendar::AdvanceTo(int32 NowMinutes, const FSimpleWorldTime& Time)
+{
+    if (NowMinutes < CurrentMinutes)
+    {
+        Rebase(NowMinutes);
+        return;
+    }
+
+    CurrentMinutes = NowMinutes;
+
+    while (Heap.Num() > 0 && Heap.HeapTop().DueMinutes <= NowMinutes)
+    {
+        FHeapNode Node;
+        Heap.HeapPop(Node);
+
+        FEvent* Event = Events.Find(Node.ID);
+        if (!Event || Event->DueMinutes != Node.DueMinutes)
+        {
+            continue;
+        }
+
+        // Copy out before calling - callbacks may schedule or cancel events
+        FCalendarCallback Callback;
+        int32 Occurrences = 1;
+
+        if (Event->PeriodMinutes > 0)
+        {
+            Occurrences += (NowMinutes - Event->DueMinutes) / Event->PeriodMinutes;
+            Event->DueMinutes = NextOccurrence(NowMinutes, Event->PeriodMinutes, Event->OffsetMinutes);
+            Heap.HeapPush(FHeapNode{ Event->DueMinutes, Node.ID });
+            Callback = Event->Callback;
+        }
+        else
+        {
+            Callback = MoveTemp(Event->Callback);
+            Events.Remove(Node.ID);
+        }
+
+        Callback.ExecuteIfBound(Time, Occurrences);
+    }
+}
+
+void FGameCalendar::Rebase(int32 NowMinutes)
+{
+    CurrentMinutes = NowMinutes;
+    Heap.Reset();
+
+    for (TPair<int32, FEvent>& Pair : Events)
+    {
+        FEvent& Event = Pair.Value;
+        if (Event.PeriodMinutes > 0)
+        {
+            Event.DueMinutes = NextOccurrence(NowMinutes, Event.PeriodMinutes, Event.OffsetMinutes);
+        }
+        Heap.Add(FHeapNode{ Event.DueMinutes, Pair.Key });
+    }
+
+    Heap.Heapify();
+}
+
+int32 FGameCalendar::NextOccurrence(int32 NowMinutes, int32 PeriodMinutes, int32 OffsetMinutes)
+{
+    const int32 SinceOffset = NowMinutes - OffsetMinutes;
+    const int32 PeriodIndex = SinceOffset >= 0 ? SinceOffset / PeriodMinutes : -((PeriodMinutes - 1 - SinceOffset) / PeriodMinutes);
+    return OffsetMinutes + (PeriodIndex + 1) * PeriodMinutes;
+}
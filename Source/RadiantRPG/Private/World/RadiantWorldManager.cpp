@@ -6,6 +6,7 @@
 #include "EngineUtils.h"
 #include "World/RadiantZoneManager.h"
 #include "World/WorldEventManager.h"
+#include "World/ZoneTravelGraph.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "TimerManager.h"
@@ -229,13 +230,7 @@ FWorldState URadiantWorldManager::GetWorldStateSnapshot() const
             FString ZoneKey = ZonePair.Key.ToString();
             
             // Create zone data from the zone actor
-            FZoneData ZoneData;
-            ZoneData.ZoneID = *ZoneKey;
-            ZoneData.DisplayName = FText::FromString(ZoneKey);
-            ZoneData.ZoneType = ZonePair.Value->GetZoneType();
-            ZoneData.ControllingFaction = ZonePair.Value->GetControllingFaction().GetTagName();
-            
-            WorldState.Zones.Add(ZoneKey, ZoneData);
+            WorldState.Zones.Add(ZoneKey, ZonePair.Value->GetZoneData());
             
             // Store zone population
             WorldState.ZonePopulations.Add(ZoneKey, ZonePair.Value->GetActorsInZone().Num());
@@ -252,6 +247,16 @@ FWorldState URadiantWorldManager::GetWorldStateSnapshot() const
         }
     }
     
+    // Unloaded zones keep their last known data
+    for (const auto& SavedPair : SavedZones)
+    {
+        const FString ZoneKey = SavedPair.Key.ToString();
+        if (!WorldState.Zones.Contains(ZoneKey))
+        {
+            WorldState.Zones.Add(ZoneKey, SavedPair.Value);
+        }
+    }
+
     // Store active events
     for (const FActiveWorldEvent& Event : ActiveWorldEvents)
     {
@@ -324,8 +329,11 @@ void URadiantWorldManager::ApplyWorldStateSnapshot(const FWorldState& WorldState
     }
     
     // Apply zone data
+    SavedZones.Reset();
     for (const auto& ZonePair : WorldState.Zones)
     {
+        SavedZones.Add(ZonePair.Value.ZoneID.IsNone() ? FName(*ZonePair.Key) : ZonePair.Value.ZoneID, ZonePair.Value);
+
         FGameplayTag ZoneTag = FGameplayTag::RequestGameplayTag(*ZonePair.Key);
         if (ARadiantZoneManager* Zone = GetZoneByTag(ZoneTag))
         {
@@ -343,9 +351,15 @@ void URadiantWorldManager::ApplyWorldStateSnapshot(const FWorldState& WorldState
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("Zone not found for state application: %s"), *ZonePair.Key);
+            UE_LOG(LogTemp, Verbose, TEXT("Zone not loaded for state application: %s"), *ZonePair.Key);
         }
     }
+
+    // Travelers route through saved zones whether or not they are loaded
+    if (UZoneTravelGraph* TravelGraph = GetWorld() ? GetWorld()->GetSubsystem<UZoneTravelGraph>() : nullptr)
+    {
+        TravelGraph->SeedZones(SavedZones);
+    }
     
     // Clear and reapply world events
     ActiveWorldEvents.Empty();
@@ -503,6 +517,34 @@ void URadiantWorldManager::SetTimeProgression(bool bPaused)
     SetTimePaused(bPaused);
 }
 
+// === CALENDAR INTERFACE ===
+
+FCalendarEventHandle URadiantWorldManager::ScheduleCalendarEvent(int32 GameMinute, FOnCalendarEvent Callback)
+{
+    return Calendar.ScheduleAt(GameMinute, FCalendarCallback::CreateLambda([Callback](const FSimpleWorldTime& Time, int32 Occurrences)
+    {
+        Callback.ExecuteIfBound(Time, Occurrences);
+    }));
+}
+
+FCalendarEventHandle URadiantWorldManager::ScheduleCalendarEventAfter(int32 DelayMinutes, FOnCalendarEvent Callback)
+{
+    return ScheduleCalendarEvent(Calendar.GetCurrentMinutes() + FMath::Max(DelayMinutes, 0), Callback);
+}
+
+FCalendarEventHandle URadiantWorldManager::ScheduleRecurringCalendarEvent(ECalendarRecurrence Recurrence, int32 OffsetMinutes, FOnCalendarEvent Callback)
+{
+    return Calendar.ScheduleRecurring(Recurrence, OffsetMinutes, FCalendarCallback::CreateLambda([Callback](const FSimpleWorldTime& Time, int32 Occurrences)
+    {
+        Callback.ExecuteIfBound(Time, Occurrences);
+    }));
+}
+
+void URadiantWorldManager::CancelCalendarEvent(FCalendarEventHandle& Handle)
+{
+    Calendar.Cancel(Handle);
+}
+
 // === WEATHER SYSTEM INTERFACE ===
 
 void URadiantWorldManager::SetGlobalWeather(EWeatherType NewWeather, float Intensity, float TransitionTime)
@@ -530,8 +572,8 @@ void URadiantWorldManager::SetZoneWeather(FGameplayTag ZoneTag, EWeatherType New
 
 void URadiantWorldManager::UpdateWeatherSystem()
 {
-    // Update weather transition
-    CalculateWeatherTransition(WeatherSettings.UpdateInterval);
+    // Transition progress is advanced every tick by CalculateWeatherTransition and
+    // zone weather is owned by UWeatherScheduler - this only commits finished transitions
     
     // Trigger weather events if needed
     if (CurrentGlobalWeather.TransitionProgress >= 1.0f && 
@@ -601,6 +643,10 @@ void URadiantWorldManager::UnregisterZone(ARadiantZoneManager* Zone)
     FGameplayTag ZoneTag = Zone->GetZoneTag();
     if (RegisteredZones.Contains(ZoneTag) && RegisteredZones[ZoneTag] == Zone)
     {
+        // Unloading - later saves and travel routes keep what the zone looked like
+        const FZoneData ZoneData = Zone->GetZoneData();
+        SavedZones.Add(ZoneData.ZoneID, ZoneData);
+
         RegisteredZones.Remove(ZoneTag);
         UE_LOG(LogTemp, Log, TEXT("Unregistered zone: %s"), *ZoneTag.ToString());
     }
@@ -777,9 +823,29 @@ void URadiantWorldManager::InitializeSimpleTimeSystem()
     PreviousTimeOfDay = CurrentWorldTime.GetTimeOfDay();
     PreviousSeason = CurrentWorldTime.GetSeason();
     
+    Calendar.Reset(TotalMinutes);
+    RegisterCalendarBoundaries();
+    
     UE_LOG(LogTemp, Log, TEXT("Simple time system initialized - %s"), *GetFullTimeString());
 }
 
+void URadiantWorldManager::RegisterCalendarBoundaries()
+{
+    // Hours at which FSimpleWorldTime::GetTimeOfDay changes period
+    static const int32 TimeOfDayBoundaryHours[] = { 2, 6, 12, 17, 21 };
+    for (int32 BoundaryHour : TimeOfDayBoundaryHours)
+    {
+        Calendar.ScheduleRecurring(ECalendarRecurrence::Daily, BoundaryHour * FGameCalendar::MinutesPerHour,
+            FCalendarCallback::CreateUObject(this, &URadiantWorldManager::HandleTimeOfDayBoundary));
+    }
+    
+    Calendar.ScheduleRecurring(ECalendarRecurrence::Seasonal, 0,
+        FCalendarCallback::CreateUObject(this, &URadiantWorldManager::HandleSeasonBoundary));
+    
+    Calendar.ScheduleRecurring(ECalendarRecurrence::Daily, 0,
+        FCalendarCallback::CreateUObject(this, &URadiantWorldManager::HandleDayBoundary));
+}
+
 void URadiantWorldManager::InitializeWeatherSystem()
 {
     // Set default weather settings
@@ -837,45 +903,74 @@ void URadiantWorldManager::UpdateTimeProgression(float DeltaTime)
 
 void URadiantWorldManager::ProcessTimeChangeEvents(ETimeOfDay OldTimeOfDay, ESeason OldSeason)
 {
-    ETimeOfDay NewTimeOfDay = CurrentWorldTime.GetTimeOfDay();
-    ESeason NewSeason = CurrentWorldTime.GetSeason();
+    const int32 OldMinutes = Calendar.GetCurrentMinutes();
+    const int32 NowMinutes = CurrentWorldTime.GetTotalMinutes();
     
-    // Check for time of day changes
-    if (OldTimeOfDay != NewTimeOfDay)
+    if (NowMinutes >= OldMinutes)
+    {
+        // Boundaries are calendar events - only the ones actually crossed fire
+        Calendar.AdvanceTo(NowMinutes, CurrentWorldTime);
+    }
+    else
     {
-        PreviousTimeOfDay = NewTimeOfDay;
-        OnTimeOfDayChanged.Broadcast(NewTimeOfDay);
+        // Time was set backwards - no boundary was crossed, so compare the two times directly
+        Calendar.Rebase(NowMinutes);
         
-        UE_LOG(LogTemp, Log, TEXT("Time of day changed to: %s"), 
-               *UEnum::GetValueAsString(NewTimeOfDay));
+        if (OldTimeOfDay != CurrentWorldTime.GetTimeOfDay())
+        {
+            HandleTimeOfDayBoundary(CurrentWorldTime, 1);
+        }
+        if (OldSeason != CurrentWorldTime.GetSeason())
+        {
+            HandleSeasonBoundary(CurrentWorldTime, 1);
+        }
+        if (OldMinutes / FGameCalendar::MinutesPerDay != NowMinutes / FGameCalendar::MinutesPerDay)
+        {
+            HandleDayBoundary(CurrentWorldTime, 1);
+        }
     }
     
-    // Check for season changes
-    if (OldSeason != NewSeason)
+    // Broadcast general time change
+    OnTimeChanged.Broadcast(CurrentWorldTime);
+    OnGlobalTimeChanged(CurrentWorldTime);
+}
+
+void URadiantWorldManager::HandleTimeOfDayBoundary(const FSimpleWorldTime& Time, int32 Occurrences)
+{
+    const ETimeOfDay NewTimeOfDay = Time.GetTimeOfDay();
+    if (NewTimeOfDay == PreviousTimeOfDay)
     {
-        PreviousSeason = NewSeason;
-        OnSeasonChanged.Broadcast(NewSeason);
-        
-        UE_LOG(LogTemp, Log, TEXT("Season changed to: %s"), 
-               *UEnum::GetValueAsString(NewSeason));
+        return;
     }
     
-    // Check for new day
-    static int32 LastDay = CurrentWorldTime.Day;
-    static int32 LastSeason = CurrentWorldTime.Season;
-    if (LastDay != CurrentWorldTime.Day || LastSeason != CurrentWorldTime.Season)
+    PreviousTimeOfDay = NewTimeOfDay;
+    OnTimeOfDayChanged.Broadcast(NewTimeOfDay);
+    
+    UE_LOG(LogTemp, Log, TEXT("Time of day changed to: %s"), 
+           *UEnum::GetValueAsString(NewTimeOfDay));
+}
+
+void URadiantWorldManager::HandleSeasonBoundary(const FSimpleWorldTime& Time, int32 Occurrences)
+{
+    const ESeason NewSeason = Time.GetSeason();
+    if (NewSeason == PreviousSeason)
     {
-        LastDay = CurrentWorldTime.Day;
-        LastSeason = CurrentWorldTime.Season;
-        OnNewDay.Broadcast(CurrentWorldTime.Season, CurrentWorldTime.Day);
-        
-        UE_LOG(LogTemp, Log, TEXT("New day: Season %d, Day %d"), 
-               CurrentWorldTime.Season, CurrentWorldTime.Day);
+        return;
     }
     
-    // Broadcast general time change
-    OnTimeChanged.Broadcast(CurrentWorldTime);
-    OnGlobalTimeChanged(CurrentWorldTime);
+    PreviousSeason = NewSeason;
+    OnSeasonChanged.Broadcast(NewSeason);
+    
+    UE_LOG(LogTemp, Log, TEXT("Season changed to: %s"), 
+           *UEnum::GetValueAsString(NewSeason));
+}
+
+void URadiantWorldManager::HandleDayBoundary(const FSimpleWorldTime& Time, int32 Occurrences)
+{
+    OnNewDay.Broadcast(Time.Season, Time.Day);
+    
+    UE_LOG(LogTemp, Log, TEXT("New day: Season %d, Day %d"), 
+           Time.Season, Time.Day);
 }
 
 void URadiantWorldManager::CalculateWeatherTransition(float DeltaTime)
@@ -1,17 +1,28 @@
 #include "World/RadiantZoneManager.h"
 #include "World/WorldEventManager.h"
+#include "World/FactionControlManager.h"
+#include "World/WeatherScheduler.h"
+#include "World/ZoneTravelGraph.h"
+#include "Managers/EconomyManager.h"
+#include "AI/Core/ARPG_CrowdManager.h"
+#include "World/RadiantWorldManager.h"
 #include "Components/BoxComponent.h"
 #include "Components/SphereComponent.h"
 #include "Components/AudioComponent.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
+#include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
+#include "Net/UnrealNetwork.h"
 
 ARadiantZoneManager::ARadiantZoneManager()
 {
-    PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.TickInterval = 1.0f;
+    // Territory control is simulated centrally by UFactionControlManager - no per-zone tick
+    PrimaryActorTick.bCanEverTick = false;
+
+    // Weather and control replicate only to players inside the zone - see URadiantReplicationGraph
+    bReplicates = true;
+    SetNetUpdateFrequency(1.0f);
 
     // Create root component
     RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
@@ -51,6 +62,9 @@ void ARadiantZoneManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Index map is rebuilt from whatever Resources holds at this point, e.g. restored state
+    RebuildResourceIndices();
+
     // Bind overlap events
     if (ZoneBounds)
     {
@@ -67,33 +81,67 @@ void ARadiantZoneManager::BeginPlay()
             EventManager->RegisterZone(this);
         }
 
-        // Setup timers
-        if (WeatherUpdateInterval > 0.0f)
+        FactionControlManager = World->GetSubsystem<UFactionControlManager>();
+        if (FactionControlManager)
+        {
+            FactionControlManager->RegisterZone(this, ControllingFaction, FactionControlStrength, FactionControlDecayRate);
+        }
+
+        WeatherScheduler = World->GetSubsystem<UWeatherScheduler>();
+        if (WeatherScheduler)
+        {
+            WeatherScheduler->RegisterZone(this, ZoneType, CurrentWeather, PossibleWeatherTypes);
+            WeatherScheduler->SetZoneCycleRunning(this, bWeatherCycleRunning);
+        }
+
+        // Keeps this zone's data for saves and travel routes once it unloads
+        WorldManager = World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<URadiantWorldManager>() : nullptr;
+        if (WorldManager)
+        {
+            WorldManager->RegisterZone(this);
+        }
+
+        TravelGraph = World->GetSubsystem<UZoneTravelGraph>();
+        if (TravelGraph)
+        {
+            TravelGraph->RegisterZone(this, GetZoneData(), ZoneTransitions);
+        }
+
+        // Pushes the zone's proxy count through SetCrowdResidents
+        CrowdManager = World->GetSubsystem<UARPG_CrowdManager>();
+        if (CrowdManager)
         {
-            World->GetTimerManager().SetTimer(
-                WeatherUpdateTimer,
-                this,
-                &ARadiantZoneManager::UpdateWeather,
-                WeatherUpdateInterval,
-                true
-            );
+            CrowdManager->RegisterZone(this);
         }
 
-        World->GetTimerManager().SetTimer(
-            ResourceUpdateTimer,
-            this,
-            &ARadiantZoneManager::UpdateResources,
-            10.0f,
-            true
-        );
+        EconomyManager = World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<UEconomyManager>() : nullptr;
+        if (EconomyManager)
+        {
+            // Residents placed inside the bounds before the overlap handlers were bound
+            TArray<AActor*> Overlapping;
+            ZoneBounds->GetOverlappingActors(Overlapping, ACharacter::StaticClass());
+            for (AActor* Actor : Overlapping)
+            {
+                if (IsResident(Actor) && !ActorsInZone.Contains(Actor))
+                {
+                    ActorsInZone.Add(Actor);
+                    CountedResidents.Add(Actor);
+                }
+            }
+
+            NumResidents = CountedResidents.Num();
+            PushPopulationToEconomy();
+            for (const FZoneResourceState& Resource : Resources)
+            {
+                PushResourceToEconomy(Resource);
+            }
+        }
 
-        World->GetTimerManager().SetTimer(
-            EventProcessTimer,
-            this,
-            &ARadiantZoneManager::ProcessZoneEvents,
-            5.0f,
-            true
-        );
+        // Setup timers
+        if (URadiantTimerManager* RadiantTimers = World->GetSubsystem<URadiantTimerManager>())
+        {
+            EventProcessTimer = RadiantTimers->SetTimer(this, &ARadiantZoneManager::ProcessZoneEvents, 5.0f, true);
+        }
     }
 
     // Auto-activate if configured
@@ -114,25 +162,43 @@ void ARadiantZoneManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
         EventManager->UnregisterZone(this);
     }
 
-    // Clear timers
-    if (UWorld* World = GetWorld())
+    if (FactionControlManager)
     {
-        World->GetTimerManager().ClearTimer(WeatherUpdateTimer);
-        World->GetTimerManager().ClearTimer(ResourceUpdateTimer);
-        World->GetTimerManager().ClearTimer(EventProcessTimer);
+        FactionControlManager->UnregisterZone(this);
     }
 
-    Super::EndPlay(EndPlayReason);
-}
+    if (WeatherScheduler)
+    {
+        WeatherScheduler->UnregisterZone(this);
+    }
 
-void ARadiantZoneManager::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
+    if (TravelGraph)
+    {
+        TravelGraph->UnregisterZone(this);
+    }
 
-    if (bIsActive)
+    if (CrowdManager)
+    {
+        CrowdManager->UnregisterZone(this);
+    }
+
+    if (WorldManager)
+    {
+        WorldManager->UnregisterZone(this);
+    }
+
+    if (EconomyManager)
+    {
+        EconomyManager->ClearZoneInputs(ZoneTag);
+    }
+
+    // Clear timers
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
     {
-        CheckFactionStatus();
+        RadiantTimers->ClearTimer(EventProcessTimer);
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 // Zone Management
@@ -145,6 +211,21 @@ void ARadiantZoneManager::ActivateZone()
 
     bIsActive = true;
 
+    if (FactionControlManager)
+    {
+        FactionControlManager->SetZoneActive(this, true);
+    }
+
+    if (WeatherScheduler)
+    {
+        WeatherScheduler->SetZoneActive(this, true);
+    }
+
+    if (TravelGraph)
+    {
+        TravelGraph->SetZoneActive(this, true);
+    }
+
     // Start ambient sound if available
     PlayAmbientSound();
 
@@ -179,6 +260,21 @@ void ARadiantZoneManager::DeactivateZone()
 
     bIsActive = false;
 
+    if (FactionControlManager)
+    {
+        FactionControlManager->SetZoneActive(this, false);
+    }
+
+    if (WeatherScheduler)
+    {
+        WeatherScheduler->SetZoneActive(this, false);
+    }
+
+    if (TravelGraph)
+    {
+        TravelGraph->SetZoneActive(this, false);
+    }
+
     // Stop sounds
     StopAmbientSound();
     if (WeatherAudioComponent && WeatherAudioComponent->IsPlaying())
@@ -256,8 +352,16 @@ void ARadiantZoneManager::OnZoneBeginOverlap(UPrimitiveComponent* OverlappedComp
     }
 
     // Add to actors in zone
+    const bool bNewInZone = !ActorsInZone.Contains(OtherActor);
     ActorsInZone.AddUnique(OtherActor);
 
+    if (bNewInZone && IsResident(OtherActor))
+    {
+        CountedResidents.Add(OtherActor);
+        NumResidents = CountedResidents.Num();
+        PushPopulationToEconomy();
+    }
+
     // Check if it's a player
     if (ACharacter* Character = Cast<ACharacter>(OtherActor))
     {
@@ -300,6 +404,13 @@ void ARadiantZoneManager::OnZoneEndOverlap(UPrimitiveComponent* OverlappedCompon
     ActorsInZone.Remove(OtherActor);
     PlayersInZone.Remove(OtherActor);
 
+    // Possession may have changed since entry - trust what was counted, not IsResident
+    if (CountedResidents.Remove(OtherActor) > 0)
+    {
+        NumResidents = CountedResidents.Num();
+        PushPopulationToEconomy();
+    }
+
     // Notify Blueprint
     OnZoneExited(OtherActor);
 
@@ -342,6 +453,38 @@ void ARadiantZoneManager::HandlePlayerEntry(AActor* Player)
 }
 
 // Zone Information
+FZoneData ARadiantZoneManager::GetZoneData() const
+{
+    FZoneData ZoneData;
+    ZoneData.ZoneID = ZoneTag.GetTagName();
+    ZoneData.DisplayName = FText::FromString(ZoneName);
+    ZoneData.ZoneType = ZoneType;
+    ZoneData.DangerLevel = DangerLevel;
+    ZoneData.ControllingFaction = ControllingFaction.GetTagName();
+
+    if (ZoneBounds)
+    {
+        ZoneData.Boundary.Center = ZoneBounds->Bounds.Origin;
+        ZoneData.Boundary.Extents = ZoneBounds->Bounds.BoxExtent;
+    }
+
+    for (const FGameplayTag& Connected : ConnectedZones)
+    {
+        ZoneData.ConnectedZones.AddUnique(Connected.GetTagName());
+    }
+
+    // A crossing point implies the connection
+    for (const FZoneTransition& Transition : ZoneTransitions)
+    {
+        if (!Transition.ToZone.IsNone())
+        {
+            ZoneData.ConnectedZones.AddUnique(Transition.ToZone);
+        }
+    }
+
+    return ZoneData;
+}
+
 float ARadiantZoneManager::GetZoneRadius() const
 {
     if (ZoneBounds)
@@ -352,6 +495,15 @@ float ARadiantZoneManager::GetZoneRadius() const
     return 5000.0f;
 }
 
+void ARadiantZoneManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ARadiantZoneManager, CurrentWeather);
+    DOREPLIFETIME(ARadiantZoneManager, ControllingFaction);
+    DOREPLIFETIME(ARadiantZoneManager, ContestedByFaction);
+}
+
 bool ARadiantZoneManager::IsLocationInZone(FVector Location) const
 {
     if (!ZoneBounds)
@@ -451,6 +603,11 @@ void ARadiantZoneManager::SetWeather(EZoneWeather NewWeather)
         EZoneWeather OldWeather = CurrentWeather;
         CurrentWeather = NewWeather;
 
+        if (WeatherScheduler)
+        {
+            WeatherScheduler->SetZoneWeather(this, NewWeather);
+        }
+
         // Update weather sound
         if (WeatherAudioComponent)
         {
@@ -496,23 +653,21 @@ void ARadiantZoneManager::SetWeather(EZoneWeather NewWeather)
 
 void ARadiantZoneManager::StartWeatherCycle()
 {
-    if (GetWorld() && !WeatherUpdateTimer.IsValid())
+    bWeatherCycleRunning = true;
+
+    if (WeatherScheduler)
     {
-        GetWorld()->GetTimerManager().SetTimer(
-            WeatherUpdateTimer,
-            this,
-            &ARadiantZoneManager::UpdateWeather,
-            WeatherUpdateInterval,
-            true
-        );
+        WeatherScheduler->SetZoneCycleRunning(this, true);
     }
 }
 
 void ARadiantZoneManager::StopWeatherCycle()
 {
-    if (GetWorld() && WeatherUpdateTimer.IsValid())
+    bWeatherCycleRunning = false;
+
+    if (WeatherScheduler)
     {
-        GetWorld()->GetTimerManager().ClearTimer(WeatherUpdateTimer);
+        WeatherScheduler->SetZoneCycleRunning(this, false);
     }
 }
 
@@ -523,9 +678,13 @@ void ARadiantZoneManager::SetControllingFaction(FGameplayTag FactionTag)
     {
         FGameplayTag OldFaction = ControllingFaction;
         ControllingFaction = FactionTag;
-        FactionControlStrength = 1.0f;
         ContestedByFaction = FGameplayTag();
 
+        if (FactionControlManager)
+        {
+            FactionControlManager->SetZoneController(this, FactionTag);
+        }
+
         // Notify Blueprint
         OnFactionControlChanged(FactionTag);
 
@@ -555,6 +714,11 @@ void ARadiantZoneManager::StartFactionConflict(FGameplayTag AttackingFaction)
     if (AttackingFaction != ControllingFaction && AttackingFaction.IsValid())
     {
         ContestedByFaction = AttackingFaction;
+
+        if (FactionControlManager)
+        {
+            FactionControlManager->StartConflict(this, AttackingFaction);
+        }
         
         if (EventManager)
         {
@@ -576,27 +740,42 @@ void ARadiantZoneManager::StartFactionConflict(FGameplayTag AttackingFaction)
 // Resource Management
 void ARadiantZoneManager::SetResourceAvailability(FGameplayTag ResourceType, float Availability)
 {
-    ResourceAvailability.Add(ResourceType, FMath::Clamp(Availability, 0.0f, MaxResourceCapacity));
+    int32 Index = FindResourceIndex(ResourceType);
+    if (Index == INDEX_NONE)
+    {
+        Index = Resources.AddDefaulted();
+        Resources[Index].ResourceType = ResourceType;
+        ResourceIndices.Add(ResourceType, Index);
+    }
+
+    Resources[Index].Amount = FMath::Clamp(Availability, 0.0f, MaxResourceCapacity);
+    Resources[Index].LastUpdateTime = GetResourceTime();
+
+    PushResourceToEconomy(Resources[Index]);
 }
 
 float ARadiantZoneManager::GetResourceAvailability(FGameplayTag ResourceType) const
 {
-    if (const float* Availability = ResourceAvailability.Find(ResourceType))
-    {
-        return *Availability;
-    }
-    return 0.0f;
+    const int32 Index = FindResourceIndex(ResourceType);
+    return Index != INDEX_NONE ? EvaluateResource(Resources[Index], GetResourceTime()) : 0.0f;
 }
 
 void ARadiantZoneManager::ConsumeResource(FGameplayTag ResourceType, float Amount)
 {
-    if (float* Availability = ResourceAvailability.Find(ResourceType))
+    const int32 Index = FindResourceIndex(ResourceType);
+    if (Index != INDEX_NONE)
     {
-        float OldAmount = *Availability;
-        *Availability = FMath::Max(0.0f, *Availability - Amount);
+        FZoneResourceState& Resource = Resources[Index];
+        const float Now = GetResourceTime();
+
+        const float OldAmount = EvaluateResource(Resource, Now);
+        Resource.Amount = FMath::Max(0.0f, OldAmount - Amount);
+        Resource.LastUpdateTime = Now;
+
+        PushResourceToEconomy(Resource);
 
         // Broadcast resource depletion if significant
-        if (OldAmount > 0.0f && *Availability == 0.0f && EventManager)
+        if (OldAmount > 0.0f && Resource.Amount == 0.0f && EventManager)
         {
             FWorldEvent Event;
             Event.EventTag = FGameplayTag::RequestGameplayTag("Zone.Resource.Depleted");
@@ -612,13 +791,85 @@ void ARadiantZoneManager::ConsumeResource(FGameplayTag ResourceType, float Amoun
 
 void ARadiantZoneManager::RegenerateResources()
 {
-    for (auto& Pair : ResourceAvailability)
+    // Immediate regrowth pulse on top of the continuous regeneration
+    const float Now = GetResourceTime();
+    for (FZoneResourceState& Resource : Resources)
+    {
+        Resource.Amount = FMath::Min(MaxResourceCapacity, 
+            EvaluateResource(Resource, Now) + (ResourceRegenerationRate * MaxResourceCapacity));
+        Resource.LastUpdateTime = Now;
+
+        PushResourceToEconomy(Resource);
+    }
+}
+
+int32 ARadiantZoneManager::FindResourceIndex(const FGameplayTag& ResourceType) const
+{
+    const int32* Index = ResourceIndices.Find(ResourceType);
+    return Index ? *Index : INDEX_NONE;
+}
+
+void ARadiantZoneManager::RebuildResourceIndices()
+{
+    ResourceIndices.Reset();
+    ResourceIndices.Reserve(Resources.Num());
+
+    for (int32 Index = 0; Index < Resources.Num(); ++Index)
     {
-        Pair.Value = FMath::Min(MaxResourceCapacity, 
-            Pair.Value + (ResourceRegenerationRate * MaxResourceCapacity));
+        // First entry wins, matching the old linear search
+        if (!ResourceIndices.Contains(Resources[Index].ResourceType))
+        {
+            ResourceIndices.Add(Resources[Index].ResourceType, Index);
+        }
     }
 }
 
+float ARadiantZoneManager::EvaluateResource(const FZoneResourceState& Resource, float Now) const
+{
+    const float RegenPerSecond = ResourceRegenerationRate * MaxResourceCapacity / ResourceRegenerationInterval;
+    const float Elapsed = FMath::Max(Now - Resource.LastUpdateTime, 0.0f);
+    return FMath::Min(MaxResourceCapacity, Resource.Amount + RegenPerSecond * Elapsed);
+}
+
+float ARadiantZoneManager::GetResourceTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void ARadiantZoneManager::PushResourceToEconomy(const FZoneResourceState& Resource) const
+{
+    if (EconomyManager)
+    {
+        // Same regrowth rule as EvaluateResource, so the economy never has to read the zone back
+        const float RegenPerSecond = ResourceRegenerationRate * MaxResourceCapacity / ResourceRegenerationInterval;
+        EconomyManager->SetZoneResource(ZoneTag, Resource, RegenPerSecond, MaxResourceCapacity);
+    }
+}
+
+void ARadiantZoneManager::PushPopulationToEconomy() const
+{
+    if (EconomyManager)
+    {
+        EconomyManager->SetZonePopulation(ZoneTag, NumResidents + NumCrowdResidents);
+    }
+}
+
+void ARadiantZoneManager::SetCrowdResidents(int32 NumProxies)
+{
+    if (NumCrowdResidents != NumProxies)
+    {
+        NumCrowdResidents = NumProxies;
+        PushPopulationToEconomy();
+    }
+}
+
+bool ARadiantZoneManager::IsResident(const AActor* Actor)
+{
+    const ACharacter* Character = Cast<ACharacter>(Actor);
+    return Character && !Character->IsPlayerControlled();
+}
+
 // Discovery System
 void ARadiantZoneManager::OnPlayerDiscovered(AActor* Player)
 {
@@ -690,31 +941,6 @@ void ARadiantZoneManager::DespawnAllNPCs()
 }
 
 // Internal Update Functions
-void ARadiantZoneManager::UpdateWeather()
-{
-    if (!bIsActive || PossibleWeatherTypes.Num() == 0)
-    {
-        return;
-    }
-
-    // Random chance to change weather
-    if (FMath::FRand() < WeatherChangeProbability)
-    {
-        int32 RandomIndex = FMath::RandRange(0, PossibleWeatherTypes.Num() - 1);
-        SetWeather(PossibleWeatherTypes[RandomIndex]);
-    }
-}
-
-void ARadiantZoneManager::UpdateResources()
-{
-    if (!bIsActive)
-    {
-        return;
-    }
-
-    RegenerateResources();
-}
-
 void ARadiantZoneManager::ProcessZoneEvents()
 {
     if (!bIsActive)
@@ -736,21 +962,3 @@ void ARadiantZoneManager::ProcessZoneEvents()
         UpdateAmbientSound();
     }
 }
-
-void ARadiantZoneManager::CheckFactionStatus()
-{
-    if (!ContestedByFaction.IsValid())
-    {
-        return;
-    }
-
-    // Simple faction control decay
-    FactionControlStrength -= 0.001f;
-
-    if (FactionControlStrength <= 0.0f)
-    {
-        // Zone captured
-        SetControllingFaction(ContestedByFaction);
-        ContestedByFaction = FGameplayTag();
-    }
-}
\ No newline at end of file
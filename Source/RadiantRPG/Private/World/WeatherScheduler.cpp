@@ -0,0 +1,510 @@
+// Source/RadiantRPG/Private/World/WeatherScheduler.cpp
+
+#include "World/WeatherScheduler.h"
+#include "World/RadiantZoneManager.h"
+#include "World/RadiantWorldManager.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+namespace WeatherClimateData
+{
+    constexpr int32 NumStates = FWeatherTransitionMatrix::NumStates;
+    constexpr uint8 AllStatesMask = (1 << NumStates) - 1;
+
+    // Relative weight of each weather state (Clear, Cloudy, Rain, Storm, Snow, Fog) per EZoneType
+    const float ZoneTypeWeights[(int32)EZoneType::MAX][NumStates] =
+    {
+        { 1.0f, 0.8f, 0.6f, 0.2f, 0.3f, 0.3f },     // Wilderness
+        { 1.2f, 0.8f, 0.5f, 0.1f, 0.3f, 0.2f },     // Settlement
+        { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.15f },    // Dungeon
+        { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f },    // Cave
+        { 0.8f, 0.8f, 0.8f, 0.2f, 0.3f, 0.6f },     // Forest
+        { 2.0f, 0.3f, 0.05f, 0.3f, 0.0f, 0.0f },    // Desert
+        { 0.7f, 0.9f, 0.4f, 0.5f, 1.0f, 0.5f },     // Mountain
+        { 0.4f, 0.8f, 0.9f, 0.2f, 0.1f, 1.2f },     // Swamp
+        { 1.0f, 0.8f, 0.5f, 0.2f, 0.3f, 0.5f },     // Ruins
+        { 0.8f, 1.0f, 0.6f, 0.4f, 0.2f, 0.5f },     // Battlefield
+        { 1.5f, 0.6f, 0.4f, 0.1f, 0.2f, 0.3f },     // Sacred
+        { 0.3f, 1.0f, 0.6f, 0.9f, 0.1f, 1.0f },     // Corrupted
+    };
+
+    // Seasonal multiplier per weather state
+    const float SeasonMultipliers[(int32)ESeason::MAX][NumStates] =
+    {
+        { 1.0f, 1.1f, 1.4f, 1.0f, 0.2f, 1.2f },     // Spring
+        { 1.4f, 0.9f, 0.8f, 1.3f, 0.0f, 0.6f },     // Summer
+        { 0.9f, 1.3f, 1.3f, 1.1f, 0.4f, 1.4f },     // Autumn
+        { 0.7f, 1.2f, 0.5f, 0.6f, 2.5f, 1.1f },     // Winter
+    };
+
+    // Chance a state holds for another step before redrawing
+    const float Persistence[NumStates] = { 0.7f, 0.5f, 0.5f, 0.3f, 0.6f, 0.4f };
+}
+
+// Transition Matrix
+FWeatherTransitionMatrix FWeatherTransitionMatrix::Identity()
+{
+    FWeatherTransitionMatrix Result;
+    for (int32 State = 0; State < NumStates; ++State)
+    {
+        Result.P[State][State] = 1.0f;
+    }
+    return Result;
+}
+
+FWeatherTransitionMatrix FWeatherTransitionMatrix::operator*(const FWeatherTransitionMatrix& Other) const
+{
+    FWeatherTransitionMatrix Result;
+    for (int32 Row = 0; Row < NumStates; ++Row)
+    {
+        for (int32 Mid = 0; Mid < NumStates; ++Mid)
+        {
+            const float Weight = P[Row][Mid];
+            if (Weight == 0.0f)
+            {
+                continue;
+            }
+
+            for (int32 Col = 0; Col < NumStates; ++Col)
+            {
+                Result.P[Row][Col] += Weight * Other.P[Mid][Col];
+            }
+        }
+    }
+    return Result;
+}
+
+FWeatherTransitionMatrix FWeatherTransitionMatrix::Power(int64 Steps) const
+{
+    FWeatherTransitionMatrix Result = Identity();
+    FWeatherTransitionMatrix Base = *this;
+
+    while (Steps > 0)
+    {
+        if (Steps & 1)
+        {
+            Result = Result * Base;
+        }
+
+        Steps >>= 1;
+        if (Steps > 0)
+        {
+            Base = Base * Base;
+        }
+    }
+
+    return Result;
+}
+
+EZoneWeather FWeatherTransitionMatrix::Sample(EZoneWeather From, FRandomStream& Stream) const
+{
+    const float* Row = P[(int32)From];
+
+    float Total = 0.0f;
+    for (int32 State = 0; State < NumStates; ++State)
+    {
+        Total += Row[State];
+    }
+
+    // Rows sum to one up to rounding - scale the draw rather than trusting it
+    float Draw = Stream.GetFraction() * Total;
+    int32 LastReachable = (int32)From;
+
+    for (int32 State = 0; State < NumStates; ++State)
+    {
+        if (Row[State] <= 0.0f)
+        {
+            continue;
+        }
+
+        LastReachable = State;
+        Draw -= Row[State];
+        if (Draw < 0.0f)
+        {
+            return (EZoneWeather)State;
+        }
+    }
+
+    return (EZoneWeather)LastReachable;
+}
+
+// Subsystem interface
+void UWeatherScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Precompute the unrestricted climate of every zone type up front
+    for (int32 ZoneType = 0; ZoneType < (int32)EZoneType::MAX; ++ZoneType)
+    {
+        FindOrAddClimate((EZoneType)ZoneType, WeatherClimateData::AllStatesMask);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("WeatherScheduler initialized with %d climates"), Climates.Num());
+}
+
+void UWeatherScheduler::Deinitialize()
+{
+    if (URadiantWorldManager* WorldManager = GetWorldManager())
+    {
+        WorldManager->GetCalendar().Cancel(StepEventHandle);
+    }
+
+    Zones.Empty();
+    ClimateIndices.Empty();
+    States.Empty();
+    ActiveFlags.Empty();
+    RunningFlags.Empty();
+    PendingSteps.Empty();
+    ZoneIndices.Empty();
+    ZoneKeys.Empty();
+    Climates.Empty();
+    ClimateLookup.Empty();
+
+    Super::Deinitialize();
+}
+
+void UWeatherScheduler::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (SimulationConfig.Seed != 0)
+    {
+        WeatherStream.Initialize(SimulationConfig.Seed);
+    }
+    else
+    {
+        WeatherStream.GenerateNewSeed();
+    }
+
+    RestartStepSchedule();
+}
+
+bool UWeatherScheduler::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UWeatherScheduler::ConfigureSimulation(const FWeatherSchedulerConfig& Config)
+{
+    const bool bSeedChanged = Config.Seed != SimulationConfig.Seed;
+    SimulationConfig = Config;
+
+    if (bSeedChanged && Config.Seed != 0)
+    {
+        WeatherStream.Initialize(Config.Seed);
+    }
+
+    RestartStepSchedule();
+}
+
+void UWeatherScheduler::RestartStepSchedule()
+{
+    UWorld* World = GetWorld();
+    URadiantWorldManager* WorldManager = GetWorldManager();
+    if (!World || !WorldManager)
+    {
+        return;
+    }
+
+    FGameCalendar& Calendar = WorldManager->GetCalendar();
+    Calendar.Cancel(StepEventHandle);
+
+    if (SimulationConfig.bEnableSimulation && World->HasBegunPlay())
+    {
+        StepEventHandle = Calendar.ScheduleEvery(SimulationConfig.StepGameMinutes, 0,
+            FCalendarCallback::CreateUObject(this, &UWeatherScheduler::HandleWeatherStep));
+    }
+}
+
+// Zone Registration
+void UWeatherScheduler::RegisterZone(ARadiantZoneManager* Zone, EZoneType ZoneType, EZoneWeather InitialWeather, const TArray<EZoneWeather>& AllowedWeather)
+{
+    if (!Zone || ZoneIndices.Contains(Zone))
+    {
+        return;
+    }
+
+    uint8 AllowedMask = 0;
+    for (EZoneWeather Weather : AllowedWeather)
+    {
+        if (Weather < EZoneWeather::MAX)
+        {
+            AllowedMask |= 1 << (int32)Weather;
+        }
+    }
+
+    if (AllowedMask == 0)
+    {
+        AllowedMask = WeatherClimateData::AllStatesMask;
+    }
+
+    const int32 Index = Zones.Add(Zone);
+    ZoneKeys.Add(Zone);
+    ClimateIndices.Add(FindOrAddClimate(ZoneType, AllowedMask));
+    States.Add(InitialWeather);
+    ActiveFlags.Add(Zone->IsZoneActive());
+    RunningFlags.Add(true);
+    PendingSteps.Add(0);
+    ZoneIndices.Add(Zone, Index);
+}
+
+void UWeatherScheduler::UnregisterZone(ARadiantZoneManager* Zone)
+{
+    int32 Index = INDEX_NONE;
+    if (!ZoneIndices.RemoveAndCopyValue(Zone, Index))
+    {
+        return;
+    }
+
+    Zones.RemoveAtSwap(Index);
+    ZoneKeys.RemoveAtSwap(Index);
+    ClimateIndices.RemoveAtSwap(Index);
+    States.RemoveAtSwap(Index);
+    ActiveFlags.RemoveAtSwap(Index);
+    RunningFlags.RemoveAtSwap(Index);
+    PendingSteps.RemoveAtSwap(Index);
+
+    // Fix up the zone that was swapped into the freed slot
+    if (Zones.IsValidIndex(Index))
+    {
+        ZoneIndices.Add(ZoneKeys[Index], Index);
+    }
+}
+
+void UWeatherScheduler::SetZoneActive(ARadiantZoneManager* Zone, bool bActive)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index == INDEX_NONE || ActiveFlags[Index] == bActive)
+    {
+        return;
+    }
+
+    ActiveFlags[Index] = bActive;
+    CatchUpZone(Index);
+}
+
+void UWeatherScheduler::SetZoneCycleRunning(ARadiantZoneManager* Zone, bool bRunning)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index == INDEX_NONE || RunningFlags[Index] == bRunning)
+    {
+        return;
+    }
+
+    RunningFlags[Index] = bRunning;
+    CatchUpZone(Index);
+}
+
+void UWeatherScheduler::SetZoneWeather(ARadiantZoneManager* Zone, EZoneWeather NewWeather)
+{
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index != INDEX_NONE && NewWeather < EZoneWeather::MAX)
+    {
+        States[Index] = NewWeather;
+
+        // Forced weather replaces whatever the missed steps would have drawn
+        PendingSteps[Index] = 0;
+    }
+}
+
+// Simulation
+void UWeatherScheduler::FastForward(int32 Steps)
+{
+    if (Steps > 0)
+    {
+        AdvanceAllZones(Steps);
+    }
+}
+
+TArray<float> UWeatherScheduler::GetForecast(const ARadiantZoneManager* Zone, int32 Steps) const
+{
+    TArray<float> Result;
+
+    const int32 Index = FindZoneIndex(Zone);
+    if (Index == INDEX_NONE)
+    {
+        return Result;
+    }
+
+    const FWeatherTransitionMatrix Forecast = Climates[ClimateIndices[Index]].Seasons[(int32)GetSeason()].Power(FMath::Max(Steps, 0));
+    Result.Append(Forecast.P[(int32)States[Index]], FWeatherTransitionMatrix::NumStates);
+    return Result;
+}
+
+void UWeatherScheduler::HandleWeatherStep(const FSimpleWorldTime& Time, int32 Occurrences)
+{
+    AdvanceAllZones(Occurrences);
+}
+
+void UWeatherScheduler::AdvanceAllZones(int64 Steps)
+{
+    const ESeason Season = GetSeason();
+    TMap<int32, FWeatherTransitionMatrix> PowerCache;
+    TArray<int32, TInlineAllocator<8>> Changed;
+
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        if (!RunningFlags[Index])
+        {
+            continue;
+        }
+
+        if (!ActiveFlags[Index])
+        {
+            PendingSteps[Index] += Steps;
+            continue;
+        }
+
+        const EZoneWeather NewState = DrawState(ClimateIndices[Index], Season, States[Index], Steps, PowerCache);
+        if (NewState != States[Index])
+        {
+            States[Index] = NewState;
+            Changed.Add(Index);
+        }
+    }
+
+    // Notify after the pass - zone callbacks may re-enter the scheduler
+    for (int32 Index : Changed)
+    {
+        NotifyWeatherChanged(Index);
+    }
+}
+
+EZoneWeather UWeatherScheduler::DrawState(int32 ClimateIndex, ESeason Season, EZoneWeather From, int64 Steps, TMap<int32, FWeatherTransitionMatrix>& PowerCache)
+{
+    // Long skips use the current season's table throughout
+    const FWeatherTransitionMatrix& StepMatrix = Climates[ClimateIndex].Seasons[(int32)Season];
+
+    if (Steps <= SimulationConfig.FastForwardThreshold)
+    {
+        EZoneWeather State = From;
+        for (int64 Step = 0; Step < Steps; ++Step)
+        {
+            State = StepMatrix.Sample(State, WeatherStream);
+        }
+        return State;
+    }
+
+    const FWeatherTransitionMatrix* PowerMatrix = PowerCache.Find(ClimateIndex);
+    if (!PowerMatrix)
+    {
+        PowerMatrix = &PowerCache.Add(ClimateIndex, StepMatrix.Power(Steps));
+    }
+
+    return PowerMatrix->Sample(From, WeatherStream);
+}
+
+void UWeatherScheduler::NotifyWeatherChanged(int32 ZoneIndex)
+{
+    if (ARadiantZoneManager* Zone = Zones[ZoneIndex].Get())
+    {
+        // The zone routes back through SetZoneWeather, which only records the state
+        Zone->SetWeather(States[ZoneIndex]);
+    }
+}
+
+void UWeatherScheduler::CatchUpZone(int32 ZoneIndex)
+{
+    if (!ActiveFlags[ZoneIndex] || !RunningFlags[ZoneIndex] || PendingSteps[ZoneIndex] == 0)
+    {
+        return;
+    }
+
+    // Catch up on everything missed while inactive in a single draw
+    TMap<int32, FWeatherTransitionMatrix> PowerCache;
+    const EZoneWeather NewState = DrawState(ClimateIndices[ZoneIndex], GetSeason(), States[ZoneIndex], PendingSteps[ZoneIndex], PowerCache);
+    PendingSteps[ZoneIndex] = 0;
+
+    if (NewState != States[ZoneIndex])
+    {
+        States[ZoneIndex] = NewState;
+        NotifyWeatherChanged(ZoneIndex);
+    }
+}
+
+// Climate compilation
+int32 UWeatherScheduler::FindOrAddClimate(EZoneType ZoneType, uint8 AllowedMask)
+{
+    const uint32 Key = ((uint32)ZoneType << 8) | AllowedMask;
+    if (const int32* Existing = ClimateLookup.Find(Key))
+    {
+        return *Existing;
+    }
+
+    FWeatherClimate& Climate = Climates.AddDefaulted_GetRef();
+    Climate.ZoneType = ZoneType;
+    Climate.AllowedMask = AllowedMask;
+
+    for (int32 Season = 0; Season < (int32)ESeason::MAX; ++Season)
+    {
+        BuildSeasonMatrix(ZoneType, (ESeason)Season, AllowedMask, Climate.Seasons[Season]);
+    }
+
+    const int32 ClimateIndex = Climates.Num() - 1;
+    ClimateLookup.Add(Key, ClimateIndex);
+    return ClimateIndex;
+}
+
+void UWeatherScheduler::BuildSeasonMatrix(EZoneType ZoneType, ESeason Season, uint8 AllowedMask, FWeatherTransitionMatrix& OutMatrix)
+{
+    using namespace WeatherClimateData;
+
+    const int32 TypeIndex = FMath::Clamp((int32)ZoneType, 0, (int32)EZoneType::MAX - 1);
+    const int32 SeasonIndex = FMath::Clamp((int32)Season, 0, (int32)ESeason::MAX - 1);
+
+    // Target distribution a redraw picks from
+    float Weights[NumStates];
+    float TotalWeight = 0.0f;
+    for (int32 State = 0; State < NumStates; ++State)
+    {
+        const bool bAllowed = (AllowedMask & (1 << State)) != 0;
+        Weights[State] = bAllowed ? ZoneTypeWeights[TypeIndex][State] * SeasonMultipliers[SeasonIndex][State] : 0.0f;
+        TotalWeight += Weights[State];
+    }
+
+    // Climate rules out every allowed state this season - fall back to an even split
+    if (TotalWeight <= 0.0f)
+    {
+        for (int32 State = 0; State < NumStates; ++State)
+        {
+            Weights[State] = (AllowedMask & (1 << State)) != 0 ? 1.0f : 0.0f;
+            TotalWeight += Weights[State];
+        }
+    }
+
+    for (int32 From = 0; From < NumStates; ++From)
+    {
+        // A state that is no longer allowed or likely this season always redraws
+        const bool bCanHold = Weights[From] > 0.0f;
+        const float Hold = bCanHold ? Persistence[From] : 0.0f;
+
+        for (int32 To = 0; To < NumStates; ++To)
+        {
+            OutMatrix.P[From][To] = (1.0f - Hold) * Weights[To] / TotalWeight;
+        }
+        OutMatrix.P[From][From] += Hold;
+    }
+}
+
+URadiantWorldManager* UWeatherScheduler::GetWorldManager() const
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<URadiantWorldManager>() : nullptr;
+}
+
+ESeason UWeatherScheduler::GetSeason() const
+{
+    const URadiantWorldManager* WorldManager = GetWorldManager();
+
+    const ESeason Season = WorldManager ? WorldManager->GetSeasonType() : ESeason::Spring;
+    return Season < ESeason::MAX ? Season : ESeason::Spring;
+}
+
+int32 UWeatherScheduler::FindZoneIndex(const ARadiantZoneManager* Zone) const
+{
+    const int32* Index = ZoneIndices.Find(Zone);
+    return Index ? *Index : INDEX_NONE;
+}
@@ -0,0 +1,240 @@
+// Private/World/WorldEventFeedComponent.cpp
+
+#include "World/WorldEventFeedComponent.h"
+#include "World/WorldEventRelevancyManager.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Engine/NetConnection.h"
+#include "Net/RepLayout.h"
+#include "UObject/CoreNet.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+// Console variable for feed bandwidth stats
+static TAutoConsoleVariable<int32> CVarMeasureFeedBits(
+    TEXT("radiant.net.measurefeedbits"),
+    0,
+    TEXT("Serialize every world event batch once more to measure its bits in the feed stats (0=off, 1=on)"),
+    ECVF_Default);
+#endif
+
+UWorldEventFeedComponent::UWorldEventFeedComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UWorldEventFeedComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (GetOwner() && GetOwner()->HasAuthority())
+    {
+        if (UWorldEventRelevancyManager* RelevancyManager = GetRelevancyManager())
+        {
+            RelevancyManager->RegisterFeed(this);
+        }
+    }
+}
+
+void UWorldEventFeedComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorldEventRelevancyManager* RelevancyManager = GetRelevancyManager())
+    {
+        RelevancyManager->UnregisterFeed(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// Subscriptions
+void UWorldEventFeedComponent::SetSubscribedCategories(const TArray<EEventCategory>& Categories)
+{
+    uint32 Mask = Categories.Num() > 0 ? 0 : MAX_uint32;
+    for (EEventCategory Category : Categories)
+    {
+        Mask |= 1u << (uint32)Category;
+    }
+
+    CategoryMask = Mask;
+
+    if (GetOwner() && !GetOwner()->HasAuthority())
+    {
+        ServerSetCategoryMask((int32)Mask);
+    }
+}
+
+void UWorldEventFeedComponent::ServerSetCategoryMask_Implementation(int32 Mask)
+{
+    CategoryMask = (uint32)Mask;
+}
+
+// Server
+void UWorldEventFeedComponent::QueueEvent(const FNetWorldEvent& Event)
+{
+    if (Event.IsPersistent())
+    {
+        if (Event.bEnded)
+        {
+            KnownPersistentEvents.Remove(Event.PersistentEventID);
+        }
+        else
+        {
+            KnownPersistentEvents.Add(Event.PersistentEventID);
+        }
+
+        PendingPersistent.Add(Event);
+        return;
+    }
+
+    if (PendingTransient.Num() >= MaxQueuedEvents)
+    {
+        // Evict the oldest of the lowest priority, or drop the newcomer if nothing ranks below it
+        int32 EvictIndex = INDEX_NONE;
+        for (int32 Index = 0; Index < PendingTransient.Num(); ++Index)
+        {
+            if (EvictIndex == INDEX_NONE || PendingTransient[Index].Priority < PendingTransient[EvictIndex].Priority)
+            {
+                EvictIndex = Index;
+            }
+        }
+
+        ++Stats.EventsDropped;
+
+        if (PendingTransient[EvictIndex].Priority > Event.Priority)
+        {
+            return;
+        }
+
+        PendingTransient.RemoveAt(EvictIndex);
+    }
+
+    PendingTransient.Add(Event);
+}
+
+void UWorldEventFeedComponent::FlushEvents(int32 MaxTransientEvents)
+{
+    if (PendingPersistent.Num() == 0 && PendingTransient.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FNetWorldEvent> Batch = MoveTemp(PendingPersistent);
+    PendingPersistent.Reset();
+
+    // Highest priority first, oldest first within a priority
+    const int32 NumTransient = FMath::Min(PendingTransient.Num(), FMath::Max(MaxTransientEvents, 0));
+    if (NumTransient > 0)
+    {
+        PendingTransient.StableSort([](const FNetWorldEvent& A, const FNetWorldEvent& B)
+        {
+            return A.Priority > B.Priority;
+        });
+
+        Batch.Append(PendingTransient.GetData(), NumTransient);
+        PendingTransient.RemoveAt(0, NumTransient);
+    }
+
+    if (Batch.Num() == 0)
+    {
+        return;
+    }
+
+#if !UE_BUILD_SHIPPING
+    if (CVarMeasureFeedBits.GetValueOnGameThread() != 0)
+    {
+        Stats.BitsSent += MeasureBatchBits(Batch);
+    }
+#endif
+    Stats.EventsSent += Batch.Num();
+    ++Stats.BatchesSent;
+
+    ClientReceiveEventBatch(Batch);
+}
+
+bool UWorldEventFeedComponent::GetViewLocation(FVector& OutLocation) const
+{
+    const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+    if (!PlayerController)
+    {
+        return false;
+    }
+
+    if (const APawn* Pawn = PlayerController->GetPawn())
+    {
+        OutLocation = Pawn->GetActorLocation();
+        return true;
+    }
+
+    if (const AActor* ViewTarget = PlayerController->GetViewTarget())
+    {
+        OutLocation = ViewTarget->GetActorLocation();
+        return true;
+    }
+
+    return false;
+}
+
+int64 UWorldEventFeedComponent::MeasureBatchBits(const TArray<FNetWorldEvent>& Events)
+{
+    UFunction* BatchFunction = StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UWorldEventFeedComponent, ClientReceiveEventBatch));
+    FArrayProperty* EventsParam = BatchFunction ? FindFProperty<FArrayProperty>(BatchFunction, TEXT("Events")) : nullptr;
+    if (!EventsParam)
+    {
+        return 0;
+    }
+
+    // Built on first use - the layout only depends on the RPC signature
+    if (!BatchLayout.IsValid())
+    {
+        BatchLayout = FRepLayout::CreateFromFunction(BatchFunction);
+    }
+
+    // Same parameter block ProcessEvent would build for the RPC
+    uint8* Params = (uint8*)FMemory_Alloca_Aligned(BatchFunction->ParmsSize, BatchFunction->GetMinAlignment());
+    BatchFunction->InitializeStruct(Params);
+    *EventsParam->ContainerPtrToValuePtr<TArray<FNetWorldEvent>>(Params) = Events;
+
+    // The owning connection's package map, so tags and names cost what they cost on the wire
+    const UNetConnection* Connection = GetOwner() ? GetOwner()->GetNetConnection() : nullptr;
+    FNetBitWriter Writer(Connection ? Connection->PackageMap : nullptr, 1024);
+
+    bool bHasUnmapped = false;
+    BatchLayout->SerializePropertiesForStruct(BatchFunction, Writer, Writer.PackageMap, Params, bHasUnmapped, this);
+
+    BatchFunction->DestroyStruct(Params);
+
+    return Writer.GetNumBits();
+}
+
+UWorldEventRelevancyManager* UWorldEventFeedComponent::GetRelevancyManager() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UWorldEventRelevancyManager>() : nullptr;
+}
+
+// Client
+void UWorldEventFeedComponent::ClientReceiveEventBatch_Implementation(const TArray<FNetWorldEvent>& Events)
+{
+    for (const FNetWorldEvent& Event : Events)
+    {
+        if (Event.IsPersistent())
+        {
+            RelevantWorldEvents.RemoveAll([&Event](const FNetWorldEvent& Existing)
+            {
+                return Existing.PersistentEventID == Event.PersistentEventID;
+            });
+
+            if (!Event.bEnded)
+            {
+                RelevantWorldEvents.Add(Event);
+            }
+        }
+
+        OnWorldEventReceived.Broadcast(Event);
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("World event batch received: %d events, %d relevant persistent"),
+        Events.Num(), RelevantWorldEvents.Num());
+}
@@ -0,0 +1,259 @@
+// Private/World/WorldEventRelevancyManager.cpp
+
+#include "World/WorldEventRelevancyManager.h"
+#include "World/WorldEventFeedComponent.h"
+#include "World/WorldEventManager.h"
+#include "World/RadiantZoneManager.h"
+#include "Core/RadiantGameState.h"
+#include "Engine/World.h"
+
+void UWorldEventRelevancyManager::Deinitialize()
+{
+    if (UWorldEventManager* Events = EventManager.Get())
+    {
+        Events->OnEventBroadcast.Remove(EventBroadcastHandle);
+    }
+
+    if (ARadiantGameState* State = GameState.Get())
+    {
+        State->OnWorldEventStarted.RemoveAll(this);
+        State->OnWorldEventEnded.RemoveAll(this);
+    }
+
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
+    {
+        RadiantTimers->ClearTimer(FlushTimerHandle);
+    }
+
+    Feeds.Empty();
+    PersistentEvents.Empty();
+
+    Super::Deinitialize();
+}
+
+void UWorldEventRelevancyManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Clients receive events through their feed - only the server judges relevance
+    if (InWorld.GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    EventManager = InWorld.GetSubsystem<UWorldEventManager>();
+    if (UWorldEventManager* Events = EventManager.Get())
+    {
+        EventBroadcastHandle = Events->OnEventBroadcast.AddUObject(this, &UWorldEventRelevancyManager::HandleWorldEvent);
+    }
+
+    GameState = InWorld.GetGameState<ARadiantGameState>();
+    if (ARadiantGameState* State = GameState.Get())
+    {
+        State->OnWorldEventStarted.AddDynamic(this, &UWorldEventRelevancyManager::HandlePersistentEventStarted);
+        State->OnWorldEventEnded.AddDynamic(this, &UWorldEventRelevancyManager::HandlePersistentEventEnded);
+
+        for (const FWorldEventData& EventData : State->GetActiveWorldEvents())
+        {
+            HandlePersistentEventStarted(EventData);
+        }
+    }
+
+    RestartFlushTimer();
+
+    UE_LOG(LogTemp, Log, TEXT("WorldEventRelevancyManager started"));
+}
+
+bool UWorldEventRelevancyManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UWorldEventRelevancyManager::ConfigureRelevancy(const FWorldEventRelevancyConfig& Config)
+{
+    RelevancyConfig = Config;
+    RestartFlushTimer();
+}
+
+void UWorldEventRelevancyManager::RestartFlushTimer()
+{
+    UWorld* World = GetWorld();
+    URadiantTimerManager* RadiantTimers = World ? World->GetSubsystem<URadiantTimerManager>() : nullptr;
+    if (!RadiantTimers)
+    {
+        return;
+    }
+
+    RadiantTimers->ClearTimer(FlushTimerHandle);
+
+    if (World->HasBegunPlay() && World->GetNetMode() != NM_Client)
+    {
+        FlushTimerHandle = RadiantTimers->SetTimer(this, &UWorldEventRelevancyManager::FlushFeeds, RelevancyConfig.FlushInterval, true);
+    }
+}
+
+// Feeds
+void UWorldEventRelevancyManager::RegisterFeed(UWorldEventFeedComponent* Feed)
+{
+    if (Feed)
+    {
+        Feeds.AddUnique(Feed);
+    }
+}
+
+void UWorldEventRelevancyManager::UnregisterFeed(UWorldEventFeedComponent* Feed)
+{
+    Feeds.RemoveSwap(Feed);
+}
+
+// Event intake
+void UWorldEventRelevancyManager::HandleWorldEvent(const FWorldEvent& Event)
+{
+    if (Feeds.Num() == 0)
+    {
+        return;
+    }
+
+    FNetWorldEvent NetEvent;
+    NetEvent.EventTag = Event.EventTag;
+    NetEvent.Category = Event.Category;
+    NetEvent.Priority = Event.Priority;
+    NetEvent.Location = Event.Location;
+    NetEvent.Radius = Event.Radius;
+    NetEvent.Intensity = Event.Intensity;
+    NetEvent.Timestamp = Event.Timestamp;
+    NetEvent.Duration = Event.Duration;
+
+    for (const TWeakObjectPtr<UWorldEventFeedComponent>& FeedPtr : Feeds)
+    {
+        if (UWorldEventFeedComponent* Feed = FeedPtr.Get())
+        {
+            if (IsRelevant(Feed, NetEvent, Event.Scope))
+            {
+                Feed->QueueEvent(NetEvent);
+            }
+            else
+            {
+                Feed->RecordFiltered();
+            }
+        }
+    }
+}
+
+void UWorldEventRelevancyManager::HandlePersistentEventStarted(const FWorldEventData& EventData)
+{
+    FNetWorldEvent NetEvent;
+    NetEvent.EventTag = EventData.EventType;
+    NetEvent.Category = EEventCategory::System;
+    NetEvent.Priority = EEventPriority::High;
+    NetEvent.Location = EventData.EventLocation;
+    NetEvent.Radius = EventData.EventRadius;
+    NetEvent.Timestamp = EventData.StartTime;
+    NetEvent.Duration = EventData.Duration;
+    NetEvent.PersistentEventID = EventData.EventID;
+
+    // Feeds pick it up at their next reconcile
+    PersistentEvents.Add(EventData.EventID, NetEvent);
+}
+
+void UWorldEventRelevancyManager::HandlePersistentEventEnded(const FWorldEventData& EventData)
+{
+    PersistentEvents.Remove(EventData.EventID);
+}
+
+// Delivery
+void UWorldEventRelevancyManager::FlushFeeds()
+{
+    for (int32 Index = Feeds.Num() - 1; Index >= 0; --Index)
+    {
+        UWorldEventFeedComponent* Feed = Feeds[Index].Get();
+        if (!Feed)
+        {
+            Feeds.RemoveAtSwap(Index);
+            continue;
+        }
+
+        ReconcilePersistentEvents(Feed);
+        Feed->FlushEvents(RelevancyConfig.MaxEventsPerBatch);
+    }
+}
+
+void UWorldEventRelevancyManager::ReconcilePersistentEvents(UWorldEventFeedComponent* Feed)
+{
+    // Copy - queueing edits the known set
+    const TSet<int32> KnownEvents = Feed->GetKnownPersistentEvents();
+
+    for (int32 EventID : KnownEvents)
+    {
+        const FNetWorldEvent* Event = PersistentEvents.Find(EventID);
+        if (!Event || !IsRelevant(Feed, *Event, EEventScope::Zone))
+        {
+            FNetWorldEvent EndEvent = Event ? *Event : FNetWorldEvent();
+            EndEvent.PersistentEventID = EventID;
+            EndEvent.bEnded = true;
+            Feed->QueueEvent(EndEvent);
+        }
+    }
+
+    for (const TPair<int32, FNetWorldEvent>& Pair : PersistentEvents)
+    {
+        if (!KnownEvents.Contains(Pair.Key) && IsRelevant(Feed, Pair.Value, EEventScope::Zone))
+        {
+            Feed->QueueEvent(Pair.Value);
+        }
+    }
+}
+
+bool UWorldEventRelevancyManager::IsRelevant(UWorldEventFeedComponent* Feed, const FNetWorldEvent& Event, EEventScope Scope) const
+{
+    if (!Feed->IsSubscribedTo(Event.Category))
+    {
+        return false;
+    }
+
+    if (Event.Priority == EEventPriority::Critical && RelevancyConfig.bAlwaysSendCritical)
+    {
+        return true;
+    }
+
+    switch (Scope)
+    {
+        case EEventScope::Global:
+        case EEventScope::Network:
+            return true;
+
+        case EEventScope::Zone:
+        case EEventScope::Regional:
+        {
+            FVector ViewLocation;
+            if (!Feed->GetViewLocation(ViewLocation))
+            {
+                return false;
+            }
+
+            if (FVector::DistSquared(ViewLocation, Event.Location) <= FMath::Square(FMath::Max(RelevancyConfig.ZoneScopeDistance, Event.Radius)))
+            {
+                return true;
+            }
+
+            const UWorldEventManager* Events = EventManager.Get();
+            const ARadiantZoneManager* EventZone = Events ? Events->GetZoneAtLocation(Event.Location) : nullptr;
+            return EventZone && EventZone == Events->GetZoneAtLocation(ViewLocation);
+        }
+
+        default:
+        {
+            FVector ViewLocation;
+            if (!Feed->GetViewLocation(ViewLocation))
+            {
+                return false;
+            }
+
+            // Higher priorities carry further
+            const float Reach = Event.Radius + RelevancyConfig.RelevancyPadding * (1.0f + (float)Event.Priority);
+            return FVector::DistSquared(ViewLocation, Event.Location) <= FMath::Square(Reach);
+        }
+    }
+}
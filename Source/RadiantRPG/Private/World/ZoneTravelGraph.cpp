@@ -0,0 +1,654 @@
+// Source/RadiantRPG/Private/World/ZoneTravelGraph.cpp
+
+#include "World/ZoneTravelGraph.h"
+#include "World/RadiantZoneManager.h"
+#include "World/RadiantWorldManager.h"
+#include "AI/Core/ARPG_CrowdManager.h"
+#include "Characters/ARPG_BaseNPCCharacter.h"
+#include "AI/ActionExecutors/ARPG_AIMovementExecutorComponent.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Algo/Reverse.h"
+
+void UZoneTravelGraph::Deinitialize()
+{
+    if (URadiantTimerManager* RadiantTimers = GetWorld() ? GetWorld()->GetSubsystem<URadiantTimerManager>() : nullptr)
+    {
+        RadiantTimers->ClearTimer(UpdateTimerHandle);
+    }
+
+    Nodes.Empty();
+    NodeIndices.Empty();
+    Travelers.Empty();
+
+    Super::Deinitialize();
+}
+
+void UZoneTravelGraph::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Zones saved before this world existed - loaded ones overwrite their node as they begin play
+    if (const URadiantWorldManager* WorldManager = InWorld.GetGameInstance() ? InWorld.GetGameInstance()->GetSubsystem<URadiantWorldManager>() : nullptr)
+    {
+        SeedZones(WorldManager->GetSavedZones());
+    }
+
+    RestartUpdateTimer();
+}
+
+bool UZoneTravelGraph::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create in game worlds
+    UWorld* World = Cast<UWorld>(Outer);
+    return World && (World->IsGameWorld() || World->IsPlayInEditor());
+}
+
+void UZoneTravelGraph::ConfigureTravel(const FZoneTravelConfig& Config)
+{
+    TravelConfig = Config;
+    RestartUpdateTimer();
+}
+
+void UZoneTravelGraph::RestartUpdateTimer()
+{
+    UWorld* World = GetWorld();
+    URadiantTimerManager* RadiantTimers = World ? World->GetSubsystem<URadiantTimerManager>() : nullptr;
+    if (!RadiantTimers)
+    {
+        return;
+    }
+
+    RadiantTimers->ClearTimer(UpdateTimerHandle);
+
+    if (World->HasBegunPlay() && World->GetNetMode() != NM_Client)
+    {
+        UpdateTimerHandle = RadiantTimers->SetTimer(this, &UZoneTravelGraph::UpdateTravelers, TravelConfig.UpdateInterval, true);
+    }
+}
+
+float UZoneTravelGraph::GetTravelTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+// Zone Registration
+void UZoneTravelGraph::RegisterZone(ARadiantZoneManager* Zone, const FZoneData& ZoneData, const TArray<FZoneTransition>& Transitions)
+{
+    if (!Zone || ZoneData.ZoneID.IsNone())
+    {
+        return;
+    }
+
+    FZoneNode& Node = FindOrAddNode(ZoneData.ZoneID);
+    ApplyZoneData(Node, ZoneData);
+    Node.Zone = Zone;
+    Node.Transitions = Transitions;
+    Node.bActive = Zone->IsZoneActive();
+
+    RebuildEdges();
+}
+
+void UZoneTravelGraph::SeedZones(const TMap<FName, FZoneData>& SavedZones)
+{
+    bool bChanged = false;
+
+    for (const auto& SavedPair : SavedZones)
+    {
+        const FZoneData& ZoneData = SavedPair.Value;
+        if (ZoneData.ZoneID.IsNone())
+        {
+            continue;
+        }
+
+        FZoneNode& Node = FindOrAddNode(ZoneData.ZoneID);
+        if (!Node.Zone.IsValid())
+        {
+            ApplyZoneData(Node, ZoneData);
+            bChanged = true;
+        }
+    }
+
+    if (bChanged)
+    {
+        RebuildEdges();
+    }
+}
+
+UZoneTravelGraph::FZoneNode& UZoneTravelGraph::FindOrAddNode(FName ZoneID)
+{
+    if (const int32* Existing = NodeIndices.Find(ZoneID))
+    {
+        return Nodes[*Existing];
+    }
+
+    const int32 Index = Nodes.AddDefaulted();
+    NodeIndices.Add(ZoneID, Index);
+    Nodes[Index].ZoneID = ZoneID;
+    return Nodes[Index];
+}
+
+void UZoneTravelGraph::ApplyZoneData(FZoneNode& Node, const FZoneData& ZoneData)
+{
+    Node.Bounds = FBox::BuildAABB(ZoneData.Boundary.Center, ZoneData.Boundary.Extents);
+    Node.ConnectedZones = ZoneData.ConnectedZones;
+}
+
+void UZoneTravelGraph::UnregisterZone(ARadiantZoneManager* Zone)
+{
+    for (FZoneNode& Node : Nodes)
+    {
+        if (Node.Zone == Zone)
+        {
+            // Keep the node and its edges - travelers still route through unloaded zones
+            Node.Zone.Reset();
+            Node.bActive = false;
+        }
+    }
+}
+
+void UZoneTravelGraph::SetZoneActive(ARadiantZoneManager* Zone, bool bActive)
+{
+    for (FZoneNode& Node : Nodes)
+    {
+        if (Node.Zone == Zone)
+        {
+            Node.bActive = bActive;
+        }
+    }
+}
+
+void UZoneTravelGraph::RebuildEdges()
+{
+    for (FZoneNode& Node : Nodes)
+    {
+        Node.Edges.Reset();
+    }
+
+    const auto AddEdge = [this](int32 From, int32 To, const FVector& Portal, float CrossingTime)
+    {
+        for (const FTravelEdge& Edge : Nodes[From].Edges)
+        {
+            if (Edge.ToNode == To)
+            {
+                return;
+            }
+        }
+
+        FTravelEdge& Edge = Nodes[From].Edges.AddDefaulted_GetRef();
+        Edge.ToNode = To;
+        Edge.Portal = Portal;
+        Edge.CrossingTime = CrossingTime;
+        Edge.Cost = FVector::Dist(Nodes[From].Bounds.GetCenter(), Portal)
+            + FVector::Dist(Portal, Nodes[To].Bounds.GetCenter())
+            + CrossingTime * TravelConfig.AbstractTravelSpeed;
+    };
+
+    // Connections are two-way - a zone only needs to list its neighbour once
+    for (int32 From = 0; From < Nodes.Num(); ++From)
+    {
+        const FZoneNode& Node = Nodes[From];
+
+        for (const FName& Connected : Node.ConnectedZones)
+        {
+            const int32* To = NodeIndices.Find(Connected);
+            if (!To || *To == From)
+            {
+                continue;
+            }
+
+            FVector Portal = (Node.Bounds.GetCenter() + Nodes[*To].Bounds.GetCenter()) * 0.5f;
+            float CrossingTime = 0.0f;
+
+            const FZoneTransition* Transition = Node.Transitions.FindByPredicate([&Connected](const FZoneTransition& T)
+            {
+                return T.ToZone == Connected;
+            });
+
+            if (!Transition)
+            {
+                Transition = Nodes[*To].Transitions.FindByPredicate([&Node](const FZoneTransition& T)
+                {
+                    return T.ToZone == Node.ZoneID;
+                });
+            }
+
+            if (Transition)
+            {
+                Portal = Transition->TransitionLocation;
+                CrossingTime = FMath::Max(0.0f, Transition->TransitionTime);
+            }
+
+            AddEdge(From, *To, Portal, CrossingTime);
+            AddEdge(*To, From, Portal, CrossingTime);
+        }
+    }
+}
+
+// Routing
+int32 UZoneTravelGraph::FindNodeAtLocation(const FVector& Location) const
+{
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        const FZoneNode& Node = Nodes[Index];
+
+        // Loaded zones know their own shape, unloaded ones fall back to the saved bounds
+        if (const ARadiantZoneManager* Zone = Node.Zone.Get())
+        {
+            if (Zone->IsLocationInZone(Location))
+            {
+                return Index;
+            }
+        }
+        else if (Node.Bounds.IsInsideOrOn(Location))
+        {
+            return Index;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+FName UZoneTravelGraph::GetZoneIDAtLocation(FVector Location) const
+{
+    const int32 Index = FindNodeAtLocation(Location);
+    return Index != INDEX_NONE ? Nodes[Index].ZoneID : NAME_None;
+}
+
+bool UZoneTravelGraph::FindNodePath(int32 StartNode, int32 GoalNode, TArray<int32>& OutPath) const
+{
+    struct FOpenEntry
+    {
+        float Cost;
+        int32 Node;
+
+        bool operator<(const FOpenEntry& Other) const { return Cost < Other.Cost; }
+    };
+
+    TArray<float> Costs;
+    TArray<int32> Previous;
+    Costs.Init(MAX_flt, Nodes.Num());
+    Previous.Init(INDEX_NONE, Nodes.Num());
+
+    TArray<FOpenEntry> Open;
+    Costs[StartNode] = 0.0f;
+    Open.HeapPush({ 0.0f, StartNode });
+
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Current;
+        Open.HeapPop(Current, EAllowShrinking::No);
+
+        if (Current.Node == GoalNode)
+        {
+            break;
+        }
+
+        // Stale entry - a cheaper path to this node was already expanded
+        if (Current.Cost > Costs[Current.Node])
+        {
+            continue;
+        }
+
+        for (const FTravelEdge& Edge : Nodes[Current.Node].Edges)
+        {
+            const float NewCost = Current.Cost + Edge.Cost;
+            if (NewCost < Costs[Edge.ToNode])
+            {
+                Costs[Edge.ToNode] = NewCost;
+                Previous[Edge.ToNode] = Current.Node;
+                Open.HeapPush({ NewCost, Edge.ToNode });
+            }
+        }
+    }
+
+    if (Costs[GoalNode] == MAX_flt)
+    {
+        return false;
+    }
+
+    OutPath.Reset();
+    for (int32 Node = GoalNode; Node != INDEX_NONE; Node = Previous[Node])
+    {
+        OutPath.Add(Node);
+    }
+    Algo::Reverse(OutPath);
+
+    return true;
+}
+
+bool UZoneTravelGraph::BuildRoute(const FVector& Start, const FVector& Destination, FTraveler& OutRoute) const
+{
+    const int32 StartNode = FindNodeAtLocation(Start);
+    const int32 GoalNode = FindNodeAtLocation(Destination);
+
+    // Outside the graph or inside one zone - a single leg straight to the destination
+    TArray<int32> Path;
+    if (StartNode != INDEX_NONE && GoalNode != INDEX_NONE && StartNode != GoalNode)
+    {
+        if (!FindNodePath(StartNode, GoalNode, Path))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        Path.Add(StartNode);
+    }
+
+    for (int32 Step = 0; Step + 1 < Path.Num(); ++Step)
+    {
+        for (const FTravelEdge& Edge : Nodes[Path[Step]].Edges)
+        {
+            if (Edge.ToNode == Path[Step + 1])
+            {
+                OutRoute.Waypoints.Add(Edge.Portal);
+                OutRoute.LegNodes.Add(Path[Step]);
+                OutRoute.CrossingTimes.Add(Edge.CrossingTime);
+                break;
+            }
+        }
+    }
+
+    OutRoute.Waypoints.Add(Destination);
+    OutRoute.LegNodes.Add(Path.Last());
+    OutRoute.CrossingTimes.Add(0.0f);
+
+    return true;
+}
+
+bool UZoneTravelGraph::FindRoute(FVector Start, FVector Destination, TArray<FVector>& OutWaypoints) const
+{
+    FTraveler Route;
+    if (!BuildRoute(Start, Destination, Route))
+    {
+        OutWaypoints.Reset();
+        return false;
+    }
+
+    OutWaypoints = MoveTemp(Route.Waypoints);
+    return true;
+}
+
+// Travel
+bool UZoneTravelGraph::StartTravel(AARPG_BaseNPCCharacter* NPC, FVector Destination)
+{
+    if (!IsValid(NPC) || !NPC->HasAuthority() || NPC->IsCrowdPooled())
+    {
+        return false;
+    }
+
+    FTraveler Route;
+    if (!BuildRoute(NPC->GetActorLocation(), Destination, Route))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ZoneTravelGraph: no route from %s to %s for %s"),
+            *GetZoneIDAtLocation(NPC->GetActorLocation()).ToString(), *GetZoneIDAtLocation(Destination).ToString(), *NPC->GetName());
+        return false;
+    }
+
+    CancelTravel(NPC);
+
+    Route.NPC = NPC;
+    Route.LegStart = NPC->GetActorLocation();
+    Route.LegStartTime = GetTravelTime();
+    Travelers.Add(MoveTemp(Route));
+
+    // The route owns movement until the NPC arrives
+    NPC->SetBrainEnabled(false);
+
+    return true;
+}
+
+void UZoneTravelGraph::CancelTravel(AARPG_BaseNPCCharacter* NPC)
+{
+    const int32 Index = FindTravelerIndex(NPC);
+    if (Index != INDEX_NONE)
+    {
+        StopMove(NPC);
+        FinishTravel(Index, false);
+    }
+}
+
+bool UZoneTravelGraph::IsTraveling(const AARPG_BaseNPCCharacter* NPC) const
+{
+    return FindTravelerIndex(NPC) != INDEX_NONE;
+}
+
+int32 UZoneTravelGraph::FindTravelerIndex(const AARPG_BaseNPCCharacter* NPC) const
+{
+    return Travelers.IndexOfByPredicate([NPC](const FTraveler& Traveler)
+    {
+        return Traveler.NPC.Get() == NPC;
+    });
+}
+
+void UZoneTravelGraph::FinishTravel(int32 TravelerIndex, bool bArrived)
+{
+    AARPG_BaseNPCCharacter* NPC = Travelers[TravelerIndex].NPC.Get();
+    Travelers.RemoveAtSwap(TravelerIndex);
+
+    if (NPC)
+    {
+        // A pooled NPC gets its brain back when the crowd manager promotes it
+        if (!NPC->IsCrowdPooled())
+        {
+            NPC->SetBrainEnabled(true);
+        }
+
+        OnTravelFinished.Broadcast(NPC, bArrived);
+    }
+}
+
+void UZoneTravelGraph::UpdateTravelers()
+{
+    UWorld* World = GetWorld();
+    if (!World || Travelers.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FVector, TInlineAllocator<8>> ViewLocations;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APlayerController* PlayerController = It->Get())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            ViewLocations.Add(ViewLocation);
+        }
+    }
+
+    const float Now = GetTravelTime();
+
+    // Backwards - finished travelers are swap-removed and may broadcast into gameplay code
+    for (int32 Index = Travelers.Num() - 1; Index >= 0; --Index)
+    {
+        if (Index < Travelers.Num() && !UpdateTraveler(Travelers[Index], ViewLocations, Now))
+        {
+            FinishTravel(Index, Travelers[Index].Leg >= Travelers[Index].Waypoints.Num());
+        }
+    }
+}
+
+bool UZoneTravelGraph::UpdateTraveler(FTraveler& Traveler, const TArray<FVector, TInlineAllocator<8>>& ViewLocations, float Now)
+{
+    AARPG_BaseNPCCharacter* NPC = Traveler.NPC.Get();
+
+    // Parked by the crowd manager - its proxy keeps the last position
+    if (!NPC || NPC->IsCrowdPooled())
+    {
+        return false;
+    }
+
+    // An abstract traveler's actor stays put until it has somewhere to stand
+    const FVector Location = Traveler.bAbstract ? GetAbstractLocation(Traveler, Now) : NPC->GetActorLocation();
+    const FVector& Waypoint = Traveler.Waypoints[Traveler.Leg];
+
+    const int32 LegNode = Traveler.LegNodes[Traveler.Leg];
+    bool bObserved = LegNode == INDEX_NONE || Nodes[LegNode].bActive;
+
+    if (bObserved)
+    {
+        const float ObservedDistSq = FMath::Square(TravelConfig.ObservedDistance);
+        bObserved = ViewLocations.ContainsByPredicate([&Location, ObservedDistSq](const FVector& ViewLocation)
+        {
+            return FVector::DistSquared(Location, ViewLocation) < ObservedDistSq;
+        });
+    }
+
+    // Nowhere to stand yet - stay on the timed leg
+    if (bObserved && Traveler.bAbstract && !ResumeOnNavmesh(Traveler, Now))
+    {
+        bObserved = false;
+    }
+
+    if (!bObserved)
+    {
+        if (!Traveler.bAbstract)
+        {
+            StopMove(NPC);
+            Traveler.LegStart = Location;
+            BeginAbstractLeg(Traveler, Now);
+        }
+
+        if (Now - Traveler.LegStartTime < Traveler.LegDuration)
+        {
+            return true;
+        }
+
+        const bool bLastLeg = Traveler.Leg + 1 == Traveler.Waypoints.Num();
+        if (!PlaceNPC(NPC, Waypoint) && bLastLeg && !HandOffToCrowd(NPC, Waypoint))
+        {
+            // Neither standing nor parked at the destination - the trip did not arrive
+            return false;
+        }
+    }
+    else
+    {
+        if (FVector::DistSquared2D(NPC->GetActorLocation(), Waypoint) > FMath::Square(TravelConfig.AcceptanceRadius))
+        {
+            // Re-issue after failures or interruptions - MoveTo is cheap when already on the way
+            const UARPG_AIMovementExecutorComponent* Movement = NPC->FindComponentByClass<UARPG_AIMovementExecutorComponent>();
+            if (!Traveler.bMoveIssued || !Movement || Movement->CurrentMovementState != EARPG_MovementState::Moving)
+            {
+                Traveler.bMoveIssued = IssueMove(NPC, Waypoint);
+            }
+            return true;
+        }
+    }
+
+    // Leg done - the next one starts from here
+    ++Traveler.Leg;
+    Traveler.bMoveIssued = false;
+
+    if (Traveler.Leg >= Traveler.Waypoints.Num())
+    {
+        return false;
+    }
+
+    Traveler.LegStart = Waypoint;
+    if (Traveler.bAbstract)
+    {
+        BeginAbstractLeg(Traveler, Now);
+    }
+
+    return true;
+}
+
+void UZoneTravelGraph::BeginAbstractLeg(FTraveler& Traveler, float Now) const
+{
+    Traveler.bAbstract = true;
+    Traveler.LegStartTime = Now;
+    Traveler.LegDuration = FVector::Dist(Traveler.LegStart, Traveler.Waypoints[Traveler.Leg]) / TravelConfig.AbstractTravelSpeed
+        + Traveler.CrossingTimes[Traveler.Leg];
+}
+
+FVector UZoneTravelGraph::GetAbstractLocation(const FTraveler& Traveler, float Now) const
+{
+    const float Alpha = Traveler.LegDuration > 0.0f ? FMath::Clamp((Now - Traveler.LegStartTime) / Traveler.LegDuration, 0.0f, 1.0f) : 1.0f;
+    return FMath::Lerp(Traveler.LegStart, Traveler.Waypoints[Traveler.Leg], Alpha);
+}
+
+bool UZoneTravelGraph::ResumeOnNavmesh(FTraveler& Traveler, float Now) const
+{
+    AARPG_BaseNPCCharacter* NPC = Traveler.NPC.Get();
+    if (!NPC || !PlaceNPC(NPC, GetAbstractLocation(Traveler, Now)))
+    {
+        return false;
+    }
+
+    Traveler.bAbstract = false;
+    Traveler.bMoveIssued = false;
+    return true;
+}
+
+bool UZoneTravelGraph::PlaceNPC(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const
+{
+    // Unloaded zones have no ground under the route point
+    const int32 Node = FindNodeAtLocation(Location);
+    if (Node != INDEX_NONE && !Nodes[Node].Zone.IsValid())
+    {
+        return false;
+    }
+
+    // Route points are straight-line guesses - only stand where the navmesh says there is floor
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    FNavLocation Projected;
+    if (!NavSys || !NavSys->ProjectPointToNavigation(Location, Projected))
+    {
+        return false;
+    }
+
+    const FVector Target = Projected.Location + FVector(0.0f, 0.0f, NPC->GetSimpleCollisionHalfHeight());
+    NPC->SetActorLocation(Target, false, nullptr, ETeleportType::TeleportPhysics);
+    return true;
+}
+
+bool UZoneTravelGraph::HandOffToCrowd(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const
+{
+    // Promoted again, with a fresh navmesh projection, once a player comes near
+    UARPG_CrowdManager* CrowdManager = GetWorld() ? GetWorld()->GetSubsystem<UARPG_CrowdManager>() : nullptr;
+    if (!CrowdManager || !CrowdManager->DemoteNPCAt(NPC, Location).IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ZoneTravelGraph: %s arrived off the navmesh or in an unloaded zone and could not become a crowd proxy"), *NPC->GetName());
+        return false;
+    }
+
+    return true;
+}
+
+bool UZoneTravelGraph::IssueMove(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const
+{
+    if (UARPG_AIMovementExecutorComponent* Movement = NPC->FindComponentByClass<UARPG_AIMovementExecutorComponent>())
+    {
+        return Movement->MoveToLocation(Location, TravelConfig.AcceptanceRadius);
+    }
+
+    if (AAIController* AIController = Cast<AAIController>(NPC->GetController()))
+    {
+        return AIController->MoveToLocation(Location, TravelConfig.AcceptanceRadius) == EPathFollowingRequestResult::RequestSuccessful;
+    }
+
+    return false;
+}
+
+void UZoneTravelGraph::StopMove(AARPG_BaseNPCCharacter* NPC) const
+{
+    if (!NPC)
+    {
+        return;
+    }
+
+    if (UARPG_AIMovementExecutorComponent* Movement = NPC->FindComponentByClass<UARPG_AIMovementExecutorComponent>())
+    {
+        Movement->StopMovement();
+    }
+    else if (AAIController* AIController = Cast<AAIController>(NPC->GetController()))
+    {
+        AIController->StopMovement();
+    }
+}
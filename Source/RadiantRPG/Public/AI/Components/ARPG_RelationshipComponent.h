@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTags.h"
 #include "AI/Interfaces/ARPG_FactionInterface.h"
+#include "Core/RadiantTimerManager.h"
 #include "ARPG_RelationshipComponent.generated.h"
 
 /**
@@ -61,7 +62,7 @@ protected:
     /** Default relationship for unknown actors based on faction */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relationships", meta = (ClampMin = "-1.0", ClampMax = "1.0"))
     float DefaultNeutralRelationship = 0.0f;
-    FTimerHandle CleanupTimer;
+    FRadiantTimerHandle CleanupTimer;
 
 public:
     /**
@@ -88,6 +89,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Relationships")
     void ModifyRelationshipValue(AActor* TargetActor, float Delta);
 
+    /** Forget the relationship with one actor - returns false if there was none */
+    bool RemoveRelationship(AActor* TargetActor, float& OutValue);
+
+    /** Forget every individual relationship - faction defaults apply again */
+    UFUNCTION(BlueprintCallable, Category = "Relationships")
+    void ClearRelationships();
+
+    /** All individual relationships */
+    const TArray<FARPG_RelationshipEntry>& GetRelationships() const { return ActorRelationships; }
+
 private:
     /** Find relationship entry for a specific actor */
     FARPG_RelationshipEntry* FindRelationshipEntry(AActor* TargetActor);
@@ -8,6 +8,8 @@
 #include "Types/ARPG_AITypes.h"
 #include "AI/Interfaces/IARPG_AIBrainInterface.h"
 #include "Types/EventTypes.h"
+#include "Types/ARPG_NPCTypes.h"
+#include "Core/RadiantTimerManager.h"
 #include "ARPG_AIBrainComponent.generated.h"
 
 class UARPG_AIMemoryComponent;
@@ -16,6 +18,7 @@ class UARPG_AINeedsComponent;
 class UARPG_AIPersonalityComponent;
 class UARPG_AIEventManager;
 class UARPG_AIBehaviorExecutorComponent;
+class UARPG_RoutineManager;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIntentChanged, const FARPG_AIIntent&, NewIntent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBrainStateChanged, EARPG_BrainState, NewState);
@@ -92,6 +95,26 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Brain")
     FARPG_AIInputVector GetCurrentInputVector() const;
 
+    // === Daily Routine ===
+
+    /**
+     * Follow an archetype's daily routine. Tick and curiosity stop - intents are
+     * pushed by the routine manager at each transition, and the full evaluation
+     * only runs while a stimulus interrupts the routine
+     */
+    UFUNCTION(BlueprintCallable, Category = "AI Brain|Routine")
+    void StartRoutine(EARPG_NPCArchetype Archetype);
+
+    /** Return to full brain evaluation */
+    UFUNCTION(BlueprintCallable, Category = "AI Brain|Routine")
+    void StopRoutine();
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Brain|Routine")
+    bool IsFollowingRoutine() const { return bFollowingRoutine && !bRoutineInterrupted; }
+
+    /** Adopt a routine activity - ignored unless the routine is in control */
+    void ApplyRoutineIntent(const FGameplayTag& Activity);
+
     // === Events ===
 
     /** Triggered when intent changes */
@@ -130,8 +153,11 @@ protected:
     /** Start or restart the curiosity timer */
     void StartCuriosityTimer();
     
+    /** Curiosity timer callback */
+    void HandleCuriosityTimer();
+    
     /** Timer handle for curiosity checks */
-    FTimerHandle CuriosityTimerHandle;
+    FRadiantTimerHandle CuriosityTimerHandle;
     
     // === DATA TABLE INTEGRATION ===
     
@@ -185,6 +211,16 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Intent")
     TArray<FGameplayTag> CuriosityIntentTags;
 
+    // === Routine ===
+
+    /** Stimuli at or above this intensity interrupt the routine; weaker ones are only buffered */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float RoutineInterruptThreshold = 0.5f;
+
+    /** Seconds without stimuli before an interrupted NPC returns to its routine */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine", meta = (ClampMin = "0.0"))
+    float RoutineResumeDelay = 15.0f;
+
     // === Blueprint Implementable Functions ===
 
     /** Blueprint implementation for stimulus processing */
@@ -215,6 +251,11 @@ private:
     float TimeSinceLastUpdate;
     float LastStimulusTime;
 
+    /** Routine state */
+    bool bFollowingRoutine = false;
+    bool bRoutineInterrupted = false;
+    EARPG_NPCArchetype RoutineArchetype = EARPG_NPCArchetype::Generic;
+
     // === Internal Methods ===
 
     /** Initialize component references */
@@ -253,6 +294,14 @@ private:
     /** Clean up old stimuli */
     void CleanupOldStimuli();
 
+    /** Hand control from the routine to the full brain */
+    void InterruptRoutine();
+
+    /** Hand control back to the routine and adopt the current activity */
+    void ResumeRoutine();
+
+    UARPG_RoutineManager* GetRoutineManager() const;
+
     /** Handle AI events */
     UFUNCTION()
     void OnAIEventReceived(const FARPG_AIEvent& Event);
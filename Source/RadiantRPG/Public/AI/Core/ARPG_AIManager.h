@@ -9,6 +9,8 @@
 #include "Types/ARPG_AITypes.h"
 #include "Types/ARPG_AIEventTypes.h"
 #include "Types/SystemTypes.h"
+#include "Characters/BaseCharacter.h"
+#include "Core/RadiantTimerManager.h"
 #include "ARPG_AIManager.generated.h"
 
 class AARPG_BaseNPCCharacter;
@@ -60,12 +62,86 @@ struct FARPG_AIManagerConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
     FGameplayTag DefaultIdleIntent;
 
+    /** Seconds between NPC significance passes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.1"))
+    float SignificanceUpdateInterval = 0.5f;
+
+    /** NPCs further than this from every player have no significance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "1.0"))
+    float SignificanceMaxDistance = 15000.0f;
+
+    /** Significance added while an NPC is in combat */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float CombatSignificanceBonus = 0.5f;
+
+    /** Significance multiplier for NPCs outside every player's view cone */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float OffscreenSignificanceScale = 0.5f;
+
+    /** Half angle of the view cone counted as visible */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+    float ViewConeHalfAngle = 60.0f;
+
+    /** Net update frequency at zero and full significance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.1"))
+    float MinNetUpdateFrequency = 2.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.1"))
+    float MaxNetUpdateFrequency = 30.0f;
+
+    /** Net priority at zero and full significance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.1"))
+    float MinNetPriority = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.1"))
+    float MaxNetPriority = 3.0f;
+
+    /** Seconds an NPC must stay idle and unchanged before going net dormant (0 = never) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+    float DormancyDelay = 5.0f;
+
+    /** Movement below this between passes still counts as unchanged */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+    float DormancyMoveTolerance = 10.0f;
+
     FARPG_AIManagerConfig()
     {
         DefaultIdleIntent = FGameplayTag::RequestGameplayTag(TEXT("AI.Intent.Idle"));
     }
 };
 
+/**
+ * Per-NPC significance, shared by AI LOD and network replication
+ */
+USTRUCT(BlueprintType)
+struct FARPG_NPCSignificance
+{
+    GENERATED_BODY()
+
+    /** 0 = irrelevant to every player, 1 = fully relevant */
+    UPROPERTY(BlueprintReadOnly, Category = "Significance")
+    float Significance = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Significance")
+    float NearestViewerDistance = MAX_flt;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Significance")
+    bool bInCombat = false;
+
+    /** Inside at least one player's view cone */
+    UPROPERTY(BlueprintReadOnly, Category = "Significance")
+    bool bVisible = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Significance")
+    bool bNetDormant = false;
+
+    // Change tracking for dormancy
+    FVector LastLocation = FVector::ZeroVector;
+    FGameplayTag LastBehavior;
+    ECharacterState LastState = ECharacterState::Idle;
+    float LastChangeTime = 0.0f;
+};
+
 /**
  * AI Manager - World Subsystem
  * Central manager for all AI entities and behaviors
@@ -200,6 +276,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Manager")
     float GetCurrentAILoad() const { return CurrentAILoad; }
 
+    /** Last computed significance of an NPC */
+    UFUNCTION(BlueprintCallable, Category = "AI Manager")
+    FARPG_NPCSignificance GetNPCSignificance(AARPG_BaseNPCCharacter* NPC) const;
+
 protected:
     // === Internal Methods ===
     
@@ -239,6 +319,17 @@ protected:
     /** Handle zone transition for NPCs */
     void HandleZoneTransition(AARPG_BaseNPCCharacter* NPC, FGameplayTag FromZone, FGameplayTag ToZone);
 
+    // === Significance ===
+
+    /** (Re)start the significance pass on the timer wheel */
+    void StartSignificanceTimer();
+
+    /** Score every NPC against every player view and apply the results */
+    void UpdateNPCSignificance();
+
+    /** Drive replication rate, priority and dormancy from significance */
+    void ApplyNetSignificance(AARPG_BaseNPCCharacter* NPC, FARPG_NPCSignificance& State, float CurrentTime);
+
 private:
     // === Configuration ===
     
@@ -308,6 +399,11 @@ private:
     /** NPCs in player vicinity */
     TSet<AARPG_BaseNPCCharacter*> NearbyNPCs;
 
+    /** Significance of each registered NPC */
+    TMap<AARPG_BaseNPCCharacter*, FARPG_NPCSignificance> NPCSignificance;
+
+    FRadiantTimerHandle SignificanceTimerHandle;
+
     /** Cache for spatial queries */
     mutable TMap<FVector, TPair<float, TArray<AARPG_BaseNPCCharacter*>>> SpatialQueryCache;
 
@@ -176,6 +176,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Memory Management")
     void ClearAllMemories();
 
+    /** Drop every memory, permanent ones included, without forget events - the owner is taking on a new identity */
+    void ResetMemory();
+
     // === Memory Statistics ===
 
     /** Get total number of memories */
@@ -0,0 +1,195 @@
+// Public/AI/Core/ARPG_CrowdManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Types/ARPG_NPCTypes.h"
+#include "Core/RadiantTimerManager.h"
+#include "ARPG_CrowdManager.generated.h"
+
+class AARPG_BaseNPCCharacter;
+class ARadiantZoneManager;
+
+/**
+ * Crowd manager configuration
+ */
+USTRUCT(BlueprintType)
+struct FARPG_CrowdConfig
+{
+    GENERATED_BODY()
+
+    /** Proxies closer than this to any player become full NPCs */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0.0"))
+    float PromoteDistance = 6000.0f;
+
+    /** Full NPCs further than this from every player fall back to proxies - keep above PromoteDistance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0.0"))
+    float DemoteDistance = 8000.0f;
+
+    /** Seconds between promotion checks */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0.1"))
+    float PromotionInterval = 0.5f;
+
+    /** Seconds between bulk proxy simulation passes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0.1"))
+    float SimulationInterval = 2.0f;
+
+    /** Promotions per check - the rest wait for the next check */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "1"))
+    int32 MaxPromotionsPerUpdate = 8;
+
+    /** Parked actors kept per class for reuse */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0"))
+    int32 MaxPooledPerClass = 32;
+
+    /** Need growth per second while a proxy */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd", meta = (ClampMin = "0.0"))
+    float NeedGrowthRate = 0.002f;
+};
+
+/**
+ * Crowd Manager - World Subsystem
+ *
+ * Keeps distant NPCs as compact proxies instead of full characters. Proxies
+ * are simulated in bulk on a slow timer: needs grow, and routine activities
+ * follow the routine manager once per archetype rather than once per NPC.
+ * When a player comes within PromoteDistance, the proxy is promoted to an
+ * AARPG_BaseNPCCharacter taken from a per-class pool. When every player is
+ * beyond DemoteDistance, the NPC's state is captured back into the proxy
+ * and the actor is parked in the pool. Server only.
+ */
+UCLASS()
+class RADIANTRPG_API UARPG_CrowdManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Proxies
+    UFUNCTION(BlueprintCallable, Category = "Crowd")
+    FARPG_CrowdProxyHandle AddProxy(const FARPG_CrowdProxy& Proxy);
+
+    /** Remove a proxy, parking its actor if it is promoted */
+    UFUNCTION(BlueprintCallable, Category = "Crowd")
+    void RemoveProxy(UPARAM(ref) FARPG_CrowdProxyHandle& Handle);
+
+    /** Turn a live NPC into a proxy - it is promoted again when a player comes near */
+    UFUNCTION(BlueprintCallable, Category = "Crowd")
+    FARPG_CrowdProxyHandle DemoteNPC(AARPG_BaseNPCCharacter* NPC);
+
+    /** As DemoteNPC, with the proxy standing at ProxyLocation instead of where the actor is */
+    FARPG_CrowdProxyHandle DemoteNPCAt(AARPG_BaseNPCCharacter* NPC, const FVector& ProxyLocation);
+
+    UFUNCTION(BlueprintCallable, Category = "Crowd")
+    bool GetProxy(const FARPG_CrowdProxyHandle& Handle, FARPG_CrowdProxy& OutProxy) const;
+
+    /** Actor standing in for the proxy, or null while it is a proxy */
+    UFUNCTION(BlueprintPure, Category = "Crowd")
+    AARPG_BaseNPCCharacter* GetPromotedNPC(const FARPG_CrowdProxyHandle& Handle) const;
+
+    UFUNCTION(BlueprintPure, Category = "Crowd")
+    int32 GetNumProxies() const { return NumProxies; }
+
+    UFUNCTION(BlueprintPure, Category = "Crowd")
+    int32 GetNumPromoted() const { return NumPromoted; }
+
+    // Zones
+    /** Count the proxies inside the zone and keep its resident count in step from now on */
+    void RegisterZone(ARadiantZoneManager* Zone);
+
+    void UnregisterZone(ARadiantZoneManager* Zone);
+
+    // Configuration
+    UFUNCTION(BlueprintCallable, Category = "Crowd")
+    void ConfigureCrowd(const FARPG_CrowdConfig& Config);
+
+protected:
+    struct FProxySlot
+    {
+        FARPG_CrowdProxy Proxy;
+        TWeakObjectPtr<AARPG_BaseNPCCharacter> Actor;
+
+        /** While promoted - relationships with proxies that have no actor to hold them on the relationship component */
+        TArray<FARPG_CrowdRelationship, TInlineAllocator<FARPG_CrowdProxy::MaxKeyRelationships>> HeldRelationships;
+
+        /** Zone counting this proxy - none while promoted, the actor is counted by overlap instead */
+        int32 ZoneIndex = INDEX_NONE;
+
+        int32 Serial = 0;
+        bool bInUse = false;
+    };
+
+    struct FCrowdZone
+    {
+        TWeakObjectPtr<ARadiantZoneManager> Zone;
+        int32 NumProxies = 0;
+    };
+
+    /** Promote proxies near players and demote NPCs far from all of them */
+    void UpdatePromotion();
+
+    /** Advance every unpromoted proxy */
+    void SimulateProxies();
+
+    void Promote(FProxySlot& Slot);
+
+    /** Capture and park the slot's actor - the proxy stands at ProxyLocation if given, else where the actor was */
+    void Demote(FProxySlot& Slot, const FVector* ProxyLocation = nullptr);
+
+    /** Copy an NPC's state into a proxy, keeping the strongest of its live and held relationships */
+    static void CaptureNPC(const AARPG_BaseNPCCharacter* NPC, TConstArrayView<FARPG_CrowdRelationship> HeldRelationships, FARPG_CrowdProxy& OutProxy);
+
+    /** Apply a slot's proxy state to the NPC promoted for it */
+    void ApplyProxy(FProxySlot& Slot, AARPG_BaseNPCCharacter* NPC);
+
+    /** Move promoted NPCs' relationships with a promoted actor onto their slots, keyed by its handle - it is about to be pooled */
+    void DetachRelationships(const FARPG_CrowdProxyHandle& Handle, AARPG_BaseNPCCharacter* NPC);
+
+    /** Hand held relationships with a proxy to the actor just promoted for it */
+    void AttachRelationships(const FARPG_CrowdProxyHandle& Handle, AARPG_BaseNPCCharacter* NPC);
+
+    FARPG_CrowdProxyHandle MakeHandle(int32 Index) const;
+
+    /** Count an unpromoted proxy towards the zone it stands in */
+    void AddToZone(FProxySlot& Slot);
+
+    /** Stop counting the proxy - it was promoted or removed */
+    void RemoveFromZone(FProxySlot& Slot);
+
+    int32 FindZoneIndexAt(const FVector& Location) const;
+
+    AARPG_BaseNPCCharacter* AcquireNPC(UClass* NPCClass, const FVector& Location, const FRotator& Rotation);
+    void ReleaseNPC(AARPG_BaseNPCCharacter* NPC);
+
+    FProxySlot* FindSlot(const FARPG_CrowdProxyHandle& Handle);
+    const FProxySlot* FindSlot(const FARPG_CrowdProxyHandle& Handle) const;
+
+    void RestartTimers();
+
+private:
+    TArray<FProxySlot> Slots;
+    TArray<int32> FreeSlots;
+
+    /** Registered zones - indices are stable, unregistered entries are reused */
+    TArray<FCrowdZone> Zones;
+
+    /** Parked actors waiting for reuse */
+    UPROPERTY()
+    TArray<TObjectPtr<AARPG_BaseNPCCharacter>> Pool;
+
+    UPROPERTY()
+    FARPG_CrowdConfig CrowdConfig;
+
+    int32 NumProxies = 0;
+    int32 NumPromoted = 0;
+
+    float LastSimulationTime = 0.0f;
+
+    FRadiantTimerHandle PromotionTimerHandle;
+    FRadiantTimerHandle SimulationTimerHandle;
+};
@@ -0,0 +1,101 @@
+// Public/AI/Core/ARPG_RoutineManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Types/ARPG_NPCTypes.h"
+#include "World/GameCalendar.h"
+#include "ARPG_RoutineManager.generated.h"
+
+class UARPG_AIBrainComponent;
+class UDataTable;
+class URadiantWorldManager;
+
+/**
+ * An archetype's routine compiled to one activity per game hour
+ */
+struct FARPG_CompiledRoutine
+{
+    static constexpr int32 HoursPerDay = 24;
+
+    FGameplayTag HourActivities[HoursPerDay];
+
+    /** Bit per hour whose activity differs from the hour before */
+    uint32 TransitionMask = 0;
+
+    bool IsTransitionHour(int32 Hour) const { return (TransitionMask & (1u << Hour)) != 0; }
+};
+
+/**
+ * Routine Manager - World Subsystem
+ *
+ * Each archetype's daily routine is compiled into an hour-indexed table, and the
+ * world calendar wakes the manager once per game hour. Only archetypes whose
+ * activity changes at that hour push a new intent to their followers, so NPCs
+ * following a routine do no work between transitions. The full brain evaluation
+ * only runs while a follower is interrupted by a stimulus.
+ */
+UCLASS()
+class RADIANTRPG_API UARPG_RoutineManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Routines
+    /** Compile routines from a table of FARPG_NPCRoutine rows, replacing the built-in defaults per archetype */
+    UFUNCTION(BlueprintCallable, Category = "Routine")
+    void LoadRoutineTable(UDataTable* RoutineTable);
+
+    UFUNCTION(BlueprintCallable, Category = "Routine")
+    void SetRoutine(const FARPG_NPCRoutine& Routine);
+
+    UFUNCTION(BlueprintPure, Category = "Routine")
+    FGameplayTag GetRoutineActivity(EARPG_NPCArchetype Archetype, int32 Hour) const;
+
+    /** Activity for the current game hour */
+    UFUNCTION(BlueprintPure, Category = "Routine")
+    FGameplayTag GetCurrentActivity(EARPG_NPCArchetype Archetype) const;
+
+    // Followers
+    void RegisterFollower(UARPG_AIBrainComponent* Brain, EARPG_NPCArchetype Archetype);
+    void UnregisterFollower(UARPG_AIBrainComponent* Brain, EARPG_NPCArchetype Archetype);
+
+    int32 GetNumFollowers(EARPG_NPCArchetype Archetype) const;
+
+protected:
+    /** Calendar callback - once per game hour, or once per advance after a time skip */
+    void HandleHourBoundary(const FSimpleWorldTime& Time, int32 Occurrences);
+
+    /** Push an archetype's activity to every follower */
+    void NotifyFollowers(int32 ArchetypeIndex, const FGameplayTag& Activity);
+
+    void BuildDefaultRoutines();
+    static void CompileRoutine(const FARPG_NPCRoutine& Routine, FARPG_CompiledRoutine& OutRoutine);
+
+    /** (Re)register the hourly callback with the world calendar */
+    void RestartHourSchedule();
+
+    URadiantWorldManager* GetWorldManager() const;
+    int32 GetCurrentHour() const;
+
+private:
+    static constexpr int32 NumArchetypes = (int32)EARPG_NPCArchetype::MAX;
+
+    FARPG_CompiledRoutine Routines[NumArchetypes];
+
+    /** Brains following each archetype's routine */
+    TArray<TWeakObjectPtr<UARPG_AIBrainComponent>> Followers[NumArchetypes];
+
+    /** Hour the last transition pass ran for */
+    int32 LastHour = INDEX_NONE;
+
+    FCalendarEventHandle HourEventHandle;
+};
@@ -35,8 +35,6 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void Tick(float DeltaTime) override;
-
     // === IARPG_AIBrainInterface Implementation ===
     
     UFUNCTION(BlueprintCallable, Category = "AI")
@@ -99,6 +97,32 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NPC")
     FGameplayTag GetCurrentBehavior() const { return CurrentBehavior; }
 
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NPC")
+    EARPG_NPCArchetype GetArchetype() const { return Archetype; }
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NPC")
+    bool IsFollowingDailyRoutine() const { return bFollowDailyRoutine; }
+
+    /** Change archetype and start or stop following its routine */
+    UFUNCTION(BlueprintCallable, Category = "NPC")
+    void SetDailyRoutine(EARPG_NPCArchetype NewArchetype, bool bFollow);
+
+    // === Crowd ===
+
+    /** Park the NPC for the crowd manager's pool, or bring it back */
+    void SetCrowdPooled(bool bPooled);
+
+    /** Wipe everything tied to the NPC it last played - relationships, memories, stimuli, intent and health */
+    void ResetCrowdIdentity();
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NPC")
+    bool IsCrowdPooled() const { return bCrowdPooled; }
+
+    /** Proxy this actor is standing in for - invalid when it is not part of the crowd */
+    const FARPG_CrowdProxyHandle& GetCrowdHandle() const { return CrowdHandle; }
+
+    void SetCrowdHandle(const FARPG_CrowdProxyHandle& Handle) { CrowdHandle = Handle; }
+
     // === Component Access ===
 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Components")
@@ -155,6 +179,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     FGameplayTag Faction;
 
+    /** NPC archetype - selects the daily routine */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
+    EARPG_NPCArchetype Archetype = EARPG_NPCArchetype::Generic;
+
+    /** Follow the archetype's daily routine instead of running the brain continuously */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
+    bool bFollowDailyRoutine = false;
+
     /** Default brain configuration */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     FARPG_AIBrainConfiguration DefaultBrainConfig;
@@ -177,6 +209,16 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "State")
     bool bIsActive = true;
 
+    /** Parked in the crowd manager's pool */
+    UPROPERTY(BlueprintReadOnly, Category = "State")
+    bool bCrowdPooled = false;
+
+    /** Set by the crowd manager while promoted */
+    FARPG_CrowdProxyHandle CrowdHandle;
+
+    /** Components whose tick was paused when pooled */
+    TArray<TWeakObjectPtr<UActorComponent>> PooledTickComponents;
+
     // === Blueprint Events ===
 
     /** Called when NPC behavior changes */
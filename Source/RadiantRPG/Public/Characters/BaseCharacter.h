@@ -50,6 +50,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCharacterHealthChanged, float, N
  * - Data-driven configuration via DataTables and GameplayTags
  * - Clear separation of player-specific and NPC-specific logic
  * - Performance optimized for large numbers of NPCs
+ * - Actor tick disabled by default; subclasses opt in when they need it
  * 
  * Components are created in constructor based on character type:
  * - All characters: Health, basic needs
@@ -67,7 +68,6 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    virtual void Tick(float DeltaTime) override;
 
     // === CHARACTER CONFIGURATION ===
     
@@ -131,6 +131,7 @@ protected:
     FGameplayTag FactionTag;
 
     // === CACHED STATS (For performance) ===
+    // Maintained from component change delegates - never polled
     
     UPROPERTY(BlueprintReadOnly, Category = "Cached Stats")
     float CurrentHealth;
@@ -252,6 +253,9 @@ protected:
     /** Bind events for all existing components */
     virtual void BindAllComponentEvents();
 
+    /** Pull current values from components into the cached stats */
+    void RefreshCachedStats();
+
     // === COMPONENT EVENT HANDLERS ===
     
     UFUNCTION()
@@ -0,0 +1,121 @@
+// Public/Components/EquipmentComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Types/ItemTypes.h"
+#include "EquipmentComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnEquipmentStatChanged, ERadiantStatType, StatType, float, FlatBonus, float, PercentBonus);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEquipmentSlotChanged, EEquipmentSlot, Slot, FName, ItemID);
+
+/**
+ * Stat contribution of one equipped item, kept so unequip can subtract exactly what equip added
+ */
+struct FEquipmentStatContribution
+{
+    float Flat[(int32)ERadiantStatType::MAX];
+    float Percent[(int32)ERadiantStatType::MAX];
+
+    FEquipmentStatContribution()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        FMemory::Memzero(Flat);
+        FMemory::Memzero(Percent);
+    }
+
+    void AddBonus(const FItemStatBonus& Bonus)
+    {
+        const int32 StatIndex = (int32)Bonus.StatType;
+        if (StatIndex >= 0 && StatIndex < (int32)ERadiantStatType::MAX)
+        {
+            (Bonus.bIsPercentage ? Percent : Flat)[StatIndex] += Bonus.Value;
+        }
+    }
+};
+
+/**
+ * Equipped items and their aggregated stat bonuses
+ * Totals per ERadiantStatType are maintained incrementally on equip, unequip
+ * and durability change, so stat reads are a single array lookup.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class RADIANTRPG_API UEquipmentComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UEquipmentComponent();
+
+protected:
+    virtual void BeginPlay() override;
+
+    // Settings
+    /** FItemData rows used for item base stats */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Equipment")
+    TObjectPtr<UDataTable> ItemDataTable;
+
+    // Equipped items indexed by EEquipmentSlot
+    UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+    TArray<FItemInstance> EquippedItems;
+
+    // Cached contributions and totals
+    TArray<FEquipmentStatContribution> SlotContributions;
+    FEquipmentStatContribution Totals;
+
+public:
+    // Events
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnEquipmentStatChanged OnStatChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnEquipmentSlotChanged OnSlotChanged;
+
+    // Equipment
+    /**
+     * Put an item in a slot
+     * @param OutPrevious Item that was in the slot, if any
+     * @return True if a previous item was replaced
+     */
+    UFUNCTION(BlueprintCallable, Category = "Equipment")
+    bool EquipItem(EEquipmentSlot Slot, const FItemInstance& Item, FItemInstance& OutPrevious);
+
+    UFUNCTION(BlueprintCallable, Category = "Equipment")
+    bool UnequipItem(EEquipmentSlot Slot, FItemInstance& OutItem);
+
+    /** Update an equipped item's durability - broken items stop contributing stats */
+    UFUNCTION(BlueprintCallable, Category = "Equipment")
+    void SetItemDurability(EEquipmentSlot Slot, float NewDurability);
+
+    UFUNCTION(BlueprintPure, Category = "Equipment")
+    bool IsSlotOccupied(EEquipmentSlot Slot) const;
+
+    UFUNCTION(BlueprintPure, Category = "Equipment")
+    bool GetEquippedItem(EEquipmentSlot Slot, FItemInstance& OutItem) const;
+
+    // Stat totals
+    UFUNCTION(BlueprintPure, Category = "Equipment|Stats")
+    float GetFlatBonus(ERadiantStatType StatType) const;
+
+    /** Summed percentage bonus (10 = +10%) */
+    UFUNCTION(BlueprintPure, Category = "Equipment|Stats")
+    float GetPercentBonus(ERadiantStatType StatType) const;
+
+    /** (BaseValue + flat) * (1 + percent / 100) */
+    UFUNCTION(BlueprintPure, Category = "Equipment|Stats")
+    float ApplyStatBonus(ERadiantStatType StatType, float BaseValue) const;
+
+protected:
+    /** Sum base stats, affixes and bonus stats for an item */
+    void BuildContribution(const FItemInstance& Item, FEquipmentStatContribution& OutContribution) const;
+
+    /** Swap a slot's contribution for a new one, updating totals and notifying changed stats */
+    void ReplaceSlotContribution(int32 SlotIndex, const FEquipmentStatContribution& NewContribution);
+
+    static bool IsValidSlot(EEquipmentSlot Slot);
+};
@@ -0,0 +1,232 @@
+// Public/Components/InventoryComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Types/ItemTypes.h"
+#include "InventoryComponent.generated.h"
+
+class UInventoryComponent;
+struct FInventoryList;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryItemCountChanged, FName, ItemID, int32, NewCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryTotalsChanged, float, TotalWeight, int32, UsedSlots);
+
+/**
+ * One inventory slot - replicated individually by the fast array
+ */
+USTRUCT(BlueprintType)
+struct FInventoryEntry : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    /** Stable key for the slot, assigned by the server - array order differs between server and clients */
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    int32 SlotId = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    FItemInstance Item;
+
+    /** Quantity last folded into the owner's cached totals (local bookkeeping) */
+    UPROPERTY(NotReplicated)
+    int32 AccountedQuantity = 0;
+
+    /** Weight of a single unit, resolved from item data when the slot is first seen */
+    UPROPERTY(NotReplicated)
+    float UnitWeight = 0.0f;
+
+    // Fast array callbacks (client side)
+    void PreReplicatedRemove(const FInventoryList& InArraySerializer);
+    void PostReplicatedAdd(const FInventoryList& InArraySerializer);
+    void PostReplicatedChange(const FInventoryList& InArraySerializer);
+};
+
+/**
+ * Replicated slot list - only changed slots are sent over the wire
+ */
+USTRUCT(BlueprintType)
+struct FInventoryList : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    TArray<FInventoryEntry> Entries;
+
+    /** Component that owns this list, for cached totals and events */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UInventoryComponent> OwnerComponent = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryEntry, FInventoryList>(Entries, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryList> : public TStructOpsTypeTraitsBase2<FInventoryList>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/**
+ * Slot-based inventory with per-slot delta replication
+ * Weight, used slots and per-item counts are cached and updated incrementally
+ * on every change, on the server and on clients as slots replicate in.
+ * Slots are addressed by FInventoryEntry::SlotId, never by array index - the
+ * fast array does not keep the server's order on clients. UI should order
+ * slots with GetSlotIds so removals never shuffle the others.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class RADIANTRPG_API UInventoryComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UInventoryComponent();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    /** Set up an inventory created at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void ConfigureInventory(UDataTable* InItemDataTable, int32 InMaxSlots, float InMaxWeight);
+
+protected:
+    virtual void BeginPlay() override;
+
+    // Settings
+    /** FItemData rows used for stack sizes and weights */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    TObjectPtr<UDataTable> ItemDataTable;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory", meta = (ClampMin = "1"))
+    int32 MaxSlots;
+
+    /** Carry weight limit (0 = unlimited) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory", meta = (ClampMin = "0.0"))
+    float MaxWeight;
+
+    // Replicated state
+    UPROPERTY(Replicated)
+    FInventoryList InventoryList;
+
+    // Cached totals
+    float CachedTotalWeight;
+    TMap<FName, int32> CachedItemCounts;
+
+public:
+    // Events
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnInventoryItemCountChanged OnItemCountChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnInventoryTotalsChanged OnTotalsChanged;
+
+    // Mutation (server only)
+    /**
+     * Add items, topping up existing stacks before opening new slots
+     * @return Quantity that did not fit
+     */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 AddItem(const FItemInstance& Item);
+
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 AddItemStack(const FItemStack& Stack);
+
+    /** Add many stacks at once (looting a container or a batch of drops) */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void AddItemStacks(const TArray<FItemStack>& Stacks, TArray<FItemStack>& OutLeftovers);
+
+    /** Remove up to Quantity of an item across all stacks. Returns the amount removed */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 RemoveItem(FName ItemID, int32 Quantity);
+
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 RemoveFromSlot(int32 SlotId, int32 Quantity);
+
+    /** Move Amount from a slot into a new slot. Returns the new slot's id, or INDEX_NONE */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 SplitStack(int32 SlotId, int32 Amount);
+
+    /** Move as much of FromSlotId into ToSlotId as the stack size allows */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    bool MergeStacks(int32 FromSlotId, int32 ToSlotId);
+
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void ClearInventory();
+
+    // Queries
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    int32 GetItemCount(FName ItemID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    bool HasItem(FName ItemID, int32 Quantity = 1) const { return GetItemCount(ItemID) >= Quantity; }
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    float GetTotalWeight() const { return CachedTotalWeight; }
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    float GetMaxWeight() const { return MaxWeight; }
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    int32 GetUsedSlots() const { return InventoryList.Entries.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    int32 GetMaxSlots() const { return MaxSlots; }
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    bool GetSlot(int32 SlotId, FItemInstance& OutItem) const;
+
+    /** Every slot id in creation order - stable display order on server and clients */
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    TArray<int32> GetSlotIds() const;
+
+    const TArray<FInventoryEntry>& GetEntries() const { return InventoryList.Entries; }
+
+    /** Per-item totals across all stacks */
+    const TMap<FName, int32>& GetItemCounts() const { return CachedItemCounts; }
+
+    // Replication bookkeeping - called by FInventoryEntry callbacks and server mutations
+    void AccountEntry(FInventoryEntry& Entry);
+    void UnaccountEntry(FInventoryEntry& Entry);
+
+    /** Replicated adds and removes move entries around - rebuild the slot lookup on next use */
+    void MarkSlotIndicesDirty() { bSlotIndicesDirty = true; }
+
+protected:
+    bool HasInventoryAuthority() const;
+
+    int32 GetMaxStackSize(FName ItemID) const;
+    float GetUnitWeight(FName ItemID) const;
+
+    /** Units of the item that still fit under the weight limit */
+    int32 GetWeightCapacityFor(FName ItemID) const;
+
+    int32 AddItemInternal(const FItemInstance& Item);
+    int32 AddSlotInternal(FInventoryEntry&& NewEntry);
+    int32 RemoveFromSlotIndex(int32 SlotIndex, int32 Quantity);
+    void RemoveSlotInternal(int32 SlotIndex);
+    void MarkSlotDirty(int32 SlotIndex);
+
+    /** Array index of a slot id, or INDEX_NONE */
+    int32 FindSlotIndex(int32 SlotId) const;
+
+    void ApplyItemCountDelta(FName ItemID, int32 Delta);
+    void BroadcastTotals();
+    void EndBatch();
+
+    /** Suppresses per-change total broadcasts during batched operations */
+    int32 BatchDepth;
+    bool bTotalsDirty;
+
+    /** Next id handed out by the server */
+    int32 NextSlotId;
+
+    /** Slot id to array index - kept exact on the server, rebuilt lazily on clients */
+    mutable TMap<int32, int32> SlotIndices;
+    mutable bool bSlotIndicesDirty;
+};
@@ -39,6 +39,7 @@ public:
     // === COMPONENT OVERRIDES ===
     
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     void InitializeDefaultSkills();
@@ -46,9 +47,19 @@ public:
 protected:
     // === SKILL DATA ===
     
-    /** Legacy skill data map */
-    UPROPERTY(BlueprintReadOnly, Category = "Skills")
-    TMap<ESkillType, FSkillData> Skills;
+    /** Legacy skill data, indexed by ESkillType */
+    UPROPERTY(ReplicatedUsing = OnRep_Skills, BlueprintReadOnly, Category = "Skills")
+    TArray<FSkillData> Skills;
+
+    /** Whether each ESkillType slot holds a skill this character has */
+    UPROPERTY(ReplicatedUsing = OnRep_Skills)
+    TArray<bool> KnownSkills;
+
+    /** Known skills ordered by CurrentValue, highest first - kept sorted as levels change */
+    TArray<ESkillType> SkillRanking;
+
+    /** Position of each skill in SkillRanking (INDEX_NONE if unknown) */
+    TArray<int32> SkillRankPositions;
 
     // === CONFIGURATION ===
     
@@ -68,6 +79,34 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     bool bEnforceSkillCaps;
 
+    /** Seconds to accumulate experience before applying it (0 = once per frame) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration", meta = (ClampMin = "0.0"))
+    float ExperienceBatchWindow;
+
+    /** Synergies that boost a skill's experience gain once a secondary skill is high enough */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
+    TArray<FSkillSynergy> SkillSynergies;
+
+    // === SYNERGY CACHE ===
+
+    FSkillSynergyGraph SynergyGraph;
+
+    /** Which graph edges are currently active */
+    TBitArray<> ActiveSynergyEdges;
+
+    /** Summed active synergy bonus per ESkillType */
+    TArray<float> SynergyBonuses;
+
+    // === PENDING EXPERIENCE ===
+
+    /** Experience granted since the last flush, indexed by ESkillType */
+    TArray<float> PendingExperience;
+
+    /** Skills with pending experience, in grant order */
+    TArray<ESkillType> PendingSkills;
+
+    FTimerHandle ExperienceFlushHandle;
+
     // === CACHED VALUES ===
     
     /** Current total skill points used */
@@ -92,10 +131,14 @@ public:
 
     // === SKILL INTERFACE ===
     
-    /** Gain experience in a skill */
+    /** Gain experience in a skill - accumulated and applied with other grants at the end of the batch window */
     UFUNCTION(BlueprintCallable, Category = "Skills")
     void GainSkillExperience(ESkillType SkillType, float ExperienceAmount);
-    void CalculateLevelFromExperience(FSkillData& SkillData);
+
+    /** Apply all accumulated experience now */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    void FlushSkillExperience();
+    void CalculateLevelFromExperience(FSkillData& SkillData) const;
 
     /** Set skill value directly */
     UFUNCTION(BlueprintCallable, Category = "Skills")
@@ -115,6 +158,9 @@ public:
 
     // === GETTERS ===
     
+    // Value, experience and progress getters include experience still waiting for the batch flush,
+    // so they agree with each other inside a batch window
+
     /** Get base skill value */
     UFUNCTION(BlueprintPure, Category = "Skills")
     float GetSkillValue(ESkillType SkillType) const;
@@ -123,7 +169,7 @@ public:
     UFUNCTION(BlueprintPure, Category = "Skills")
     float GetEffectiveSkillValue(ESkillType SkillType) const;
 
-    /** Get skill experience */
+    /** Get skill experience, including experience still waiting for the batch flush */
     UFUNCTION(BlueprintPure, Category = "Skills")
     float GetSkillExperience(ESkillType SkillType) const;
     float GetSkillProgress(ESkillType SkillType) const;
@@ -144,11 +190,22 @@ public:
     UFUNCTION(BlueprintPure, Category = "Skills")
     bool IsAtSkillCap() const;
 
-    /** Get highest skills */
+    /** Get highest skills - a prefix of the cached ranking */
     UFUNCTION(BlueprintPure, Category = "Skills")
     TArray<ESkillType> GetHighestSkills(int32 Count = 5) const;
 
-    /** Get skill data structure */
+    /** Known skills ordered highest first */
+    const TArray<ESkillType>& GetSkillRanking() const { return SkillRanking; }
+
+    /** Active synergy bonus for a skill (0.1 = +10% experience) */
+    UFUNCTION(BlueprintPure, Category = "Skills")
+    float GetSynergyBonus(ESkillType SkillType) const;
+
+    /** Replace the synergy definitions and recompute bonuses */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    void SetSkillSynergies(const TArray<FSkillSynergy>& NewSynergies);
+
+    /** Get skill data structure as it will be after the pending batch is applied */
     UFUNCTION(BlueprintPure, Category = "Skills")
     FSkillData GetSkillData(ESkillType SkillType) const;
 
@@ -180,6 +237,45 @@ public:
 protected:
     // === INTERNAL FUNCTIONS ===
     
+    /** Skill data if the character has the skill */
+    FSkillData* FindSkill(ESkillType SkillType);
+    const FSkillData* FindSkill(ESkillType SkillType) const;
+
+    /** Size the dense arrays and clear all skills */
+    void ResetSkillStorage();
+
+    /** Add or overwrite a skill */
+    void SetKnownSkill(ESkillType SkillType, const FSkillData& SkillData);
+
+    /** Move a skill to its new place in the ranking after its value changed */
+    void UpdateSkillRank(ESkillType SkillType);
+
+    /** Rebuild the ranking from scratch (initialization and replication) */
+    void RebuildSkillRanking();
+
+    /** Ranking order: higher value first, ties by skill type */
+    bool RanksAbove(ESkillType A, ESkillType B) const;
+
+    /** Re-check only the synergies whose secondary skill is SkillType */
+    void RefreshSynergiesFrom(ESkillType SkillType);
+
+    /** Recompute every synergy (after initialization, replication or a definition change) */
+    void RebuildSynergyBonuses();
+
+    /** Apply one skill's accumulated experience. Returns true if its level changed */
+    bool ApplySkillExperience(ESkillType SkillType, float ExperienceAmount);
+
+    void ScheduleExperienceFlush();
+
+    /** Pending experience for a skill, scaled the way ApplySkillExperience will scale it */
+    float GetPendingSkillExperience(ESkillType SkillType) const;
+
+    /** Copy of SkillData with the pending batch applied and its level recomputed */
+    FSkillData GetProjectedSkillData(ESkillType SkillType, const FSkillData& SkillData) const;
+
+    /** Skill value changed - update the ranking and dependent synergies */
+    void HandleSkillValueChanged(ESkillType SkillType);
+
     /** Update total skill points */
     void UpdateTotalSkillPoints();
 
@@ -12,6 +12,7 @@
 class UInputMappingContext;
 class UInputAction;
 class URadiantHUD;
+class UWorldEventFeedComponent;
 class APlayerCharacter;
 
 UENUM(BlueprintType)
@@ -106,6 +107,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input")
     void ClearAllInputMappingContexts();
 
+    // === WORLD EVENTS ===
+    
+    /** Relevant world events for this player's connection */
+    UFUNCTION(BlueprintPure, Category = "World Events")
+    UWorldEventFeedComponent* GetWorldEventFeed() const { return WorldEventFeed; }
+
     // === HUD INTERFACE ===
     
     /** Get current HUD widget */
@@ -237,6 +244,10 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "UI")
     URadiantHUD* HUDWidget;
 
+    /** Per-connection world event feed */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Events")
+    UWorldEventFeedComponent* WorldEventFeed;
+
     // === INPUT SETTINGS ===
     
     /** Current input mode */
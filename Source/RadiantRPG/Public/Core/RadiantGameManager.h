@@ -312,6 +312,9 @@ protected:
     /** Perform automatic save */
     void PerformAutoSave();
 
+    /** Apply batched skill experience on every character before its state is gathered for a save */
+    void FlushPendingSkillExperience();
+
     /** Check system health by name */
     bool IsSystemHealthy(const FString& SystemName) const;
 
@@ -10,12 +10,14 @@
 #include "Types/TimeTypes.h"
 #include "Net/UnrealNetwork.h"
 #include "Types/GlobalVariablesTypes.h"
+#include "Types/FactionTypes.h"
 #include "RadiantGameState.generated.h"
 
 // Forward declarations
 class URadiantGameManager;
 class URadiantWorldManager;
 class ARadiantPlayerState;
+class UFactionRegistry;
 
 /**
  * RadiantGameState - Replicated world state manager for RadiantRPG
@@ -61,8 +63,8 @@ protected:
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "World Time")
     bool bTimeProgressionEnabled;
 
-    /** Active world events (replicated) */
-    UPROPERTY(Replicated, BlueprintReadOnly, Category = "World Events", ReplicatedUsing = OnRep_ActiveWorldEvents)
+    /** Active world events (server only - clients receive the relevant ones through UWorldEventFeedComponent) */
+    UPROPERTY(BlueprintReadOnly, Category = "World Events")
     TArray<FWorldEventData> ActiveWorldEvents;
 
     /** Global gameplay flags (replicated) */
@@ -73,6 +75,10 @@ protected:
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "Factions", ReplicatedUsing = OnRep_ActiveWars)
     TArray<FGameplayTag> ActiveWars;
 
+    /** Registered faction pairs at war or allied, mirrored from the server's registry into each client's */
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Factions", ReplicatedUsing = OnRep_FactionStandings)
+    TArray<FFactionPairStanding> FactionStandings;
+
     /** Global numeric variables (replicated) */
     UPROPERTY(Replicated, BlueprintReadOnly, Category = "Global State")
     FGlobalVariablesContainer GlobalVariables;
@@ -87,6 +93,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World Events")
     int32 MaxConcurrentEvents;
 
+    /** Factions loaded into UFactionRegistry when play begins - sent once so clients register the same set */
+    UPROPERTY(EditAnywhere, Replicated, BlueprintReadOnly, Category = "Factions")
+    TArray<FFactionData> FactionDefinitions;
+
     // === CACHED REFERENCES ===
     
     /** Cached reference to game manager */
@@ -196,7 +206,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "World Events")
     bool RemoveWorldEvent(int32 EventID);
 
-    /** Get active world events */
+    /**
+     * Get active world events
+     * Server only - the list is no longer replicated, so on clients this is always empty.
+     * Clients read their relevant events from UWorldEventFeedComponent::GetRelevantWorldEvents.
+     */
     UFUNCTION(BlueprintPure, Category = "World Events")
     TArray<FWorldEventData> GetActiveWorldEvents() const { return ActiveWorldEvents; }
 
@@ -270,6 +284,24 @@ protected:
     /** Initialize world state on authority */
     void InitializeWorldState();
 
+    /**
+     * Load FactionDefinitions into the faction registry. The server mirrors authored wars into
+     * ActiveWars and publishes FactionStandings; clients apply FactionStandings on top, so faction
+     * queries answer from the registry on both sides
+     */
+    void RegisterFactions();
+
+    /** Rebuild FactionStandings from the registry (authority) */
+    void RefreshFactionStandings();
+
+    /** Set the registry's wars and alliances to match FactionStandings (clients) */
+    void ApplyFactionStandings();
+
+    UFUNCTION()
+    void HandleRegistryFactionEvent(const FFactionEvent& Event);
+
+    UFactionRegistry* GetFactionRegistry() const;
+
     /** Update world state (called on authority) */
     void UpdateWorldState(float DeltaTime);
 
@@ -287,15 +319,15 @@ protected:
     UFUNCTION()
     void OnRep_WorldTime();
 
-    UFUNCTION()
-    void OnRep_ActiveWorldEvents();
-
     UFUNCTION()
     void OnRep_GlobalFlags();
 
     UFUNCTION()
     void OnRep_ActiveWars();
 
+    UFUNCTION()
+    void OnRep_FactionStandings();
+
     // === SERVER RPC IMPLEMENTATIONS ===
     
     UFUNCTION(Server, Reliable)
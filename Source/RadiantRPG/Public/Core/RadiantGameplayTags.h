@@ -65,6 +65,19 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Faction_Wildlife);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Faction_Hostile);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Faction_Player);
 
+// === FACTION EVENT TAGS ===
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_WarDeclared);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_PeaceMade);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_AllianceFormed);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_AllianceBroken);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_TradeOpened);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_TradeClosed);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_RelationshipChanged);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_TerritoryChanged);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_MemberJoined);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_FactionEvent_MemberLeft);
+
 // === AI INTENT TAGS ===
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent);
@@ -74,6 +87,7 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Idle);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Wander);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Patrol);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Guard);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Work);
 
 // Survival Intents
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Intent_Survival);
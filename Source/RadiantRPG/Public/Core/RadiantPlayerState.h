@@ -159,6 +159,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     float ExperienceMultiplier;
 
+    /** Seconds to accumulate skill experience before applying it (0 = once per frame) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration", meta = (ClampMin = "0.0"))
+    float ExperienceBatchWindow;
+
     /** Primary skills that contribute more to character level */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     TArray<FGameplayTag> PrimarySkills;
@@ -187,6 +191,11 @@ protected:
     /** Last position for distance tracking */
     FVector LastPosition;
 
+    /** Experience granted since the last flush, per skill */
+    TMap<FGameplayTag, float> PendingSkillExperience;
+
+    FTimerHandle SkillExperienceFlushHandle;
+
 public:
     // === EVENTS ===
     
@@ -216,6 +225,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Skills")
     void AddSkillExperience(FGameplayTag SkillTag, float ExperienceAmount);
 
+    /** Apply all accumulated experience now - one level evaluation and replication update per skill */
+    UFUNCTION(BlueprintCallable, Category = "Skills")
+    void FlushSkillExperience();
+
     /** Set skill value directly (admin/cheat function) */
     UFUNCTION(BlueprintCallable, Category = "Skills")
     void SetSkillValue(FGameplayTag SkillTag, float NewValue);
@@ -268,8 +281,10 @@ protected:
     /** Update cached values when skills change */
     void UpdateCachedValues();
 
-    /** Apply skill experience with proper calculations */
-    void ApplySkillExperience(FGameplayTag SkillTag, float ExperienceAmount);
+    /** Apply skill experience to the cache and replicated entry. Returns the old value */
+    float ApplySkillExperience(FGameplayTag SkillTag, float ExperienceAmount);
+
+    void ScheduleSkillExperienceFlush();
 
     /** Grant default abilities to player */
     void GrantDefaultAbilities();
@@ -289,6 +304,9 @@ protected:
 
     /** Update replicated arrays from cache */
     void UpdateReplicatedSkillEntries();
+
+    /** Write one skill through to the replicated array in place */
+    void UpdateReplicatedSkillEntry(FGameplayTag SkillTag, const FSkillData& SkillData);
     void UpdateReplicatedFactionEntries();
 
     // === REPLICATION CALLBACKS ===
@@ -0,0 +1,115 @@
+// Public/Core/RadiantReplicationGraph.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "RadiantReplicationGraph.generated.h"
+
+class ARadiantZoneManager;
+
+/**
+ * How an actor class is routed through the graph
+ */
+UENUM()
+enum class ERadiantClassRepNodeMapping : uint8
+{
+    /** Handled by a connection node or not replicated through the graph */
+    NotRouted,
+
+    /** Sent to every connection */
+    RelevantAllConnections,
+
+    /** Grid - never moves */
+    Spatialize_Static,
+
+    /** Grid - re-placed every frame */
+    Spatialize_Dynamic,
+
+    /** Grid - static while dormant, dynamic while awake */
+    Spatialize_Dormancy,
+
+    /** Sent to connections whose viewer is inside the zone */
+    ZoneForConnection
+};
+
+/**
+ * Per-connection node - the connection's own controller, pawn and view target,
+ * plus every zone actor its viewers currently stand in
+ */
+UCLASS()
+class RADIANTRPG_API URadiantReplicationGraphNode_ZoneForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+    GENERATED_BODY()
+
+public:
+    virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+    FActorRepListRefView ZoneActorList;
+};
+
+/**
+ * RadiantRPG replication graph
+ *
+ * NPCs and interactables go into a 2D grid, so each connection only gathers
+ * actors in the cells around its viewers instead of every actor in the world.
+ * Game state and other always-relevant actors share one global list, player
+ * states are frequency limited, and zone actors only reach connections whose
+ * viewers are inside them.
+ */
+UCLASS(Transient, config = Engine)
+class RADIANTRPG_API URadiantReplicationGraph : public UReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    // UReplicationGraph interface
+    virtual void ResetGameWorldState() override;
+    virtual void InitGlobalActorClassSettings() override;
+    virtual void InitGlobalGraphNodes() override;
+    virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+    /** Push a runtime net update frequency change into the graph's per-actor settings */
+    void SetActorNetUpdateFrequency(AActor* Actor, float Frequency);
+
+    /** Replicated zone actors, for the per-connection zone nodes */
+    const TArray<TWeakObjectPtr<ARadiantZoneManager>>& GetZoneActors() const { return ZoneActors; }
+
+    /** Spatial grid holding NPCs, interactables and other spatialized actors */
+    UReplicationGraphNode_GridSpatialization2D* GetGridNode() const { return GridNode; }
+
+    /** Route for a replicated class, resolved in InitGlobalActorClassSettings */
+    ERadiantClassRepNodeMapping GetMappingPolicy(const UClass* Class) const;
+
+    /** Side length of a grid cell */
+    UPROPERTY(Config)
+    float GridCellSize = 10000.0f;
+
+    /** World offset so every actor lands in a positive cell */
+    UPROPERTY(Config)
+    FVector2D GridSpatialBias = FVector2D(-200000.0f, -200000.0f);
+
+    /** Player states replicated to each connection per frame */
+    UPROPERTY(Config)
+    int32 PlayerStatesPerFrame = 2;
+
+protected:
+    bool IsSpatialized(ERadiantClassRepNodeMapping Mapping) const { return Mapping >= ERadiantClassRepNodeMapping::Spatialize_Static && Mapping <= ERadiantClassRepNodeMapping::Spatialize_Dormancy; }
+
+    void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const;
+
+private:
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+    UPROPERTY()
+    TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+    /** Resolved routing per replicated class */
+    TClassMap<ERadiantClassRepNodeMapping> ClassRepNodePolicies;
+
+    TArray<TWeakObjectPtr<ARadiantZoneManager>> ZoneActors;
+};
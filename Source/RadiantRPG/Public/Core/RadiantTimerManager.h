@@ -0,0 +1,208 @@
+// Public/Core/RadiantTimerManager.h
+// Hierarchical timer wheel for coarse-grained gameplay timers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RadiantTimerManager.generated.h"
+
+/**
+ * Handle to a timer on the timer wheel
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FRadiantTimerHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Index = INDEX_NONE;
+
+    /** Matches the timer slot's serial while the timer is alive */
+    UPROPERTY()
+    int32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; }
+};
+
+/**
+ * Timer wheel metrics
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FRadiantTimerStats
+{
+    GENERATED_BODY()
+
+    /** Timers currently scheduled */
+    UPROPERTY(BlueprintReadOnly, Category = "Timers")
+    int32 ActiveTimers = 0;
+
+    /** Callbacks fired during the last frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Timers")
+    int32 CallbacksLastFrame = 0;
+
+    /** Timers moved down from coarser levels during the last frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Timers")
+    int32 CascadedLastFrame = 0;
+
+    /** Most callbacks fired in a single frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Timers")
+    int32 PeakCallbacksPerFrame = 0;
+
+    /** Most timers scheduled at once */
+    UPROPERTY(BlueprintReadOnly, Category = "Timers")
+    int32 PeakActiveTimers = 0;
+};
+
+DECLARE_DELEGATE(FRadiantTimerDelegate);
+
+/**
+ * Hierarchical timer wheel
+ *
+ * Time advances in fixed ticks. Each level holds 64 slots of intrusive lists.
+ * Level 0 slots are single ticks, and each level above is 64 times coarser.
+ * Insert and cancel are O(1) list operations. Advancing one tick fires one
+ * level 0 slot. At each block boundary, the next slot of the coarser levels
+ * is moved down.
+ */
+class RADIANTRPG_API FRadiantTimerWheel
+{
+public:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 NumLevels = 4;
+
+    /** Longest delay the wheel can hold - ~19 days at the default tick */
+    static constexpr uint64 MaxDelayTicks = (uint64)(SlotsPerLevel - 1) << (SlotBits * (NumLevels - 1));
+
+    explicit FRadiantTimerWheel(float InTickSeconds = 0.1f);
+
+    /**
+     * Schedule a callback
+     * @param Rate Seconds between calls, rounded up to whole ticks
+     * @param FirstDelay Delay before the first call (negative = Rate)
+     */
+    FRadiantTimerHandle SetTimer(FRadiantTimerDelegate Callback, float Rate, bool bLoop, float FirstDelay = -1.0f);
+
+    void ClearTimer(FRadiantTimerHandle& Handle);
+
+    bool IsTimerActive(const FRadiantTimerHandle& Handle) const;
+
+    /** Seconds until the timer next fires, or -1 if it is not active */
+    float GetTimerRemaining(const FRadiantTimerHandle& Handle) const;
+
+    /** Advance the clock, firing every timer that comes due */
+    void Advance(float DeltaSeconds);
+
+    /** Drop every timer */
+    void Reset();
+
+    float GetTickSeconds() const { return TickSeconds; }
+    int32 GetNumTimers() const { return NumActive; }
+
+    /** Callbacks fired and timers cascaded during the last Advance */
+    int32 GetCallbacksLastAdvance() const { return CallbacksLastAdvance; }
+    int32 GetCascadedLastAdvance() const { return CascadedLastAdvance; }
+
+private:
+    struct FTimer
+    {
+        FRadiantTimerDelegate Callback;
+        uint64 ExpiryTick = 0;
+
+        /** Zero for one-shot timers */
+        uint64 PeriodTicks = 0;
+
+        int32 Serial = 0;
+
+        /** Flat slot index (Level * SlotsPerLevel + Slot), INDEX_NONE when not scheduled */
+        int32 SlotIndex = INDEX_NONE;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+    };
+
+    void AdvanceTick();
+
+    /** Re-place every timer in a coarse slot now that its block has arrived */
+    void Cascade(int32 Level, int32 Slot);
+
+    /** Insert into the slot matching the timer's expiry */
+    void Link(int32 Index);
+    void Unlink(int32 Index);
+
+    int32 Allocate();
+    void Release(int32 Index);
+
+    const FTimer* FindTimer(const FRadiantTimerHandle& Handle) const;
+
+    uint64 ToTicks(float Seconds) const;
+
+    /** Timer pool - free entries are chained through FreeList */
+    TArray<FTimer> Timers;
+    TArray<int32> FreeList;
+
+    /** List head per slot */
+    int32 SlotHeads[NumLevels * SlotsPerLevel];
+
+    float TickSeconds;
+    float Accumulator = 0.0f;
+    uint64 CurrentTick = 0;
+
+    int32 NumActive = 0;
+    int32 CallbacksLastAdvance = 0;
+    int32 CascadedLastAdvance = 0;
+};
+
+/**
+ * Radiant Timer Manager - World Subsystem
+ *
+ * Shared timer wheel for high-count periodic gameplay timers such as per-NPC
+ * curiosity checks, listener memory updates and zone upkeep. It replaces one
+ * FTimerManager heap entry per instance. Use FTimerManager when precise
+ * timing matters.
+ */
+UCLASS()
+class RADIANTRPG_API URadiantTimerManager : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Timers
+    FRadiantTimerHandle SetTimer(FRadiantTimerDelegate Callback, float Rate, bool bLoop, float FirstDelay = -1.0f)
+    {
+        return Wheel.SetTimer(MoveTemp(Callback), Rate, bLoop, FirstDelay);
+    }
+
+    template<class UserClass>
+    FRadiantTimerHandle SetTimer(UserClass* Object, typename FRadiantTimerDelegate::template TMethodPtr<UserClass> Method, float Rate, bool bLoop, float FirstDelay = -1.0f)
+    {
+        return Wheel.SetTimer(FRadiantTimerDelegate::CreateUObject(Object, Method), Rate, bLoop, FirstDelay);
+    }
+
+    void ClearTimer(FRadiantTimerHandle& Handle) { Wheel.ClearTimer(Handle); }
+
+    bool IsTimerActive(const FRadiantTimerHandle& Handle) const { return Wheel.IsTimerActive(Handle); }
+
+    float GetTimerRemaining(const FRadiantTimerHandle& Handle) const { return Wheel.GetTimerRemaining(Handle); }
+
+    // Metrics
+    UFUNCTION(BlueprintPure, Category = "Timers")
+    FRadiantTimerStats GetTimerStats() const { return Stats; }
+
+    UFUNCTION(BlueprintCallable, Category = "Timers")
+    void ResetPeakStats();
+
+private:
+    FRadiantTimerWheel Wheel;
+
+    FRadiantTimerStats Stats;
+};
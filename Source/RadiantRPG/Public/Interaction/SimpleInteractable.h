@@ -74,13 +74,13 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
     FInteractionData InteractionData;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Interaction")
     bool bIsCurrentlyInteractable;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
     int32 MaxUseCount;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Interaction")
     int32 CurrentUseCount;
 
     // Visual feedback settings
@@ -123,6 +123,8 @@ protected:
     bool bHasStoredOriginalMaterials;
 
 public:
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
     // IInteractableInterface implementation
     virtual bool OnInteract_Implementation(class ABaseCharacter* InteractingCharacter, const FVector& InteractionPoint, const FVector& InteractionNormal) override;
     virtual void OnInteractionFocusGained_Implementation(class ABaseCharacter* InteractingCharacter) override;
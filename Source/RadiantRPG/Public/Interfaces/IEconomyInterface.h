@@ -38,11 +38,11 @@ public:
 
     // === TRANSACTIONS ===
     
-    /** Execute buy transaction */
+    /** Execute buy transaction at the posted price - stock moves when the market next clears */
     UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Economy")
     bool BuyGoods(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost);
 
-    /** Execute sell transaction */
+    /** Execute sell transaction at the posted price - stock moves when the market next clears */
     UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Economy")
     bool SellGoods(const FName& GoodsID, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue);
 
@@ -60,6 +60,19 @@ public:
     UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Economy")
     FZoneEconomicData GetZoneEconomicData(const FGameplayTag& ZoneTag) const;
 
+    // === GOODS INDEX FAST PATHS ===
+
+    /** Compact index for a goods name, INDEX_NONE if unknown - stable until the economy is reinitialized */
+    virtual int32 ResolveGoodsIndex(const FName& GoodsID) const = 0;
+
+    virtual FName GetGoodsName(int32 GoodsIndex) const = 0;
+
+    virtual int32 GetGoodsPriceByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const = 0;
+    virtual bool AreGoodsAvailableByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag, int32 Quantity = 1) const = 0;
+    virtual bool BuyGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost) = 0;
+    virtual bool SellGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue) = 0;
+    virtual FMarketData GetMarketDataByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const = 0;
+
     // === EVENTS ===
     
     /** Called when market prices change significantly */
@@ -0,0 +1,167 @@
+// Public/Managers/CraftingManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Types/ItemTypes.h"
+#include "CraftingManager.generated.h"
+
+class UCraftingManager;
+class UInventoryComponent;
+class USkillsComponent;
+
+/**
+ * Reference from an ingredient to one recipe that consumes it
+ */
+struct FRecipeIngredientRef
+{
+    int32 RecipeIndex = INDEX_NONE;
+
+    /** Index into the flattened ingredient-line array (one line per distinct item per recipe) */
+    int32 LineIndex = INDEX_NONE;
+
+    int32 RequiredQuantity = 0;
+};
+
+/**
+ * Per-inventory craftability state, updated from the inventory's item count changes
+ * Each change only touches the recipes that use the changed item.
+ */
+UCLASS()
+class RADIANTRPG_API UCraftabilityTracker : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void Initialize(UCraftingManager* InManager, UInventoryComponent* InInventory);
+    void Shutdown();
+
+    /** Re-evaluate every recipe against the inventory - used on bind and after the recipe index changes */
+    void RebuildAll();
+
+    /** True if the inventory holds every ingredient (skill and station are not checked) */
+    bool HasIngredientsFor(int32 RecipeIndex) const;
+
+    UInventoryComponent* GetInventory() const { return Inventory.Get(); }
+
+protected:
+    UFUNCTION()
+    void HandleItemCountChanged(FName ItemID, int32 NewCount);
+
+    void SetLineSatisfied(int32 RecipeIndex, int32 LineIndex, bool bSatisfied);
+
+private:
+    UPROPERTY()
+    TObjectPtr<UCraftingManager> Manager;
+
+    TWeakObjectPtr<UInventoryComponent> Inventory;
+
+    /** Satisfied flag per flattened ingredient line */
+    TBitArray<> SatisfiedLines;
+
+    /** Unsatisfied ingredient lines per recipe - zero means all ingredients are present */
+    TArray<int32> MissingLineCounts;
+};
+
+/**
+ * Crafting Manager Subsystem
+ * Indexes FCraftingRecipe rows by station, ingredient and output, and keeps
+ * craftability per inventory up to date incrementally so crafting menus don't
+ * scan every recipe.
+ */
+UCLASS(BlueprintType)
+class RADIANTRPG_API UCraftingManager : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // === SUBSYSTEM LIFECYCLE ===
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // === CONFIGURATION ===
+
+    /** Build the recipe index from FCraftingRecipe rows */
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    void InitializeRecipes(UDataTable* RecipeDataTable);
+
+    // === INDEX QUERIES ===
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    int32 GetNumRecipes() const { return Recipes.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    bool GetRecipe(FName RecipeID, FCraftingRecipe& OutRecipe) const;
+
+    /** Recipes made at a station (an invalid tag returns recipes that need no station) */
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    TArray<FName> GetRecipesForStation(FGameplayTag Station) const;
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    TArray<FName> GetRecipesUsingIngredient(FName ItemID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    TArray<FName> GetRecipesProducing(FName ItemID) const;
+
+    // === CRAFTABILITY ===
+
+    /** Start tracking an inventory. Safe to call repeatedly */
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    void TrackInventory(UInventoryComponent* Inventory);
+
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    void UntrackInventory(UInventoryComponent* Inventory);
+
+    /**
+     * Recipes the inventory can craft right now at the given station
+     * @param Skills Optional - when set, recipe skill requirements are checked too
+     */
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    TArray<FName> GetCraftableRecipes(UInventoryComponent* Inventory, FGameplayTag Station, USkillsComponent* Skills = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    bool CanCraft(UInventoryComponent* Inventory, FName RecipeID, USkillsComponent* Skills = nullptr);
+
+    // Index access for trackers
+    int32 GetNumIngredientLines() const { return NumIngredientLines; }
+    const TArray<FRecipeIngredientRef>* FindIngredientRefs(FName ItemID) const { return IngredientIndex.Find(ItemID); }
+    int32 GetRecipeLineCount(int32 RecipeIndex) const { return RecipeLineCounts[RecipeIndex]; }
+
+protected:
+    void ResetIndex();
+    void AddRecipe(const FCraftingRecipe& Recipe);
+
+    /** Tracker for the inventory, created on demand */
+    UCraftabilityTracker* GetTracker(UInventoryComponent* Inventory);
+
+    bool MeetsSkillRequirement(int32 RecipeIndex, const USkillsComponent* Skills) const;
+
+    void AppendRecipeIDs(const TArray<int32>* Indices, TArray<FName>& OutIDs) const;
+
+private:
+    TArray<FCraftingRecipe> Recipes;
+
+    /** Recipe ID -> index */
+    TMap<FName, int32> RecipeLookup;
+
+    /** Station tag -> recipe indices */
+    TMap<FGameplayTag, TArray<int32>> StationIndex;
+
+    /** Ingredient item ID -> recipes consuming it, with aggregated quantities */
+    TMap<FName, TArray<FRecipeIngredientRef>> IngredientIndex;
+
+    /** Output item ID -> recipe indices */
+    TMap<FName, TArray<int32>> OutputIndex;
+
+    /** Distinct ingredient lines per recipe */
+    TArray<int32> RecipeLineCounts;
+
+    int32 NumIngredientLines = 0;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UCraftabilityTracker>> Trackers;
+};
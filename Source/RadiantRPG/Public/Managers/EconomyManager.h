@@ -34,6 +34,14 @@ struct FEconomySimulationConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "0.01", ClampMax = "0.5"))
     float MaxPriceChangeRate = 0.1f;
 
+    /** Residents each NPC or crowd proxy in a zone stands for - most of the population is never simulated */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "0.1"))
+    float PopulationPerNPC = 5.0f;
+
+    /** Cap on how far a crowded zone can push production and consumption above its base rates */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "1.0"))
+    float MaxPopulationScale = 2.0f;
+
     /** Enable debug logging */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
     bool bEnableDebugLogging = false;
@@ -110,6 +118,14 @@ public:
     FZoneEconomicData GetZoneEconomicData(const FGameplayTag& ZoneTag) const;
     virtual FZoneEconomicData GetZoneEconomicData_Implementation(const FGameplayTag& ZoneTag) const;
 
+    virtual int32 ResolveGoodsIndex(const FName& GoodsID) const override;
+    virtual FName GetGoodsName(int32 GoodsIndex) const override;
+    virtual int32 GetGoodsPriceByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const override;
+    virtual bool AreGoodsAvailableByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag, int32 Quantity = 1) const override;
+    virtual bool BuyGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalCost) override;
+    virtual bool SellGoodsByIndex(int32 GoodsIndex, int32 Quantity, const FGameplayTag& ZoneTag, int32& TotalRevenue) override;
+    virtual FMarketData GetMarketDataByIndex(int32 GoodsIndex, const FGameplayTag& ZoneTag) const override;
+
     // === MARKET MANIPULATION ===
     
     /** Add supply to zone market */
@@ -138,6 +154,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Economy")
     void UpdateZoneProduction(const FGameplayTag& ZoneTag, const TMap<FName, int32>& ProductionRates);
 
+    // === ZONE INPUTS ===
+
+    /** Resident count for a zone, live NPCs plus crowd proxies - scales its production and consumption against FZoneEconomicData::Population */
+    void SetZonePopulation(const FGameplayTag& ZoneTag, int32 ResidentNPCs);
+
+    /** Latest write of a zone resource - goods tagged with the resource type produce in proportion to its stock */
+    void SetZoneResource(const FGameplayTag& ZoneTag, const FZoneResourceState& Resource, float RegenPerSecond, float Capacity);
+
+    /** Zone unloaded - fall back to its data-driven rates */
+    void ClearZoneInputs(const FGameplayTag& ZoneTag);
+
     // === EVENTS ===
     
     /** Economy events delegate */
@@ -173,15 +200,38 @@ protected:
     void ProcessZoneConsumption();
 
     /** Calculate new price based on supply/demand */
-    int32 CalculatePrice(const FName& GoodsID, const FMarketData& InMarketData, const FGoodsData& InGoodsData) const;
-    void InitializeZoneMarkets(const FGameplayTag& ZoneTag);
+    int32 CalculatePrice(const FMarketData& InMarketData, const FGoodsData& InGoodsData) const;
+
+    /** Reprice one market and broadcast the change */
+    void UpdateMarketPrice(int32 ZoneIndex, int32 GoodsIndex);
+
+    /** One market per known good, seeded from the zone data's Markets where given */
+    void InitializeZoneMarkets(const FZoneEconomicData& ZoneData);
 
     /** Find zone economic data */
     FZoneEconomicData* FindZoneData(const FGameplayTag& ZoneTag);
     const FZoneEconomicData* FindZoneData(const FGameplayTag& ZoneTag) const;
 
-    /** Find goods data */
-    const FGoodsData* FindGoodsData(const FName& GoodsID) const;
+    /** Market for a goods index in a registered zone */
+    FMarketData* FindMarket(const FGameplayTag& ZoneTag, int32 GoodsIndex);
+    const FMarketData* FindMarket(const FGameplayTag& ZoneTag, int32 GoodsIndex) const;
+
+    /** Dense slot for a zone, created on first use */
+    int32 FindOrAddZoneIndex(const FGameplayTag& ZoneTag);
+
+    void UpdatePopulationScale(int32 ZoneIndex);
+
+    /** Flatten every zone's produced and consumed goods into ProductionLines and ConsumptionLines */
+    void RebuildFlowLines();
+
+    /** Net a market's queued trades into its supply and demand */
+    void SettleOrders(int32 ZoneIndex, int32 GoodsIndex);
+
+    /** Settle every market that traded since the last clearing. Prices move on the next UpdateMarketPrices */
+    void ClearOrderBook();
+
+    /** Stock left once queued trades settle */
+    int32 GetAvailableSupply(int32 ZoneIndex, int32 GoodsIndex) const;
 
     /** Log economy debug information */
     void LogEconomyDebug(const FString& Message) const;
@@ -197,9 +247,62 @@ private:
     UPROPERTY()
     TMap<FGameplayTag, FZoneEconomicData> ZoneEconomicData;
 
-    /** Goods data lookup */
+    /** Goods by compact index - names are resolved once at load */
     UPROPERTY()
-    TMap<FName, FGoodsData> GoodsData;
+    TArray<FGoodsData> Goods;
+
+    TMap<FName, int32> GoodsIndices;
+
+    /** Per-zone state - all arrays share the zone's dense index */
+    TArray<FGameplayTag> ZoneTags;
+    TArray<int32> ZoneResidentNPCs;
+    TArray<bool> ZoneHasLivePopulation;
+    TArray<float> ZonePopulationScales;
+    TMap<FGameplayTag, int32> ZoneIndices;
+
+    /** Markets by zone index, then goods index - empty while the zone is unregistered */
+    TArray<TArray<FMarketData>> ZoneMarkets;
+
+    /** Trades queued on one market since its last clearing - buys and sells are netted, not kept per order */
+    struct FMarketOrders
+    {
+        int32 BuyQuantity = 0;
+        int32 SellQuantity = 0;
+        int32 DemandDelta = 0;
+        bool bQueued = false;
+    };
+
+    /** Order books by zone index, then goods index - parallel to ZoneMarkets */
+    TArray<TArray<FMarketOrders>> ZoneOrders;
+
+    /** Markets with queued trades, as (zone index, goods index) */
+    TArray<FIntPoint> QueuedMarkets;
+
+    /** Latest pushed resource write, evaluated with the zone's regeneration rule at simulation time */
+    struct FResourceInput
+    {
+        int32 ZoneIndex = INDEX_NONE;
+        FZoneResourceState State;
+        float RegenPerSecond = 0.0f;
+        float Capacity = 1.0f;
+    };
+    TArray<FResourceInput> ResourceInputs;
+
+    /** One produced or consumed good in one zone */
+    struct FFlowLine
+    {
+        int32 ZoneIndex = INDEX_NONE;
+        int32 GoodsIndex = INDEX_NONE;
+        float RatePerHour = 0.0f;
+
+        /** Resource limiting production, INDEX_NONE when unconstrained */
+        int32 ResourceInput = INDEX_NONE;
+    };
+    TArray<FFlowLine> ProductionLines;
+    TArray<FFlowLine> ConsumptionLines;
+
+    /** Set when zones, rates or resource inputs change */
+    bool bFlowLinesDirty = true;
 
     /** Simulation timers */
     FTimerHandle PriceUpdateTimer;
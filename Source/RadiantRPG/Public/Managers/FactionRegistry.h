@@ -0,0 +1,244 @@
+// Public/Managers/FactionRegistry.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Types/FactionTypes.h"
+#include "FactionRegistry.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTerritoryOwnerChanged, FName, ZoneID, int32, OldFactionID, int32, NewFactionID);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFactionRegistryEvent, const FFactionEvent&, Event);
+
+/**
+ * Compact relationship cell stored in the dense relationship matrix
+ */
+struct FFactionRelationCell
+{
+    float Value = 0.0f;
+    float LastConflictTime = 0.0f;
+    uint8 bAtWar : 1;
+    uint8 bHasTradingRights : 1;
+    uint8 bHasAlliance : 1;
+
+    FFactionRelationCell()
+        : bAtWar(false)
+        , bHasTradingRights(false)
+        , bHasAlliance(false)
+    {
+    }
+
+    bool IsDefault() const
+    {
+        return Value == 0.0f && !bAtWar && !bHasTradingRights && !bHasAlliance;
+    }
+};
+
+/**
+ * Location of an indexed entry inside a faction's data arrays
+ */
+struct FFactionSlot
+{
+    int32 FactionID = INDEX_NONE;
+    int32 Index = INDEX_NONE;
+
+    FFactionSlot() {}
+    FFactionSlot(int32 InFactionID, int32 InIndex) : FactionID(InFactionID), Index(InIndex) {}
+};
+
+/**
+ * Faction Registry Subsystem
+ * Runtime index over FFactionData. Factions are assigned compact integer IDs on
+ * registration; membership, relationships and territory ownership are held in
+ * hash maps and a dense relationship matrix so combat, economy and zone queries
+ * are O(1). All mutations go through the registry so the indices and the
+ * underlying FFactionData arrays stay consistent.
+ */
+UCLASS(BlueprintType)
+class RADIANTRPG_API UFactionRegistry : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // === SUBSYSTEM LIFECYCLE ===
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // === REGISTRATION ===
+
+    /** Register a faction and index its members, relationships and territories. Returns the faction ID */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry")
+    int32 RegisterFaction(const FFactionData& FactionData);
+
+    /** Register a batch of factions - relationships between them are resolved regardless of order */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry")
+    void RegisterFactions(const TArray<FFactionData>& InFactions);
+
+    /** Remove all factions and indices */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry")
+    void ResetRegistry();
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry")
+    int32 GetNumFactions() const { return Factions.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry")
+    bool IsValidFaction(int32 FactionID) const { return Factions.IsValidIndex(FactionID); }
+
+    /** Resolve a faction name to its ID (INDEX_NONE if unknown) */
+    UFUNCTION(BlueprintPure, Category = "Faction Registry")
+    int32 FindFactionID(FName FactionName) const;
+
+    /** Resolve a faction gameplay tag (as used by characters and zones) to its ID */
+    UFUNCTION(BlueprintPure, Category = "Faction Registry")
+    int32 FindFactionIDByTag(FGameplayTag FactionTag) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry")
+    FName GetFactionName(int32 FactionID) const;
+
+    /** Faction data with relationship arrays synced from the matrix - use for saving and UI */
+    const FFactionData* GetFactionData(int32 FactionID);
+
+    // === MEMBERSHIP ===
+
+    /** Add a member to a faction, moving it out of any previous faction */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Members")
+    bool AddMember(int32 FactionID, const FFactionMember& Member);
+
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Members")
+    bool RemoveMember(FName MemberID);
+
+    /** Faction the member belongs to (INDEX_NONE if none) */
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Members")
+    int32 GetMemberFaction(FName MemberID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Members")
+    bool IsMemberOf(FName MemberID, int32 FactionID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Members")
+    int32 GetMemberCount(int32 FactionID) const;
+
+    const FFactionMember* FindMember(FName MemberID) const;
+    FFactionMember* FindMember(FName MemberID);
+
+    // === RELATIONSHIPS ===
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    float GetRelationshipValue(int32 FactionA, int32 FactionB) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    ERelationshipStanding GetRelationshipStanding(int32 FactionA, int32 FactionB) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    bool AreAtWar(int32 FactionA, int32 FactionB) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    bool AreAllied(int32 FactionA, int32 FactionB) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    bool HaveTradingRights(int32 FactionA, int32 FactionB) const;
+
+    /** Factions both A and B are at war with */
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Relationships")
+    TArray<int32> GetSharedEnemies(int32 FactionA, int32 FactionB) const;
+
+    /** Set how A views B (-100 to 100) */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Relationships")
+    void SetRelationshipValue(int32 FactionA, int32 FactionB, float NewValue);
+
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Relationships")
+    void ModifyRelationshipValue(int32 FactionA, int32 FactionB, float Delta);
+
+    /** War state is symmetric */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Relationships")
+    void SetAtWar(int32 FactionA, int32 FactionB, bool bAtWar);
+
+    /** Alliance state is symmetric */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Relationships")
+    void SetAlliance(int32 FactionA, int32 FactionB, bool bAllied);
+
+    /** Trading rights are symmetric */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Relationships")
+    void SetTradingRights(int32 FactionA, int32 FactionB, bool bCanTrade);
+
+    // === TERRITORY ===
+
+    /** Faction controlling a zone (INDEX_NONE if uncontrolled) */
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Territory")
+    int32 GetTerritoryOwner(FName ZoneID) const;
+
+    /** Transfer a zone to a new owner, or release it with INDEX_NONE */
+    UFUNCTION(BlueprintCallable, Category = "Faction Registry|Territory")
+    bool SetTerritoryOwner(FName ZoneID, int32 NewFactionID);
+
+    UFUNCTION(BlueprintPure, Category = "Faction Registry|Territory")
+    int32 GetTerritoryCount(int32 FactionID) const;
+
+    FTerritoryData* FindTerritory(FName ZoneID);
+    const FTerritoryData* FindTerritory(FName ZoneID) const;
+
+    // === EVENTS ===
+
+    UPROPERTY(BlueprintAssignable, Category = "Faction Registry Events")
+    FOnTerritoryOwnerChanged OnTerritoryOwnerChanged;
+
+    /** Typed event for every relationship, territory and membership mutation */
+    UPROPERTY(BlueprintAssignable, Category = "Faction Registry Events")
+    FOnFactionRegistryEvent OnFactionEvent;
+
+protected:
+    /** Add a faction without resolving relationships */
+    int32 AddFactionInternal(const FFactionData& FactionData);
+
+    /** Fill matrix cells from every faction's FFactionRelationship entries that target known factions */
+    void ResolveRelationships(int32 FirstNewFactionID);
+
+    /** Grow the relationship matrix so it can hold at least RequiredCount factions */
+    void EnsureMatrixCapacity(int32 RequiredCount);
+
+    FORCEINLINE int32 CellIndex(int32 FactionA, int32 FactionB) const { return FactionA * MatrixStride + FactionB; }
+
+    const FFactionRelationCell* GetCell(int32 FactionA, int32 FactionB) const;
+    FFactionRelationCell* GetCell(int32 FactionA, int32 FactionB);
+
+    /** Write matrix row back into the faction's Relationships array */
+    void SyncRelationshipsToData(int32 FactionID);
+
+    void MarkRelationshipsDirty(int32 FactionA, int32 FactionB);
+
+    /** Mark every faction at war with FactionID - their SharedEnemies depend on FactionID's wars */
+    void MarkEnemiesDirty(int32 FactionID);
+
+    static ERelationshipStanding StandingFromValue(float Value);
+
+    /** FFactionEvent::EventType for each payload kind */
+    static FGameplayTag GetEventTag(EFactionEventKind Kind);
+
+    /** Build and broadcast a faction event - skipped entirely when nobody is listening */
+    void BroadcastFactionEvent(const FFactionEventPayload& Payload);
+
+private:
+    /** Faction data indexed by faction ID */
+    UPROPERTY()
+    TArray<FFactionData> Factions;
+
+    /** FFactionData::FactionID -> faction ID */
+    TMap<FName, int32> FactionNameLookup;
+
+    /** FFactionData::FactionTags -> faction ID, kept apart so a tag can never shadow a faction name */
+    TMap<FGameplayTag, int32> FactionTagLookup;
+
+    /** Member ID -> faction and index into that faction's Members array */
+    TMap<FName, FFactionSlot> MemberIndex;
+
+    /** Zone ID -> owning faction and index into its ControlledTerritories array */
+    TMap<FName, FFactionSlot> TerritoryIndex;
+
+    /** Dense MatrixStride x MatrixStride relationship matrix, row = viewing faction */
+    TArray<FFactionRelationCell> RelationMatrix;
+    int32 MatrixStride = 0;
+
+    /** Factions whose Relationships array is out of date with the matrix */
+    TBitArray<> RelationshipsDirty;
+};
@@ -0,0 +1,153 @@
+// Public/Managers/LootManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Math/RandomStream.h"
+#include "Types/ItemTypes.h"
+#include "LootManager.generated.h"
+
+/**
+ * Alias-method sampler (Vose) - O(n) build, O(1) sample
+ * Outcomes map each column to a loot entry index, or INDEX_NONE for "no drop"
+ */
+struct RADIANTRPG_API FLootAliasSampler
+{
+    TArray<float> Probability;
+    TArray<int32> Alias;
+    TArray<int32> Outcomes;
+
+    /** Build from per-outcome weights. Weights must be non-negative */
+    void Build(const TArray<int32>& InOutcomes, const TArray<float>& Weights);
+
+    /** Draw one outcome, INDEX_NONE if the sampler is empty or rolled "no drop" */
+    int32 Sample(FRandomStream& Stream) const;
+
+    bool IsEmpty() const { return Outcomes.Num() == 0; }
+};
+
+/**
+ * One bit per requirement set - a single inline word up to 64 sets, more words beyond that
+ */
+struct RADIANTRPG_API FLootRequirementMask
+{
+    TArray<uint64, TInlineAllocator<1>> Words;
+
+    void Set(int32 SetIndex)
+    {
+        const int32 Word = SetIndex / 64;
+        if (Word >= Words.Num())
+        {
+            Words.SetNumZeroed(Word + 1);
+        }
+        Words[Word] |= uint64(1) << (SetIndex % 64);
+    }
+
+    bool IsSet(int32 SetIndex) const
+    {
+        const int32 Word = SetIndex / 64;
+        return Words.IsValidIndex(Word) && (Words[Word] & (uint64(1) << (SetIndex % 64))) != 0;
+    }
+
+    bool operator==(const FLootRequirementMask& Other) const { return Words == Other.Words; }
+
+    friend uint32 GetTypeHash(const FLootRequirementMask& Mask)
+    {
+        uint32 Hash = 0;
+        for (uint64 Word : Mask.Words)
+        {
+            Hash = HashCombineFast(Hash, GetTypeHash(Word));
+        }
+        return Hash;
+    }
+};
+
+/**
+ * Loot table compiled for runtime rolling
+ */
+struct RADIANTRPG_API FCompiledLootTable
+{
+    TArray<FLootEntry> Entries;
+
+    /** Distinct RequiredTags containers used by the entries */
+    TArray<FGameplayTagContainer> RequirementSets;
+
+    /** Requirement set index per entry, INDEX_NONE if the entry has no requirements */
+    TArray<int32> EntryRequirement;
+
+    /** Samplers keyed by the mask of satisfied requirement sets, built on first use */
+    TMap<FLootRequirementMask, FLootAliasSampler> FilteredSamplers;
+
+    void Compile(const TArray<FLootEntry>& InEntries);
+
+    /** Mask of the requirement sets the context tags satisfy - O(distinct requirement sets) */
+    FLootRequirementMask GetSatisfiedMask(const FGameplayTagContainer& ContextTags) const;
+
+    /** Sampler restricted to entries whose requirements are in the mask */
+    const FLootAliasSampler& GetSampler(const FLootRequirementMask& SatisfiedMask);
+
+    /** Turn a sampled entry into a drop with rolled quantity and rarity */
+    bool MakeDrop(int32 EntryIndex, FRandomStream& Stream, FLootDrop& OutDrop) const;
+};
+
+/**
+ * Loot Manager Subsystem
+ * Compiles FLootTable rows into alias samplers at load so each roll is O(1)
+ */
+UCLASS(BlueprintType)
+class RADIANTRPG_API ULootManager : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // === SUBSYSTEM LIFECYCLE ===
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // === CONFIGURATION ===
+
+    /** Compile every FLootTable row in the data table */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    void InitializeLoot(UDataTable* LootDataTable);
+
+    /** Compile or replace a single loot table */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    void RegisterLootTable(FName LootTableID, const TArray<FLootEntry>& Entries);
+
+    /** Reseed the shared loot stream (for deterministic replays and tests) */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    void SetLootSeed(int32 Seed);
+
+    UFUNCTION(BlueprintPure, Category = "Loot")
+    bool HasLootTable(FName LootTableID) const { return CompiledTables.Contains(LootTableID); }
+
+    // === ROLLING ===
+
+    /** Roll a single drop. Returns false if nothing dropped */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    bool RollLoot(FName LootTableID, const FGameplayTagContainer& ContextTags, FLootDrop& OutDrop);
+
+    /**
+     * Roll many drops at once (mass kills, boss and dungeon clears)
+     * Table lookup and tag filtering happen once; each roll is O(1)
+     * @param bMergeStacks Combine drops with the same item and rarity
+     * @return Number of drops appended to OutDrops
+     */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    int32 RollLootBatch(FName LootTableID, int32 NumRolls, const FGameplayTagContainer& ContextTags, TArray<FLootDrop>& OutDrops, bool bMergeStacks = true);
+
+    /** C++ variants using a caller-provided stream */
+    bool RollLootWithStream(FName LootTableID, const FGameplayTagContainer& ContextTags, FRandomStream& Stream, FLootDrop& OutDrop);
+    int32 RollLootBatchWithStream(FName LootTableID, int32 NumRolls, const FGameplayTagContainer& ContextTags, FRandomStream& Stream, TArray<FLootDrop>& OutDrops, bool bMergeStacks = true);
+
+private:
+    /** Compiled tables by ID */
+    TMap<FName, FCompiledLootTable> CompiledTables;
+
+    /** Shared stream for Blueprint rolls */
+    FRandomStream LootStream;
+};
@@ -128,6 +128,10 @@ struct RADIANTRPG_API FARPG_NPCConfiguration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
     TArray<FARPG_AIPersonalityTrait> PersonalityTraits;
 
+    /** Follow the archetype's daily routine, running the full brain only when interrupted */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bFollowDailyRoutine = false;
+
     /** Tags that define this NPC's characteristics */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tags")
     FGameplayTagContainer NPCTags;
@@ -165,6 +169,123 @@ struct RADIANTRPG_API FARPG_NPCConfiguration
     }
 };
 
+/**
+ * One block of an archetype's daily routine
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FARPG_RoutineEntry
+{
+    GENERATED_BODY()
+
+    /** First game hour of the block */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine", meta = (ClampMin = "0", ClampMax = "23"))
+    int32 StartHour = 0;
+
+    /** Hour the block ends (exclusive) - may be lower than StartHour to run past midnight */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine", meta = (ClampMin = "0", ClampMax = "24"))
+    int32 EndHour = 24;
+
+    /** Intent the NPC follows during the block */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine", meta = (Categories = "AI.Intent"))
+    FGameplayTag ActivityIntent;
+};
+
+/**
+ * Daily routine for an archetype - later entries override earlier ones where they overlap
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FARPG_NPCRoutine : public FTableRowBase
+{
+    GENERATED_BODY()
+
+    /** Archetype this routine applies to */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine")
+    EARPG_NPCArchetype Archetype = EARPG_NPCArchetype::Generic;
+
+    /** Activity blocks - uncovered hours fall back to idle */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routine")
+    TArray<FARPG_RoutineEntry> Entries;
+};
+
+/**
+ * Handle to a crowd proxy - stale once the proxy is removed
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FARPG_CrowdProxyHandle
+{
+    GENERATED_BODY()
+
+    int32 Index = INDEX_NONE;
+    int32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; }
+
+    bool operator==(const FARPG_CrowdProxyHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+    bool operator!=(const FARPG_CrowdProxyHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * A relationship a crowd proxy carries while it has no actor
+ *
+ * Crowd NPCs are keyed by their proxy handle, since the actor standing in for
+ * one is pooled and reused for others. Only actors outside the crowd, such as
+ * players, are keyed by the actor itself.
+ */
+struct FARPG_CrowdRelationship
+{
+    FARPG_CrowdProxyHandle TargetProxy;
+    TWeakObjectPtr<AActor> TargetActor;
+    float Value = 0.0f;
+
+    bool IsSet() const { return TargetProxy.IsValid() || TargetActor.IsValid(); }
+};
+
+/**
+ * Actorless stand-in for a distant NPC
+ *
+ * Holds only what the crowd manager simulates in bulk and what it needs to
+ * rebuild a full NPC on promotion. Needs are quantized to 16 bits.
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FARPG_CrowdProxy
+{
+    GENERATED_BODY()
+
+    static constexpr int32 NumNeeds = (int32)EARPG_NeedType::MAX;
+    static constexpr int32 MaxKeyRelationships = 3;
+
+    /** Class spawned when promoted */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    TSubclassOf<class AARPG_BaseNPCCharacter> NPCClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    float Yaw = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    FGameplayTag Faction;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    EARPG_NPCArchetype Archetype = EARPG_NPCArchetype::Generic;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crowd")
+    bool bFollowDailyRoutine = true;
+
+    /** Routine activity the proxy is currently in */
+    UPROPERTY(BlueprintReadOnly, Category = "Crowd")
+    FGameplayTag CurrentActivity;
+
+    uint16 NeedLevels[NumNeeds] = {};
+
+    FARPG_CrowdRelationship KeyRelationships[MaxKeyRelationships];
+
+    float GetNeedLevel(EARPG_NeedType NeedType) const { return NeedLevels[(int32)NeedType] / (float)MAX_uint16; }
+    void SetNeedLevel(EARPG_NeedType NeedType, float Level) { NeedLevels[(int32)NeedType] = (uint16)FMath::RoundToInt(FMath::Clamp(Level, 0.0f, 1.0f) * MAX_uint16); }
+};
+
 /**
  * NPC spawn configuration
  */
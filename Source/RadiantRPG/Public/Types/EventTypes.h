@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Engine/DataTable.h"
+#include "Engine/NetSerialization.h"
 #include "EventTypes.generated.h"
 
 /**
@@ -24,7 +25,9 @@ enum class EEventCategory : uint8
     AI          UMETA(DisplayName = "AI"),
     Resource    UMETA(DisplayName = "Resource"),
     Weather     UMETA(DisplayName = "Weather"),
-    Time        UMETA(DisplayName = "Time")
+    Time        UMETA(DisplayName = "Time"),
+
+    MAX         UMETA(Hidden)
 };
 
 /**
@@ -104,6 +107,49 @@ struct FWorldEvent
 };
 
 
+/**
+ * Compact world event sent to a client connection - no actor references or metadata
+ */
+USTRUCT(BlueprintType)
+struct FNetWorldEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    FGameplayTag EventTag;
+
+    UPROPERTY(BlueprintReadOnly)
+    EEventCategory Category = EEventCategory::System;
+
+    UPROPERTY(BlueprintReadOnly)
+    EEventPriority Priority = EEventPriority::Normal;
+
+    UPROPERTY(BlueprintReadOnly)
+    FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly)
+    float Radius = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float Intensity = 1.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float Timestamp = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float Duration = 0.0f;
+
+    /** Game state world event this tracks, INDEX_NONE for one-off broadcasts */
+    UPROPERTY(BlueprintReadOnly)
+    int32 PersistentEventID = INDEX_NONE;
+
+    /** Persistent event has ended, or is no longer relevant to the receiving connection */
+    UPROPERTY(BlueprintReadOnly)
+    bool bEnded = false;
+
+    bool IsPersistent() const { return PersistentEventID != INDEX_NONE; }
+};
+
 /**
  * Event subscription info
  */
@@ -280,6 +280,81 @@ struct FFactionMember
     }
 };
 
+/**
+ * Kind of faction event - selects which payload fields are meaningful
+ */
+UENUM(BlueprintType)
+enum class EFactionEventKind : uint8
+{
+    None                UMETA(DisplayName = "None"),
+    WarDeclared         UMETA(DisplayName = "War Declared"),
+    PeaceMade           UMETA(DisplayName = "Peace Made"),
+    AllianceFormed      UMETA(DisplayName = "Alliance Formed"),
+    AllianceBroken      UMETA(DisplayName = "Alliance Broken"),
+    TradeOpened         UMETA(DisplayName = "Trade Opened"),
+    TradeClosed         UMETA(DisplayName = "Trade Closed"),
+    RelationshipChanged UMETA(DisplayName = "Relationship Changed"),
+    TerritoryChanged    UMETA(DisplayName = "Territory Changed"),
+    MemberJoined        UMETA(DisplayName = "Member Joined"),
+    MemberLeft          UMETA(DisplayName = "Member Left"),
+    
+    MAX                 UMETA(Hidden)
+};
+
+/**
+ * Fixed-layout faction event payload
+ * Factions are identified by FFactionData::FactionID, which is what gets saved
+ * and replicated. The registry IDs are runtime indices in registration order,
+ * for fast lookups while the event is dispatched - they are never persisted.
+ */
+USTRUCT(BlueprintType)
+struct FFactionEventPayload
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EFactionEventKind Kind = EFactionEventKind::None;
+
+    /** Faction that caused the event (attacker, proposer, new owner) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName SourceFaction;
+
+    /** Faction the event applies to (defender, partner, previous owner) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName TargetFaction;
+
+    /** Registry ID of SourceFaction (INDEX_NONE when unused) - runtime only */
+    UPROPERTY(Transient, NotReplicated, BlueprintReadWrite)
+    int32 SourceFactionID = INDEX_NONE;
+
+    /** Registry ID of TargetFaction (INDEX_NONE when unused) - runtime only */
+    UPROPERTY(Transient, NotReplicated, BlueprintReadWrite)
+    int32 TargetFactionID = INDEX_NONE;
+
+    /** Zone affected by territory events */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName TerritoryID;
+
+    /** Change applied by this event (relationship value delta) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float Delta = 0.0f;
+
+    /** Value after the change */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float NewValue = 0.0f;
+
+    FFactionEventPayload()
+    {
+    }
+
+    FFactionEventPayload(EFactionEventKind InKind, int32 InSource, int32 InTarget)
+        : Kind(InKind)
+        , SourceFactionID(InSource)
+        , TargetFactionID(InTarget)
+    {
+    }
+};
+
 /**
  * Faction event for broadcasting
  */
@@ -310,13 +385,35 @@ struct FFactionEvent
     TArray<FName> InvolvedFactions;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    TMap<FName, FString> EventData;
+    FFactionEventPayload Payload;
 
     FFactionEvent()
     {
     }
 };
 
+/**
+ * War and alliance flags between two registered factions, by FactionID
+ * The game state replicates these so client registries match the server's
+ */
+USTRUCT(BlueprintType)
+struct FFactionPairStanding
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName FactionA;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName FactionB;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bAtWar = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bAllied = false;
+};
+
 /**
  * Complete faction data
  */
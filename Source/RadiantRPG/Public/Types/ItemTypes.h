@@ -269,30 +269,47 @@ struct FItemData : public FTableRowBase
 };
 
 /**
- * Runtime item instance with unique properties
+ * Compact stack of a fungible item - no GUID, no per-instance data
+ * Used for recipe inputs/outputs, loot results and UI lists
  */
 USTRUCT(BlueprintType)
-struct FItemInstance
+struct FItemStack
 {
     GENERATED_BODY()
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FName ItemID;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FGuid UniqueID;
-
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     int32 Quantity = 1;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    float Durability = 100.0f;
+    ECraftingQuality Quality = ECraftingQuality::Standard;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    float MaxDurability = 100.0f;
+    FItemStack()
+    {
+    }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    ECraftingQuality Quality = ECraftingQuality::Standard;
+    FItemStack(FName InItemID, int32 InQuantity, ECraftingQuality InQuality = ECraftingQuality::Standard)
+        : ItemID(InItemID)
+        , Quantity(InQuantity)
+        , Quality(InQuality)
+    {
+    }
+
+    bool CanStackWith(const FItemStack& Other) const
+    {
+        return ItemID == Other.ItemID && Quality == Other.Quality;
+    }
+};
+
+/**
+ * Per-instance data only unique items carry
+ */
+USTRUCT(BlueprintType)
+struct FItemUniqueData
+{
+    GENERATED_BODY()
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<FItemAffix> Affixes;
@@ -306,13 +323,139 @@ struct FItemInstance
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TMap<FName, float> CustomData;
 
+    bool IsEmpty() const
+    {
+        return Affixes.Num() == 0 && BonusStats.Num() == 0 && CustomTags.IsEmpty() && CustomData.Num() == 0;
+    }
+};
+
+/**
+ * Runtime item instance with unique properties
+ * UniqueID stays invalid until the instance is first persisted (EnsureUniqueID),
+ * and affixes/custom data live in a shared block only items that have them allocate.
+ * Copies share the block until one of them is modified (GetOrCreateUniqueData).
+ */
+USTRUCT(BlueprintType)
+struct FItemInstance
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName ItemID;
+
+    /** Assigned lazily - invalid for instances that were never persisted */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FGuid UniqueID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 Quantity = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float Durability = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float MaxDurability = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    ECraftingQuality Quality = ECraftingQuality::Standard;
+
     FItemInstance()
     {
-        UniqueID = FGuid::NewGuid();
     }
 
+    explicit FItemInstance(const FItemStack& Stack)
+        : ItemID(Stack.ItemID)
+        , Quantity(Stack.Quantity)
+        , Quality(Stack.Quality)
+    {
+    }
+
+    /** Generate the GUID if this instance does not have one yet. Call before saving or replicating by ID */
+    const FGuid& EnsureUniqueID();
+
+    bool HasUniqueData() const { return UniqueData.IsValid(); }
+    const FItemUniqueData* GetUniqueData() const { return UniqueData.Get(); }
+
+    /** Writable unique data - allocated on first use, and detached from any copy sharing it */
+    FItemUniqueData& GetOrCreateUniqueData();
+
+    /** Drop the unique data block if nothing is left in it */
+    void CompactUniqueData();
+
+    FItemStack ToStack() const { return FItemStack(ItemID, Quantity, Quality); }
+
     bool IsStackable() const;
     bool CanStackWith(const FItemInstance& Other) const;
+
+    /** Tagged properties plus the unique data block. Packages saved before the block load through FItemInstanceLegacy */
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+    bool Identical(const FItemInstance* Other, uint32 PortFlags) const;
+
+private:
+    /** Null for fungible items */
+    TSharedPtr<FItemUniqueData> UniqueData;
+
+    friend struct FItemInstanceLegacy;
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemInstance> : public TStructOpsTypeTraitsBase2<FItemInstance>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+        WithIdentical = true,
+    };
+};
+
+/**
+ * Every layout FItemInstance was saved with before the unique data block became
+ * a pointer - only used to read old packages and saves, never held at runtime
+ */
+USTRUCT()
+struct FItemInstanceLegacy
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FName ItemID;
+
+    UPROPERTY()
+    FGuid UniqueID;
+
+    UPROPERTY()
+    int32 Quantity = 1;
+
+    UPROPERTY()
+    float Durability = 100.0f;
+
+    UPROPERTY()
+    float MaxDurability = 100.0f;
+
+    UPROPERTY()
+    ECraftingQuality Quality = ECraftingQuality::Standard;
+
+    /** Zero or one entry */
+    UPROPERTY()
+    TArray<FItemUniqueData> UniqueData;
+
+    // Pre-UniqueData fields
+    UPROPERTY()
+    TArray<FItemAffix> Affixes;
+
+    UPROPERTY()
+    TArray<FItemStatBonus> BonusStats;
+
+    UPROPERTY()
+    FGameplayTagContainer CustomTags;
+
+    UPROPERTY()
+    TMap<FName, float> CustomData;
+
+    /** Move everything into Item, unique data included */
+    void UpgradeTo(FItemInstance& Item);
 };
 
 /**
@@ -330,9 +473,17 @@ struct FCraftingRecipe : public FTableRowBase
     FText DisplayName;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    TArray<FItemInstance> RequiredItems;
+    TArray<FItemStack> RequiredStacks;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FItemStack> OutputStacks;
+
+    // Pre-FItemStack layout, kept under the old names so existing rows still load into them.
+    // Converted into RequiredStacks/OutputStacks on load and import - always empty at runtime
+    UPROPERTY()
+    TArray<FItemInstance> RequiredItems;
+
+    UPROPERTY()
     TArray<FItemInstance> OutputItems;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -353,6 +504,21 @@ struct FCraftingRecipe : public FTableRowBase
     FCraftingRecipe()
     {
     }
+
+    /** Convert legacy item lists into stacks. Returns true if anything was converted */
+    bool UpgradeLegacyData();
+
+    void PostSerialize(const FArchive& Ar);
+    virtual void OnPostDataImport(const UDataTable* InDataTable, const FName InRowName, TArray<FString>& OutCollectedImportProblems) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FCraftingRecipe> : public TStructOpsTypeTraitsBase2<FCraftingRecipe>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 };
 
 /**
@@ -384,4 +550,46 @@ struct FLootEntry
     FLootEntry()
     {
     }
-};
\ No newline at end of file
+};
+
+/**
+ * Loot table definition - a set of mutually exclusive entries rolled as one drop
+ * DropChance acts as the entry's weight; if the chances sum below 1 the remainder is "no drop"
+ */
+USTRUCT(BlueprintType)
+struct FLootTable : public FTableRowBase
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName LootTableID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FLootEntry> Entries;
+
+    FLootTable()
+    {
+    }
+};
+
+/**
+ * Result of a single loot roll
+ */
+USTRUCT(BlueprintType)
+struct FLootDrop
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName ItemID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 Quantity = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    ERarityTier Rarity = ERarityTier::Common;
+
+    FLootDrop()
+    {
+    }
+};
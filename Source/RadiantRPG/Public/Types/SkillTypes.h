@@ -189,7 +189,9 @@ enum class ESkillType : uint8
     
 	// Knowledge Skills
 	Lore UMETA(DisplayName = "Lore"),
-	Survival UMETA(DisplayName = "Survival")
+	Survival UMETA(DisplayName = "Survival"),
+
+	MAX UMETA(Hidden)
 };
 
 /**
@@ -518,6 +520,38 @@ struct FSkillSynergy
     }
 };
 
+/**
+ * Skill synergies compiled into adjacency lists keyed by ESkillType
+ * Edges are grouped by secondary skill, so a level change in one skill only
+ * visits the synergies it can switch on or off.
+ */
+struct RADIANTRPG_API FSkillSynergyGraph
+{
+    struct FEdge
+    {
+        ESkillType PrimarySkill;
+        ESkillType SecondarySkill;
+        float Bonus;
+        float RequiredSecondaryLevel;
+    };
+
+    /** All valid synergies */
+    TArray<FEdge> Edges;
+
+    /** Edge indices per secondary skill */
+    TArray<TArray<int32>> EdgesBySecondary;
+
+    /** Resolve skill names to ESkillType and build the adjacency lists. Unknown names are skipped */
+    void Compile(const TArray<FSkillSynergy>& Synergies);
+
+    const TArray<int32>& GetEdgesFromSecondary(ESkillType SecondarySkill) const;
+
+    bool IsEmpty() const { return Edges.Num() == 0; }
+
+    /** Skill type for a skill name (enum name, display name or gameplay tag leaf), MAX if unknown */
+    static ESkillType ResolveSkillName(FName SkillName);
+};
+
 /**
  * Character's complete skill set
  */
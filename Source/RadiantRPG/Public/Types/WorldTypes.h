@@ -119,7 +119,9 @@ enum class EZoneWeather : uint8
     Rain            UMETA(DisplayName = "Rain"),
     Storm           UMETA(DisplayName = "Storm"),
     Snow            UMETA(DisplayName = "Snow"),
-    Fog             UMETA(DisplayName = "Fog")
+    Fog             UMETA(DisplayName = "Fog"),
+
+    MAX             UMETA(Hidden)
 };
 
 /**
@@ -314,6 +316,26 @@ struct FLevelRange
     }
 };
 
+/**
+ * Zone resource stock, regenerated on read from the time it was last written
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FZoneResourceState
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Resource")
+    FGameplayTag ResourceType;
+
+    /** Stock at LastUpdateTime */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Resource")
+    float Amount = 0.0f;
+
+    /** World time Amount was written */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Resource")
+    float LastUpdateTime = 0.0f;
+};
+
 /** Weather data for environmental systems */
 USTRUCT(BlueprintType)
 struct RADIANTRPG_API FWorldWeatherData
@@ -7,6 +7,7 @@
 #include "GameplayTagContainer.h"
 #include "Types/EventTypes.h"
 #include "Types/RadiantAITypes.h"
+#include "Core/RadiantTimerManager.h"
 #include "EventListenerComponent.generated.h"
 
 class UWorldEventManager;
@@ -150,5 +151,5 @@ private:
     UPROPERTY()
     UWorldEventManager* EventManager = nullptr;
 
-    FTimerHandle MemoryUpdateTimer;
+    FRadiantTimerHandle MemoryUpdateTimer;
 };
\ No newline at end of file
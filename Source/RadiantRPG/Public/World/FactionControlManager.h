@@ -0,0 +1,109 @@
+// Source/RadiantRPG/Public/World/FactionControlManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "Core/RadiantTimerManager.h"
+#include "FactionControlManager.generated.h"
+
+class ARadiantZoneManager;
+
+/**
+ * Faction control simulation configuration
+ */
+USTRUCT(BlueprintType)
+struct FFactionControlConfig
+{
+    GENERATED_BODY()
+
+    /** Enable territory control simulation */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+    bool bEnableSimulation = true;
+
+    /** Seconds between batched control updates */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "0.1"))
+    float UpdateInterval = 1.0f;
+
+    FFactionControlConfig()
+    {
+    }
+};
+
+/**
+ * Faction control simulation - the single owner of zone territory control
+ *
+ * Every zone's control state is held in dense arrays and decayed in one batched
+ * pass at a configurable rate, instead of each zone ticking its own decay.
+ * Zones are only called back when control actually changes hands.
+ */
+UCLASS()
+class RADIANTRPG_API UFactionControlManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Zone Registration
+    void RegisterZone(ARadiantZoneManager* Zone, FGameplayTag ControllingFaction, float ControlStrength, float DecayPerSecond);
+    void UnregisterZone(ARadiantZoneManager* Zone);
+    void SetZoneActive(ARadiantZoneManager* Zone, bool bActive);
+
+    // Control State
+    /** Hand the zone to a faction at full strength, ending any conflict. Does not call back into the zone */
+    void SetZoneController(ARadiantZoneManager* Zone, FGameplayTag FactionTag);
+
+    /** Begin contesting the zone - control decays each update until the attacker captures it */
+    void StartConflict(ARadiantZoneManager* Zone, FGameplayTag AttackingFaction);
+
+    UFUNCTION(BlueprintPure, Category = "Faction Control")
+    float GetControlStrength(const ARadiantZoneManager* Zone) const;
+
+    UFUNCTION(BlueprintPure, Category = "Faction Control")
+    bool IsZoneContested(const ARadiantZoneManager* Zone) const;
+
+    // Configuration
+    UFUNCTION(BlueprintCallable, Category = "Faction Control")
+    void ConfigureSimulation(const FFactionControlConfig& Config);
+
+protected:
+    /** Batched decay pass over every registered zone */
+    void UpdateControl();
+
+    /** Apply a capture to the registry and the zone actor */
+    void NotifyControlChanged(int32 ZoneIndex);
+
+    void RestartUpdateTimer();
+
+    int32 FindZoneIndex(const ARadiantZoneManager* Zone) const;
+
+private:
+    // Dense per-zone control state - all arrays share the same index
+    UPROPERTY()
+    TArray<TWeakObjectPtr<ARadiantZoneManager>> Zones;
+
+    TArray<FGameplayTag> ControllingFactions;
+    TArray<FGameplayTag> ContestingFactions;
+    TArray<float> ControlStrengths;
+    TArray<float> DecayRates;
+    TArray<bool> ActiveFlags;
+
+    /** Zone -> dense index, plus the key stored per slot for swap fix-up */
+    TMap<TObjectKey<ARadiantZoneManager>, int32> ZoneIndices;
+    TArray<TObjectKey<ARadiantZoneManager>> ZoneKeys;
+
+    /** Number of zones currently contested - the update pass is skipped when zero */
+    int32 NumContested = 0;
+
+    UPROPERTY()
+    FFactionControlConfig SimulationConfig;
+
+    FRadiantTimerHandle UpdateTimerHandle;
+};
@@ -0,0 +1,131 @@
+// Public/World/GameCalendar.h
+// Game-time calendar scheduler for RadiantRPG
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types/TimeTypes.h"
+#include "GameCalendar.generated.h"
+
+/**
+ * Recurring calendar boundaries
+ */
+UENUM(BlueprintType)
+enum class ECalendarRecurrence : uint8
+{
+    Hourly          UMETA(DisplayName = "Hourly"),
+    Daily           UMETA(DisplayName = "Daily"),
+    Seasonal        UMETA(DisplayName = "Seasonal"),
+
+    MAX             UMETA(Hidden)
+};
+
+/**
+ * Handle to a scheduled calendar event
+ */
+USTRUCT(BlueprintType)
+struct RADIANTRPG_API FCalendarEventHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 ID = INDEX_NONE;
+
+    bool IsValid() const { return ID != INDEX_NONE; }
+    void Invalidate() { ID = INDEX_NONE; }
+};
+
+/**
+ * Calendar callback
+ * @param Time World time when the event fired
+ * @param Occurrences Due times passed since the last call - more than one after a time skip
+ */
+DECLARE_DELEGATE_TwoParams(FCalendarCallback, const FSimpleWorldTime& /*Time*/, int32 /*Occurrences*/);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnCalendarEvent, const FSimpleWorldTime&, Time, int32, Occurrences);
+
+/**
+ * Game-time calendar scheduler
+ *
+ * Callbacks are kept in a min-heap keyed on the game minute they are due, so
+ * advancing the clock only looks at the top of the heap and systems are woken
+ * exactly when due instead of polling the time. Recurring events fire once per
+ * advance with the number of periods that elapsed, so long time skips cost one
+ * call rather than one per missed period.
+ */
+class RADIANTRPG_API FGameCalendar
+{
+public:
+    static constexpr int32 MinutesPerHour = 60;
+    static constexpr int32 MinutesPerDay = 24 * MinutesPerHour;
+    static constexpr int32 MinutesPerSeason = 30 * MinutesPerDay;
+
+    static int32 GetPeriodMinutes(ECalendarRecurrence Recurrence);
+
+    /** Drop every event and restart the clock */
+    void Reset(int32 NowMinutes);
+
+    /** Fire at an absolute game minute (FSimpleWorldTime::GetTotalMinutes) */
+    FCalendarEventHandle ScheduleAt(int32 DueMinutes, FCalendarCallback Callback);
+
+    /** Fire once after a delay in game minutes */
+    FCalendarEventHandle ScheduleAfter(int32 DelayMinutes, FCalendarCallback Callback);
+
+    /**
+     * Fire every PeriodMinutes, aligned to OffsetMinutes past each period boundary
+     * e.g. a daily period with a 6 * 60 offset fires at 06:00 every day
+     */
+    FCalendarEventHandle ScheduleEvery(int32 PeriodMinutes, int32 OffsetMinutes, FCalendarCallback Callback);
+
+    FCalendarEventHandle ScheduleRecurring(ECalendarRecurrence Recurrence, int32 OffsetMinutes, FCalendarCallback Callback)
+    {
+        return ScheduleEvery(GetPeriodMinutes(Recurrence), OffsetMinutes, MoveTemp(Callback));
+    }
+
+    void Cancel(FCalendarEventHandle& Handle);
+
+    bool IsScheduled(const FCalendarEventHandle& Handle) const { return Events.Contains(Handle.ID); }
+
+    /** Advance the clock, firing every event due at or before NowMinutes in due order */
+    void AdvanceTo(int32 NowMinutes, const FSimpleWorldTime& Time);
+
+    /** Time moved backwards - recurring events restart from the new time, one-shots keep their due time */
+    void Rebase(int32 NowMinutes);
+
+    int32 GetCurrentMinutes() const { return CurrentMinutes; }
+    int32 GetNumScheduled() const { return Events.Num(); }
+
+private:
+    struct FEvent
+    {
+        FCalendarCallback Callback;
+        int32 DueMinutes = 0;
+
+        /** Zero for one-shot events */
+        int32 PeriodMinutes = 0;
+        int32 OffsetMinutes = 0;
+    };
+
+    struct FHeapNode
+    {
+        int32 DueMinutes;
+        int32 ID;
+
+        /** Earliest first, then in scheduling order */
+        bool operator<(const FHeapNode& Other) const
+        {
+            return DueMinutes != Other.DueMinutes ? DueMinutes < Other.DueMinutes : ID < Other.ID;
+        }
+    };
+
+    FCalendarEventHandle AddEvent(FEvent&& Event);
+
+    /** First due time of a recurring event strictly after NowMinutes */
+    static int32 NextOccurrence(int32 NowMinutes, int32 PeriodMinutes, int32 OffsetMinutes);
+
+    /** Live events by ID - heap nodes whose due time no longer matches are stale and skipped */
+    TMap<int32, FEvent> Events;
+    TArray<FHeapNode> Heap;
+
+    int32 CurrentMinutes = 0;
+    int32 NextEventID = 0;
+};
@@ -10,6 +10,7 @@
 #include "Types/RadiantTypes.h"
 #include "Types/TimeTypes.h"
 #include "World/ISimpleTimeManager.h"
+#include "World/GameCalendar.h"
 #include "Engine/World.h"
 #include "Tickable.h"
 #include "Types/WorldManagerTypes.h"
@@ -147,6 +148,10 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Zone Management")
     TMap<FGameplayTag, TObjectPtr<ARadiantZoneManager>> RegisteredZones;
 
+    /** Last known data of every zone, loaded or not - from the applied save and from zones as they unload. Keyed by ZoneID */
+    UPROPERTY()
+    TMap<FName, FZoneData> SavedZones;
+
     /** Active world events */
     UPROPERTY(BlueprintReadOnly, Category = "World Events")
     TArray<FActiveWorldEvent> ActiveWorldEvents;
@@ -181,6 +186,9 @@ protected:
     /** Cached previous season for change detection */
     ESeason PreviousSeason;
 
+    /** Game-time scheduler - day, season and time of day boundaries are registered here */
+    FGameCalendar Calendar;
+
 public:
     // === EVENTS ===
     
@@ -274,6 +282,26 @@ public:
     UFUNCTION(BlueprintPure, Category = "World Time")
     FString GetFormattedFullTimeString() const { return GetFullTimeString(); }
 
+    // === CALENDAR INTERFACE ===
+
+    /** Calendar for native callers that want to be woken at game times instead of polling */
+    FGameCalendar& GetCalendar() { return Calendar; }
+
+    /** Fire a callback at an absolute game minute (FSimpleWorldTime::GetTotalMinutes) */
+    UFUNCTION(BlueprintCallable, Category = "World Time|Calendar")
+    FCalendarEventHandle ScheduleCalendarEvent(int32 GameMinute, FOnCalendarEvent Callback);
+
+    /** Fire a callback once after a delay in game minutes */
+    UFUNCTION(BlueprintCallable, Category = "World Time|Calendar")
+    FCalendarEventHandle ScheduleCalendarEventAfter(int32 DelayMinutes, FOnCalendarEvent Callback);
+
+    /** Fire a callback every hour, day or season, OffsetMinutes past the boundary */
+    UFUNCTION(BlueprintCallable, Category = "World Time|Calendar")
+    FCalendarEventHandle ScheduleRecurringCalendarEvent(ECalendarRecurrence Recurrence, int32 OffsetMinutes, FOnCalendarEvent Callback);
+
+    UFUNCTION(BlueprintCallable, Category = "World Time|Calendar")
+    void CancelCalendarEvent(UPARAM(ref) FCalendarEventHandle& Handle);
+
     // === WEATHER SYSTEM INTERFACE ===
     
     /** Get current global weather */
@@ -322,6 +350,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "Zone Management")
     TArray<ARadiantZoneManager*> GetAllZones() const;
 
+    /** Saved data of every known zone, including ones whose actor is not loaded */
+    const TMap<FName, FZoneData>& GetSavedZones() const { return SavedZones; }
+
     // === WORLD EVENT INTERFACE ===
     
     /** Trigger a global world event */
@@ -367,6 +398,14 @@ protected:
     /** Process time change events */
     void ProcessTimeChangeEvents(ETimeOfDay OldTimeOfDay, ESeason OldSeason);
 
+    /** Register the built-in day, season and time of day boundaries with the calendar */
+    void RegisterCalendarBoundaries();
+
+    /** Calendar boundary handlers */
+    void HandleTimeOfDayBoundary(const FSimpleWorldTime& Time, int32 Occurrences);
+    void HandleSeasonBoundary(const FSimpleWorldTime& Time, int32 Occurrences);
+    void HandleDayBoundary(const FSimpleWorldTime& Time, int32 Occurrences);
+
     /** Calculate weather transition */
     void CalculateWeatherTransition(float DeltaTime);
 
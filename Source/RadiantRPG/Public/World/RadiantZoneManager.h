@@ -5,14 +5,22 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 #include "Types/EventTypes.h"
 #include "Types/WorldTypes.h"
+#include "Core/RadiantTimerManager.h"
 #include "RadiantZoneManager.generated.h"
 
 class UBoxComponent;
 class USphereComponent;
 class UAudioComponent;
 class UWorldEventManager;
+class UFactionControlManager;
+class UWeatherScheduler;
+class UZoneTravelGraph;
+class UEconomyManager;
+class UARPG_CrowdManager;
+class URadiantWorldManager;
 
 /**
  * Represents a zone in the world with its own rules and events
@@ -28,7 +36,9 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    virtual void Tick(float DeltaTime) override;
+
+public:
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
     // Zone Information
@@ -47,6 +57,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Zone")
     TArray<AActor*> GetActorsInZone() const { return ActorsInZone; }
 
+    /** Zone description as saved and as seen by the travel graph */
+    UFUNCTION(BlueprintPure, Category = "Zone")
+    FZoneData GetZoneData() const;
+
     // Zone Events
     UFUNCTION(BlueprintCallable, Category = "Zone|Events")
     void OnEventOccurred(const FWorldEvent& Event);
@@ -110,6 +124,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Zone|Spawning")
     void DespawnAllNPCs();
 
+    /** Crowd proxies standing inside the zone - set by the crowd manager, counted as residents next to live NPCs */
+    void SetCrowdResidents(int32 NumProxies);
+
     // Zone State
     UFUNCTION(BlueprintCallable, Category = "Zone")
     void ActivateZone();
@@ -154,12 +171,28 @@ protected:
         UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
     // Internal update functions
-    void UpdateWeather();
-    void UpdateResources();
     void ProcessZoneEvents();
-    void CheckFactionStatus();
     void HandlePlayerEntry(AActor* Player);
 
+    // Resource helpers
+    /** O(1) through ResourceIndices */
+    int32 FindResourceIndex(const FGameplayTag& ResourceType) const;
+
+    void RebuildResourceIndices();
+
+    /** Stock after regrowing from the resource's last write up to Now */
+    float EvaluateResource(const FZoneResourceState& Resource, float Now) const;
+
+    float GetResourceTime() const;
+
+    /** Hand a resource's latest write to the economy */
+    void PushResourceToEconomy(const FZoneResourceState& Resource) const;
+
+    void PushPopulationToEconomy() const;
+
+    /** Non-player characters count towards the zone's economic population */
+    static bool IsResident(const AActor* Actor);
+
 private:
     // Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
@@ -193,6 +226,15 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Config", meta = (AllowPrivateAccess = "true"))
     bool bAutoActivateOnBeginPlay = true;
 
+    // Travel
+    /** Neighbouring zones NPCs can walk to - connections are two-way */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Travel", meta = (AllowPrivateAccess = "true"))
+    TArray<FGameplayTag> ConnectedZones;
+
+    /** Crossing points into neighbouring zones - ToZone is the neighbour's tag name */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Travel", meta = (AllowPrivateAccess = "true"))
+    TArray<FZoneTransition> ZoneTransitions;
+
     // Zone State
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone State", meta = (AllowPrivateAccess = "true"))
     bool bIsDiscovered = false;
@@ -203,36 +245,58 @@ private:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone State", meta = (AllowPrivateAccess = "true"))
     TArray<AActor*> PlayersInZone;
 
+    /** NPCs currently inside the bounds - pushed to the economy on every change */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone State", meta = (AllowPrivateAccess = "true"))
+    int32 NumResidents = 0;
+
+    /** Actors counted in NumResidents - exits decrement only what entry counted, whatever IsResident says now */
+    TSet<TObjectKey<AActor>> CountedResidents;
+
+    /** Unpromoted crowd proxies inside the bounds - a pooled actor leaves NumResidents as its proxy joins this */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone State", meta = (AllowPrivateAccess = "true"))
+    int32 NumCrowdResidents = 0;
+
     // Weather
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Weather", meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "Zone Weather", meta = (AllowPrivateAccess = "true"))
     EZoneWeather CurrentWeather = EZoneWeather::Clear;
 
+    /** States the weather scheduler may move this zone into (empty = any the climate allows) */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Weather", meta = (AllowPrivateAccess = "true"))
     TArray<EZoneWeather> PossibleWeatherTypes;
 
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Weather", meta = (AllowPrivateAccess = "true"))
-    float WeatherUpdateInterval = 300.0f;
-
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Weather", meta = (AllowPrivateAccess = "true"))
-    float WeatherChangeProbability = 0.3f;
+    /** Cleared by StopWeatherCycle - the zone keeps its weather and accrues no missed steps until restarted */
+    bool bWeatherCycleRunning = true;
 
     // Faction
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Faction", meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "Zone Faction", meta = (AllowPrivateAccess = "true"))
     FGameplayTag ControllingFaction;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Faction", meta = (AllowPrivateAccess = "true"))
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Replicated, Category = "Zone Faction", meta = (AllowPrivateAccess = "true"))
     FGameplayTag ContestedByFaction;
 
+    /** Initial control strength - the faction control manager owns the live value */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Faction", meta = (AllowPrivateAccess = "true"))
     float FactionControlStrength = 1.0f;
 
+    /** Control strength lost per second while contested */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Faction", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+    float FactionControlDecayRate = 0.001f;
+
     // Resources
+    /** Resource stocks by resource index - values regenerate lazily when read */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Resources", meta = (AllowPrivateAccess = "true"))
-    TMap<FGameplayTag, float> ResourceAvailability;
+    TArray<FZoneResourceState> Resources;
 
+    /** Resource type -> index into Resources. Resources are only ever appended, so indices stay stable */
+    TMap<FGameplayTag, int32> ResourceIndices;
+
+    /** Fraction of capacity regrown every ResourceRegenerationInterval */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Resources", meta = (AllowPrivateAccess = "true"))
     float ResourceRegenerationRate = 0.01f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Resources", meta = (AllowPrivateAccess = "true", ClampMin = "0.1"))
+    float ResourceRegenerationInterval = 10.0f;
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Zone Resources", meta = (AllowPrivateAccess = "true"))
     float MaxResourceCapacity = 100.0f;
 
@@ -282,8 +346,24 @@ private:
     UPROPERTY()
     UWorldEventManager* EventManager = nullptr;
 
+    UPROPERTY()
+    UFactionControlManager* FactionControlManager = nullptr;
+
+    UPROPERTY()
+    UWeatherScheduler* WeatherScheduler = nullptr;
+
+    UPROPERTY()
+    UZoneTravelGraph* TravelGraph = nullptr;
+
+    UPROPERTY()
+    UEconomyManager* EconomyManager = nullptr;
+
+    UPROPERTY()
+    UARPG_CrowdManager* CrowdManager = nullptr;
+
+    UPROPERTY()
+    URadiantWorldManager* WorldManager = nullptr;
+
     // Timers
-    FTimerHandle WeatherUpdateTimer;
-    FTimerHandle ResourceUpdateTimer;
-    FTimerHandle EventProcessTimer;
+    FRadiantTimerHandle EventProcessTimer;
 };
\ No newline at end of file
@@ -0,0 +1,196 @@
+// Source/RadiantRPG/Public/World/WeatherScheduler.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Math/RandomStream.h"
+#include "UObject/ObjectKey.h"
+#include "Types/WorldTypes.h"
+#include "World/GameCalendar.h"
+#include "WeatherScheduler.generated.h"
+
+class ARadiantZoneManager;
+class URadiantWorldManager;
+
+/**
+ * Weather scheduler configuration
+ */
+USTRUCT(BlueprintType)
+struct FWeatherSchedulerConfig
+{
+    GENERATED_BODY()
+
+    /** Enable scheduled weather changes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+    bool bEnableSimulation = true;
+
+    /** Game minutes per weather transition step */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "1"))
+    int32 StepGameMinutes = 60;
+
+    /** Step counts above this are resolved with a matrix power instead of step by step */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "1"))
+    int32 FastForwardThreshold = 4;
+
+    /** Seed for the weather stream (0 = random seed each session) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+    int32 Seed = 0;
+
+    FWeatherSchedulerConfig()
+    {
+    }
+};
+
+/**
+ * Row-stochastic transition matrix over EZoneWeather states
+ */
+struct FWeatherTransitionMatrix
+{
+    static constexpr int32 NumStates = (int32)EZoneWeather::MAX;
+
+    float P[NumStates][NumStates];
+
+    FWeatherTransitionMatrix()
+    {
+        FMemory::Memzero(P);
+    }
+
+    static FWeatherTransitionMatrix Identity();
+
+    FWeatherTransitionMatrix operator*(const FWeatherTransitionMatrix& Other) const;
+
+    /** This matrix raised to Steps, by repeated squaring */
+    FWeatherTransitionMatrix Power(int64 Steps) const;
+
+    /** Draw the next state from the row of the current state */
+    EZoneWeather Sample(EZoneWeather From, FRandomStream& Stream) const;
+};
+
+/**
+ * Compiled weather chains for one zone type and set of allowed weather states,
+ * one transition matrix per season
+ */
+struct FWeatherClimate
+{
+    EZoneType ZoneType = EZoneType::Wilderness;
+
+    /** Bit per EZoneWeather the zone may enter */
+    uint8 AllowedMask = 0;
+
+    FWeatherTransitionMatrix Seasons[(int32)ESeason::MAX];
+};
+
+/**
+ * Weather scheduler - the single owner of zone weather
+ *
+ * Each zone's weather is a Markov state advanced in one batched pass over dense
+ * arrays, using transition tables precomputed per zone type and season and a
+ * seeded random stream. Long gaps - time skips, or zones that were inactive -
+ * are resolved in one draw from the matrix power instead of stepping through
+ * every missed transition. Steps are driven by the world calendar, so nothing
+ * polls the clock. Zones are only called back when their weather
+ * actually changes.
+ */
+UCLASS()
+class RADIANTRPG_API UWeatherScheduler : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Zone Registration
+    /**
+     * Start scheduling a zone's weather
+     * @param AllowedWeather States the zone may enter (empty = all)
+     */
+    void RegisterZone(ARadiantZoneManager* Zone, EZoneType ZoneType, EZoneWeather InitialWeather, const TArray<EZoneWeather>& AllowedWeather);
+    void UnregisterZone(ARadiantZoneManager* Zone);
+
+    /** Inactive zones hold their weather and catch up in one draw when reactivated */
+    void SetZoneActive(ARadiantZoneManager* Zone, bool bActive);
+
+    /** Stopped zones hold their weather and miss no steps - nothing to catch up on when restarted */
+    void SetZoneCycleRunning(ARadiantZoneManager* Zone, bool bRunning);
+
+    /** Record weather forced from outside the scheduler and drop any pending catch-up. Does not call back into the zone */
+    void SetZoneWeather(ARadiantZoneManager* Zone, EZoneWeather NewWeather);
+
+    // Simulation
+    /** Advance every active zone by a number of transition steps */
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void FastForward(int32 Steps);
+
+    /** Probability of each weather state after Steps transitions from the zone's current weather */
+    UFUNCTION(BlueprintPure, Category = "Weather")
+    TArray<float> GetForecast(const ARadiantZoneManager* Zone, int32 Steps) const;
+
+    // Configuration
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void ConfigureSimulation(const FWeatherSchedulerConfig& Config);
+
+protected:
+    /** Calendar callback - one call per step boundary, or one per advance after a time skip */
+    void HandleWeatherStep(const FSimpleWorldTime& Time, int32 Occurrences);
+
+    /** Advance every active zone by Steps, then notify the ones whose weather changed */
+    void AdvanceAllZones(int64 Steps);
+
+    /**
+     * Draw a zone's state after Steps transitions
+     * @param PowerCache Matrix powers for this step count, shared across zones in one pass
+     */
+    EZoneWeather DrawState(int32 ClimateIndex, ESeason Season, EZoneWeather From, int64 Steps, TMap<int32, FWeatherTransitionMatrix>& PowerCache);
+
+    /** Apply a changed state to the zone actor */
+    void NotifyWeatherChanged(int32 ZoneIndex);
+
+    /** Apply the steps a zone missed while inactive, once it is active and running again */
+    void CatchUpZone(int32 ZoneIndex);
+
+    /** Find or compile the climate for a zone type and allowed-state mask */
+    int32 FindOrAddClimate(EZoneType ZoneType, uint8 AllowedMask);
+
+    static void BuildSeasonMatrix(EZoneType ZoneType, ESeason Season, uint8 AllowedMask, FWeatherTransitionMatrix& OutMatrix);
+
+    /** (Re)register the step callback with the world calendar */
+    void RestartStepSchedule();
+
+    URadiantWorldManager* GetWorldManager() const;
+    ESeason GetSeason() const;
+
+    int32 FindZoneIndex(const ARadiantZoneManager* Zone) const;
+
+private:
+    // Dense per-zone weather state - all arrays share the same index
+    UPROPERTY()
+    TArray<TWeakObjectPtr<ARadiantZoneManager>> Zones;
+
+    TArray<int32> ClimateIndices;
+    TArray<EZoneWeather> States;
+    TArray<bool> ActiveFlags;
+    TArray<bool> RunningFlags;
+
+    /** Steps an inactive, running zone has missed */
+    TArray<int64> PendingSteps;
+
+    /** Zone -> dense index, plus the key stored per slot for swap fix-up */
+    TMap<TObjectKey<ARadiantZoneManager>, int32> ZoneIndices;
+    TArray<TObjectKey<ARadiantZoneManager>> ZoneKeys;
+
+    /** Compiled climates, shared by every zone with the same type and allowed states */
+    TArray<FWeatherClimate> Climates;
+    TMap<uint32, int32> ClimateLookup;
+
+    FRandomStream WeatherStream;
+
+    UPROPERTY()
+    FWeatherSchedulerConfig SimulationConfig;
+
+    FCalendarEventHandle StepEventHandle;
+};
@@ -0,0 +1,126 @@
+// Public/World/WorldEventFeedComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Types/EventTypes.h"
+#include "WorldEventFeedComponent.generated.h"
+
+class UWorldEventRelevancyManager;
+class FRepLayout;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNetWorldEventReceived, const FNetWorldEvent&, Event);
+
+/**
+ * Per-connection world event traffic
+ */
+USTRUCT(BlueprintType)
+struct FWorldEventFeedStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    int32 EventsSent = 0;
+
+    /** Events judged irrelevant to this connection */
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    int32 EventsFiltered = 0;
+
+    /** Relevant events dropped because the queue was full */
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    int32 EventsDropped = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    int32 BatchesSent = 0;
+
+    /** RPC parameter bits of every batch sent, measured with the RPC's own rep layout. Only with radiant.net.measurefeedbits, never in shipping */
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    int64 BitsSent = 0;
+};
+
+/**
+ * World event feed - one per player controller
+ *
+ * On the server it queues the world events the relevancy manager judged
+ * relevant to this connection, then sends them in rate-limited reliable
+ * batches. On the owning client it tracks the persistent events it was told
+ * about and re-broadcasts every received event.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class RADIANTRPG_API UWorldEventFeedComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UWorldEventFeedComponent();
+
+    // Subscriptions
+    /** Choose the event categories this client wants (empty = all) */
+    UFUNCTION(BlueprintCallable, Category = "World Events")
+    void SetSubscribedCategories(const TArray<EEventCategory>& Categories);
+
+    bool IsSubscribedTo(EEventCategory Category) const { return (CategoryMask & (1u << (uint32)Category)) != 0; }
+
+    // Server
+    /** Queue a relevant event for the next batch */
+    void QueueEvent(const FNetWorldEvent& Event);
+
+    void RecordFiltered() { ++Stats.EventsFiltered; }
+
+    /** Send up to MaxTransientEvents queued one-off events, plus every pending persistent update */
+    void FlushEvents(int32 MaxTransientEvents);
+
+    /** Location used for proximity checks */
+    bool GetViewLocation(FVector& OutLocation) const;
+
+    /** Persistent events this connection has been sent and not yet told have ended */
+    const TSet<int32>& GetKnownPersistentEvents() const { return KnownPersistentEvents; }
+
+    UFUNCTION(BlueprintPure, Category = "World Events")
+    FWorldEventFeedStats GetFeedStats() const { return Stats; }
+
+    // Client
+    /** Persistent world events relevant to this player */
+    UFUNCTION(BlueprintPure, Category = "World Events")
+    TArray<FNetWorldEvent> GetRelevantWorldEvents() const { return RelevantWorldEvents; }
+
+    UPROPERTY(BlueprintAssignable, Category = "World Events")
+    FOnNetWorldEventReceived OnWorldEventReceived;
+
+    /** Queued one-off events above this count drop the lowest priority */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World Events", meta = (ClampMin = "1"))
+    int32 MaxQueuedEvents = 64;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UFUNCTION(Server, Reliable)
+    void ServerSetCategoryMask(int32 Mask);
+
+    UFUNCTION(Client, Reliable)
+    void ClientReceiveEventBatch(const TArray<FNetWorldEvent>& Events);
+
+    UWorldEventRelevancyManager* GetRelevancyManager() const;
+
+    /** Serialize a batch the way ClientReceiveEventBatch sends it and return the parameter bits - stats only, costs a second serialization */
+    int64 MeasureBatchBits(const TArray<FNetWorldEvent>& Events);
+
+    /** ClientReceiveEventBatch parameter layout, built on first measurement */
+    TSharedPtr<FRepLayout> BatchLayout;
+
+private:
+    /** Bit per EEventCategory - server copy of the client's subscriptions */
+    uint32 CategoryMask = MAX_uint32;
+
+    TArray<FNetWorldEvent> PendingPersistent;
+    TArray<FNetWorldEvent> PendingTransient;
+
+    TSet<int32> KnownPersistentEvents;
+
+    UPROPERTY()
+    TArray<FNetWorldEvent> RelevantWorldEvents;
+
+    FWorldEventFeedStats Stats;
+};
@@ -0,0 +1,113 @@
+// Public/World/WorldEventRelevancyManager.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Types/EventTypes.h"
+#include "Types/RadiantTypes.h"
+#include "Core/RadiantTimerManager.h"
+#include "WorldEventRelevancyManager.generated.h"
+
+class UWorldEventFeedComponent;
+class UWorldEventManager;
+class ARadiantGameState;
+
+/**
+ * World event relevancy configuration
+ */
+USTRUCT(BlueprintType)
+struct FWorldEventRelevancyConfig
+{
+    GENERATED_BODY()
+
+    /** Seconds between batches to each connection */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "0.05"))
+    float FlushInterval = 0.25f;
+
+    /** One-off events sent per connection per batch - the rest wait for the next batch */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "1"))
+    int32 MaxEventsPerBatch = 16;
+
+    /** Distance beyond an event's radius a player still hears about local events */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "0.0"))
+    float RelevancyPadding = 2000.0f;
+
+    /** Zone and regional events reach players in the same zone or within this distance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "0.0"))
+    float ZoneScopeDistance = 20000.0f;
+
+    /** Critical events bypass the proximity checks */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy")
+    bool bAlwaysSendCritical = true;
+};
+
+/**
+ * World event relevancy manager - server-side interest management
+ *
+ * Each world event broadcast and each persistent game state event is checked
+ * against every player connection's feed. The checks are the player's
+ * subscribed categories, the event priority and scope, and the distance or
+ * zone between the player and the event. Only relevant events are queued,
+ * and the feeds flush on a fixed interval as rate-limited reliable batches.
+ * Persistent events are re-checked each flush, so players moving in or out
+ * of range gain or lose them.
+ */
+UCLASS()
+class RADIANTRPG_API UWorldEventRelevancyManager : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Feeds
+    void RegisterFeed(UWorldEventFeedComponent* Feed);
+    void UnregisterFeed(UWorldEventFeedComponent* Feed);
+
+    // Configuration
+    UFUNCTION(BlueprintCallable, Category = "World Events|Relevancy")
+    void ConfigureRelevancy(const FWorldEventRelevancyConfig& Config);
+
+protected:
+    void HandleWorldEvent(const FWorldEvent& Event);
+
+    UFUNCTION()
+    void HandlePersistentEventStarted(const FWorldEventData& EventData);
+
+    UFUNCTION()
+    void HandlePersistentEventEnded(const FWorldEventData& EventData);
+
+    /** Reconcile persistent events and send every feed's batch */
+    void FlushFeeds();
+
+    /** Start or end persistent events on a feed as they enter or leave its interest */
+    void ReconcilePersistentEvents(UWorldEventFeedComponent* Feed);
+
+    bool IsRelevant(UWorldEventFeedComponent* Feed, const FNetWorldEvent& Event, EEventScope Scope) const;
+
+    void RestartFlushTimer();
+
+private:
+    UPROPERTY()
+    TArray<TWeakObjectPtr<UWorldEventFeedComponent>> Feeds;
+
+    /** Active game state events by ID - judged with zone scope */
+    TMap<int32, FNetWorldEvent> PersistentEvents;
+
+    UPROPERTY()
+    TWeakObjectPtr<UWorldEventManager> EventManager;
+
+    UPROPERTY()
+    TWeakObjectPtr<ARadiantGameState> GameState;
+
+    FDelegateHandle EventBroadcastHandle;
+
+    UPROPERTY()
+    FWorldEventRelevancyConfig RelevancyConfig;
+
+    FRadiantTimerHandle FlushTimerHandle;
+};
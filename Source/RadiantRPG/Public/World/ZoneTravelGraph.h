@@ -0,0 +1,204 @@
+// Source/RadiantRPG/Public/World/ZoneTravelGraph.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Types/WorldTypes.h"
+#include "Core/RadiantTimerManager.h"
+#include "ZoneTravelGraph.generated.h"
+
+class ARadiantZoneManager;
+class AARPG_BaseNPCCharacter;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnZoneTravelFinished, AARPG_BaseNPCCharacter*, NPC, bool, bArrived);
+
+/**
+ * Zone travel configuration
+ */
+USTRUCT(BlueprintType)
+struct FZoneTravelConfig
+{
+    GENERATED_BODY()
+
+    /** Seconds between traveler updates */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Travel", meta = (ClampMin = "0.1"))
+    float UpdateInterval = 0.5f;
+
+    /** Travelers with a player this close walk the navmesh - everyone else advances on timed legs */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Travel", meta = (ClampMin = "0.0"))
+    float ObservedDistance = 8000.0f;
+
+    /** Speed used to time abstract legs */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Travel", meta = (ClampMin = "1.0"))
+    float AbstractTravelSpeed = 300.0f;
+
+    /** How close to a waypoint counts as reaching it on the navmesh */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Travel", meta = (ClampMin = "10.0"))
+    float AcceptanceRadius = 150.0f;
+
+    FZoneTravelConfig()
+    {
+    }
+};
+
+/**
+ * Zone travel graph - long-distance NPC travel between zones
+ *
+ * Zones are nodes and FZoneData::ConnectedZones are edges, crossing at the
+ * zone's FZoneTransition points (or halfway between the zones when none is
+ * set). Routes are planned over the zone graph, not the navmesh. Each leg
+ * is walked with navmesh MoveTo only while its zone is active and a player
+ * is near the traveler. Otherwise the leg is a timed edge, and the NPC is
+ * placed at the waypoint when the timer runs out - only in a loaded zone
+ * and on the navmesh, else it stays abstract. A traveler that arrives
+ * where it can't stand is handed to the crowd manager as a proxy. Nodes
+ * are seeded from the world manager's saved zones and outlive their actors,
+ * so routes can pass through zones that never loaded this session.
+ */
+UCLASS()
+class RADIANTRPG_API UZoneTravelGraph : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    // Zone Registration
+    /** Add or refresh a zone node - ZoneData.Boundary locates it while the actor is unloaded */
+    void RegisterZone(ARadiantZoneManager* Zone, const FZoneData& ZoneData, const TArray<FZoneTransition>& Transitions);
+
+    /** The node stays in the graph as an unloaded zone */
+    void UnregisterZone(ARadiantZoneManager* Zone);
+
+    /** Add nodes for saved zones - loaded zones keep their live data */
+    void SeedZones(const TMap<FName, FZoneData>& SavedZones);
+
+    void SetZoneActive(ARadiantZoneManager* Zone, bool bActive);
+
+    // Routing
+    UFUNCTION(BlueprintPure, Category = "Zone Travel")
+    FName GetZoneIDAtLocation(FVector Location) const;
+
+    /** Waypoints from Start to Destination - zone crossings followed by Destination itself */
+    UFUNCTION(BlueprintCallable, Category = "Zone Travel")
+    bool FindRoute(FVector Start, FVector Destination, TArray<FVector>& OutWaypoints) const;
+
+    // Travel
+    /** Send an NPC along a zone route - server only. The NPC's brain is paused until it arrives */
+    UFUNCTION(BlueprintCallable, Category = "Zone Travel")
+    bool StartTravel(AARPG_BaseNPCCharacter* NPC, FVector Destination);
+
+    UFUNCTION(BlueprintCallable, Category = "Zone Travel")
+    void CancelTravel(AARPG_BaseNPCCharacter* NPC);
+
+    UFUNCTION(BlueprintPure, Category = "Zone Travel")
+    bool IsTraveling(const AARPG_BaseNPCCharacter* NPC) const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Zone Travel")
+    FOnZoneTravelFinished OnTravelFinished;
+
+    // Configuration
+    UFUNCTION(BlueprintCallable, Category = "Zone Travel")
+    void ConfigureTravel(const FZoneTravelConfig& Config);
+
+protected:
+    struct FTravelEdge
+    {
+        int32 ToNode = INDEX_NONE;
+        FVector Portal = FVector::ZeroVector;
+        float Cost = 0.0f;
+
+        /** Extra seconds to cross, from FZoneTransition::TransitionTime */
+        float CrossingTime = 0.0f;
+    };
+
+    struct FZoneNode
+    {
+        FName ZoneID;
+        TWeakObjectPtr<ARadiantZoneManager> Zone;
+        FBox Bounds = FBox(ForceInit);
+        TArray<FName> ConnectedZones;
+        TArray<FZoneTransition> Transitions;
+        TArray<FTravelEdge> Edges;
+        bool bActive = false;
+    };
+
+    struct FTraveler
+    {
+        TWeakObjectPtr<AARPG_BaseNPCCharacter> NPC;
+
+        /** Leg i runs from the previous waypoint to Waypoints[i] through LegNodes[i] */
+        TArray<FVector> Waypoints;
+        TArray<int32> LegNodes;
+        TArray<float> CrossingTimes;
+        int32 Leg = 0;
+
+        FVector LegStart = FVector::ZeroVector;
+        float LegStartTime = 0.0f;
+        float LegDuration = 0.0f;
+        bool bAbstract = false;
+        bool bMoveIssued = false;
+    };
+
+    /** Advance every traveler by one update */
+    void UpdateTravelers();
+
+    /** Returns false once the traveler is done */
+    bool UpdateTraveler(FTraveler& Traveler, const TArray<FVector, TInlineAllocator<8>>& ViewLocations, float Now);
+
+    void BeginAbstractLeg(FTraveler& Traveler, float Now) const;
+
+    /** Where an abstract traveler would be by now */
+    FVector GetAbstractLocation(const FTraveler& Traveler, float Now) const;
+
+    /** Drop an abstract traveler where it would be by now, ready for the navmesh. False if it has nowhere to stand yet */
+    bool ResumeOnNavmesh(FTraveler& Traveler, float Now) const;
+
+    /** Teleport onto the navmesh near Location - false, leaving the NPC where it is, in an unloaded zone or off the navmesh */
+    bool PlaceNPC(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const;
+
+    /** Park an NPC that arrived where it can't stand as a crowd proxy at Location */
+    bool HandOffToCrowd(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const;
+
+    bool IssueMove(AARPG_BaseNPCCharacter* NPC, const FVector& Location) const;
+    void StopMove(AARPG_BaseNPCCharacter* NPC) const;
+
+    void FinishTravel(int32 TravelerIndex, bool bArrived);
+
+    /** Rebuild every node's edges from the connection lists */
+    void RebuildEdges();
+
+    /** Existing node for the zone, or a new empty one */
+    FZoneNode& FindOrAddNode(FName ZoneID);
+
+    /** Node data from a zone description - the actor and transitions are left alone */
+    static void ApplyZoneData(FZoneNode& Node, const FZoneData& ZoneData);
+
+    /** Fill the traveler's legs for a trip from Start to Destination */
+    bool BuildRoute(const FVector& Start, const FVector& Destination, FTraveler& OutRoute) const;
+
+    /** Zone path from StartNode to GoalNode, both included */
+    bool FindNodePath(int32 StartNode, int32 GoalNode, TArray<int32>& OutPath) const;
+
+    int32 FindNodeAtLocation(const FVector& Location) const;
+    int32 FindTravelerIndex(const AARPG_BaseNPCCharacter* NPC) const;
+
+    float GetTravelTime() const;
+
+    void RestartUpdateTimer();
+
+private:
+    TArray<FZoneNode> Nodes;
+    TMap<FName, int32> NodeIndices;
+
+    TArray<FTraveler> Travelers;
+
+    UPROPERTY()
+    FZoneTravelConfig TravelConfig;
+
+    FRadiantTimerHandle UpdateTimerHandle;
+};
@@ -40,7 +40,8 @@ public class RadiantRPG : ModuleRules
 		
 		// Networking
 		PublicDependencyModuleNames.AddRange(new string[] {
-			"NetCore"
+			"NetCore",
+			"ReplicationGraph"
 		});
 		
 		// Private dependencies (optional systems)